@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+位图资源打包器。
+
+读取 Tools/assets/logo_src.c 中取模软件(Image2Lcd)导出的原始1bpp数组（纵向8点一字节、
+按页存放，与 OLED_ShowPicture 相同），压缩后生成：
+  User/Hardware/OLED/logo.c  压缩数据 + oled_bitmap_t 描述符
+  User/Hardware/OLED/logo.h  资源声明
+并打印每个资源节省的flash。注释掉的数组不打包。
+
+压缩格式（操作码流，OLED_ShowBitmap 边解码边写显存，不需要中间缓冲）：
+  0x00~0x3F  字面量：后跟 n+1 个字节（1~64）
+  0x40~0x7F  重复：下一字节重复 (n&0x3F)+2 次（2~65）
+  0x80~0xFF  跳过：(n&0x7F)+1 个字节保持显存原样（1~128），只在差分帧中出现
+指针数组（如 tjbg[]）视为动画：第一帧完整编码，之后每帧只编码与前一帧不同的字节，
+未变化的字节用“跳过”，播放时必须在同一位置按顺序画。
+编码用动态规划求最短的操作码序列。
+
+用法（修改 logo_src.c 后运行）：
+  python Tools/asset_packer.py
+"""
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "Tools", "assets", "logo_src.c")
+OUT_C = os.path.join(ROOT, "User", "Hardware", "OLED", "logo.c")
+OUT_H = os.path.join(ROOT, "User", "Hardware", "OLED", "logo.h")
+
+DESC_SIZE = 8  # sizeof(oled_bitmap_t)：指针 + 宽/高/标志，按4字节对齐
+
+ARRAY_RE = re.compile(r"const\s+unsigned\s+char\s+(\w+)\s*\[\s*(\d*)\s*\]\s*=\s*\{(.*?)\}\s*;", re.S)
+LIST_RE = re.compile(r"const\s+unsigned\s+char\s*\*\s*(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;", re.S)
+HEADER_RE = re.compile(r"/\*(.*?)\*/", re.S)
+HEX_RE = re.compile(r"0[xX][0-9a-fA-F]+")
+
+LIT_MAX = 64
+RUN_MIN, RUN_MAX = 2, 65
+SKIP_MAX = 128
+
+
+def strip_line_comments(text):
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def parse_assets(text):
+    text = strip_line_comments(text)
+    assets = []
+    for m in ARRAY_RE.finditer(text):
+        name, body = m.group(1), m.group(3)
+        header = HEADER_RE.search(body)
+        if header is None:
+            raise ValueError("%s: missing Image2Lcd header comment" % name)
+        hdr = [int(v, 16) for v in HEX_RE.findall(header.group(1))]
+        data = [int(v, 16) for v in HEX_RE.findall(HEADER_RE.sub("", body))]
+        width = (hdr[2] << 8) | hdr[3]
+        if width == 0 or len(data) % width:
+            raise ValueError("%s: %d bytes is not a multiple of width %d" % (name, len(data), width))
+        assets.append({"name": name, "w": width, "pages": len(data) // width, "data": data,
+                       "prev": None})
+    lists = []
+    for m in LIST_RE.finditer(text):
+        frames = re.findall(r"\w+", m.group(2))
+        lists.append((m.group(1), frames))
+    return assets, lists
+
+
+def encode(data, prev=None):
+    """动态规划求最短操作码序列。prev为前一帧时允许“跳过”"""
+    n = len(data)
+    INF = 1 << 30
+    cost = [INF] * (n + 1)
+    choice = [None] * (n + 1)
+    cost[n] = 0
+    for i in range(n - 1, -1, -1):
+        # 字面量
+        for k in range(1, min(LIT_MAX, n - i) + 1):
+            c = 1 + k + cost[i + k]
+            if c < cost[i]:
+                cost[i], choice[i] = c, ("lit", k)
+        # 重复
+        k = 1
+        while i + k < n and k < RUN_MAX and data[i + k] == data[i]:
+            k += 1
+            if k >= RUN_MIN and 2 + cost[i + k] < cost[i]:
+                cost[i], choice[i] = 2 + cost[i + k], ("run", k)
+        # 跳过
+        if prev is not None:
+            k = 0
+            while i + k < n and k < SKIP_MAX and data[i + k] == prev[i + k]:
+                k += 1
+                if 1 + cost[i + k] < cost[i]:
+                    cost[i], choice[i] = 1 + cost[i + k], ("skip", k)
+    out = []
+    i = 0
+    while i < n:
+        op, k = choice[i]
+        if op == "lit":
+            out.append(k - 1)
+            out.extend(data[i:i + k])
+        elif op == "run":
+            out.append(0x40 | (k - RUN_MIN))
+            out.append(data[i])
+        else:
+            out.append(0x80 | (k - 1))
+        i += k
+    return out
+
+
+def decode(code, n, prev=None):
+    out = list(prev) if prev is not None else [0] * n
+    pos = 0
+    i = 0
+    while pos < n:
+        op = code[i]
+        i += 1
+        if op & 0x80:
+            pos += (op & 0x7F) + 1
+        elif op & 0x40:
+            for _ in range((op & 0x3F) + RUN_MIN):
+                out[pos] = code[i]
+                pos += 1
+            i += 1
+        else:
+            for _ in range(op + 1):
+                out[pos] = code[i]
+                pos += 1
+                i += 1
+    return out
+
+
+def main():
+    with open(SRC, "r", encoding="utf-8") as f:
+        assets, lists = parse_assets(f.read())
+    by_name = {a["name"]: a for a in assets}
+
+    for list_name, frames in lists:
+        for prev_name, name in zip(frames, frames[1:]):
+            a, p = by_name[name], by_name[prev_name]
+            if (a["w"], a["pages"]) != (p["w"], p["pages"]):
+                raise ValueError("%s: frame size differs from %s" % (name, prev_name))
+            a["prev"] = p["data"]
+
+    for a in assets:
+        a["code"] = encode(a["data"], a["prev"])
+        if decode(a["code"], len(a["data"]), a["prev"]) != a["data"]:
+            raise AssertionError("%s: round trip failed" % a["name"])
+
+    raw_total = sum(len(a["data"]) for a in assets)
+    packed_total = sum(len(a["code"]) + DESC_SIZE for a in assets)
+
+    report = []
+    report.append("%-20s %7s %6s %6s %6s" % ("asset", "size", "raw", "packed", "saved"))
+    for a in assets:
+        packed = len(a["code"]) + DESC_SIZE
+        report.append("%-20s %7s %6d %6d %6d%s" % (
+            a["name"], "%dx%d" % (a["w"], a["pages"] * 8), len(a["data"]), packed,
+            len(a["data"]) - packed, "  delta" if a["prev"] is not None else ""))
+    report.append("%-20s %7s %6d %6d %6d" % ("total", "", raw_total, packed_total,
+                                              raw_total - packed_total))
+
+    out = []
+    out.append("/**")
+    out.append(" * @file logo.c")
+    out.append(" * @brief 压缩位图资源（由 Tools/asset_packer.py 从 Tools/assets/logo_src.c 生成，请勿手工修改）")
+    out.append(" *")
+    out.append(" * packed 含 %d 字节描述符，delta 为动画差分帧（只能接着前一帧在同一位置画）" % DESC_SIZE)
+    for line in report:
+        out.append(" *   " + line)
+    out.append(" */")
+    out.append('#include "logo.h"')
+    out.append("")
+    for a in assets:
+        out.append("static const uint8_t %s_data[%d] = {" % (a["name"], len(a["code"])))
+        code = a["code"]
+        for i in range(0, len(code), 16):
+            out.append("    " + ", ".join("0x%02X" % b for b in code[i:i + 16]) + ",")
+        out.append("};")
+        out.append("const oled_bitmap_t %s = {%s_data, %d, %d, %s};" % (
+            a["name"], a["name"], a["w"], a["pages"] * 8,
+            "OLED_BMP_DELTA" if a["prev"] is not None else "0"))
+        out.append("")
+    for list_name, frames in lists:
+        out.append("const oled_bitmap_t *const %s[%d] = {" % (list_name, len(frames)))
+        for name in frames:
+            out.append("    &%s," % name)
+        out.append("};")
+        out.append("")
+    with open(OUT_C, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+    out = []
+    out.append("/**")
+    out.append(" * @file logo.h")
+    out.append(" * @brief 压缩位图资源声明（由 Tools/asset_packer.py 生成，请勿手工修改），用 OLED_ShowBitmap 显示")
+    out.append(" */")
+    out.append("#ifndef __LOGO_H")
+    out.append("#define __LOGO_H")
+    out.append("")
+    out.append('#include "oled.h"')
+    out.append("")
+    for a in assets:
+        out.append("extern const oled_bitmap_t %s;" % a["name"])
+    for list_name, frames in lists:
+        out.append("extern const oled_bitmap_t *const %s[%d];" % (list_name, len(frames)))
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    with open(OUT_H, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+    print("\n".join(report))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
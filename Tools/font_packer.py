@@ -0,0 +1,438 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+字库打包器。
+
+Tools/assets/font_src.h 存放完整的原始字模（asc2_HHWW[] 为ASCII，HzkN[] 为汉字）。
+本工具扫描固件源码里实际显示的文字，只保留用到的字模（外加 EXTRA 配置的字符集），
+每个字库在“定长原样”和“压缩”（与 logo.c 相同的操作码流）之间取较小的，
+PROPORTIONAL 里的字号另存每个字的起始列和字宽（比例字体），生成：
+  User/Hardware/OLED/oledfont.c  字模数据 + 索引
+  User/Hardware/OLED/oledfont.h  字库声明
+并打印各字库的flash占用。
+
+扫描规则（跳过注释，字号参数必须是整数字面量）：
+  OLED_ShowString/OLED_ShowChar/OLED_Post_Text  字面量文字 + 字号参数
+  OLED_ShowNum                                  数字
+  OLED_Printf/OLED_Printf_Line/OLED_Post_Line   12号格式串
+  OLED_Printf_Line_32                           24号格式串
+  MENU_NODE/MENU_PAGE                           12号菜单名
+格式串里 %d/%u/%x 等加入对应数字，%s/%c 的内容运行时才知道，该字号要在 EXTRA 里配齐字符集。
+非ASCII字符（源文件须为UTF-8）放进不小于该字号、且 font_src.h 里有这个字的最小汉字字库，
+OLED_Font_Glyph 按同样的规则查找。缺字模时报错退出，不生成文件。
+
+用法（修改界面文字或 font_src.h 后运行）：
+  python Tools/font_packer.py
+"""
+import os
+import re
+import sys
+
+sys.dont_write_bytecode = True
+from asset_packer import encode, decode  # noqa: E402  与位图共用压缩格式
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "Tools", "assets", "font_src.h")
+SCAN_DIR = os.path.join(ROOT, "User")
+OUT_C = os.path.join(ROOT, "User", "Hardware", "OLED", "oledfont.c")
+OUT_H = os.path.join(ROOT, "User", "Hardware", "OLED", "oledfont.h")
+SKIP_DIRS = (os.path.join(SCAN_DIR, "Hardware", "OLED"),)  # 显示库本身只转发调用者的文字
+
+ASCII_ALL = "".join(chr(c) for c in range(0x20, 0x7F))
+
+# 额外保留的字符：8号是日志终端，12号显示菜单名、网络时间等运行时文字，保留完整ASCII
+EXTRA = {
+    8: ASCII_ALL,
+    12: ASCII_ALL,
+}
+
+# 比例字体的字号：每个字只占有墨迹的列加1列字距。8号给日志终端按列对齐，保持等宽；
+# 数字和空格用同一宽度，%2d 之类的补齐和跳动的数值仍然对齐
+PROPORTIONAL = (12, 24)
+TABULAR = "0123456789 "
+
+DESC_SIZE = 24  # sizeof(oled_font_t)
+
+# 调用名 -> (文字参数序号, 字号参数序号 或 ("fixed", 字号), 文字类型)
+CALLS = {
+    "OLED_ShowString": (2, 3, "text"),
+    "OLED_ShowChar": (2, 3, "text"),
+    "OLED_Post_Text": (4, 2, "format"),
+    "OLED_ShowNum": (None, 4, "number"),
+    "OLED_Printf": (2, ("fixed", 12), "format"),
+    "OLED_Printf_Line": (1, ("fixed", 12), "format"),
+    "OLED_Post_Line": (1, ("fixed", 12), "format"),
+    "OLED_Printf_Line_32": (1, ("fixed", 24), "format"),
+    "MENU_NODE": (0, ("fixed", 12), "text"),
+    "MENU_PAGE": (0, ("fixed", 12), "text"),
+    "OLED_LABEL": (5, 4, "text"),
+    "OLED_VALUE": (7, 4, "format"),
+}
+
+CONV_RE = re.compile(r"%[-+ #0]*(\d*|\*)(?:\.(\d+|\*))?(?:hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+CONV_CHARS = {
+    "d": "0123456789-", "i": "0123456789-", "u": "0123456789",
+    "o": "01234567", "x": "0123456789abcdef", "X": "0123456789ABCDEF",
+    "p": "0123456789abcdefx",
+}
+
+
+# ---------------------------------------------------------------- 字模源
+
+TABLE_RE = re.compile(r"const\s+unsigned\s+char\s+(\w+)\s*\[\s*\d*\s*\]\s*\[\s*(\d+)\s*\]\s*=\s*\{")
+GLYPH_RE = re.compile(r"\{([^{}]*)\}\s*,?\s*(?:/\*\"(.+?)\",\d+\s*\*/)?")
+HEX_RE = re.compile(r"0[xX][0-9a-fA-F]+")
+
+
+def table_body(text, start):
+    depth = 0
+    for i in range(start, len(text)):
+        if text[i] == "{":
+            depth += 1
+        elif text[i] == "}":
+            depth -= 1
+            if depth == 0:
+                return text[start + 1:i]
+    raise ValueError("unterminated table")
+
+
+def parse_sources(text):
+    text = re.sub(r"//[^\n]*", "", text)
+    fonts = []
+    for m in TABLE_RE.finditer(text):
+        name, size = m.group(1), int(m.group(2))
+        body = table_body(text, m.end() - 1)
+        glyphs = {}
+        ascii_font = name.startswith("asc2_")
+        if ascii_font:
+            height, width = int(name[5:7]), int(name[7:9])
+        else:
+            height = width = next(h for h in range(8, 129) if h * ((h + 7) // 8) == size)
+        if width * ((height + 7) // 8) != size:
+            raise ValueError("%s: %d bytes per glyph does not match %dx%d" % (name, size, width, height))
+        for i, g in enumerate(GLYPH_RE.finditer(body)):
+            data = [int(v, 16) for v in HEX_RE.findall(g.group(1))]
+            if len(data) != size:
+                raise ValueError("%s[%d]: %d bytes, expected %d" % (name, i, len(data), size))
+            if ascii_font:
+                code = 0x20 + i
+                if code > 0x7E:
+                    continue
+            else:
+                if not g.group(2) or len(g.group(2)) != 1:
+                    raise ValueError("%s[%d]: missing /*\"char\",n*/ comment" % (name, i))
+                code = ord(g.group(2))
+            glyphs[code] = data
+        fonts.append({"name": name, "ascii": ascii_font, "h": height, "w": width,
+                      "glyphs": glyphs, "need": set(), "raw_full": len(glyphs) * size})
+    return fonts
+
+
+# ---------------------------------------------------------------- 源码扫描
+
+TOKEN_RE = re.compile(r"""
+    (?P<comment>//[^\n]*|/\*.*?\*/)
+  | (?P<str>"(?:\\.|[^"\\\n])*")
+  | (?P<chr>'(?:\\.|[^'\\\n])+')
+  | (?P<pre>^[ \t]*\#[^\n]*)
+  | (?P<id>[A-Za-z_]\w*)
+  | (?P<num>\d\w*)
+  | (?P<punct>[()\[\]{},;])
+  | (?P<other>\S)
+""", re.S | re.M | re.X)
+
+ESCAPES = {"n": "\n", "r": "\r", "t": "\t", "0": "\0", "\\": "\\", "'": "'", '"': '"'}
+
+
+def unescape(s):
+    return re.sub(r"\\(.)", lambda m: ESCAPES.get(m.group(1), m.group(1)), s)
+
+
+def tokenize(text):
+    return [(m.lastgroup, m.group()) for m in TOKEN_RE.finditer(text)
+            if m.lastgroup not in ("comment", "pre")]
+
+
+def split_args(tokens, i):
+    """tokens[i] 为 '('，返回参数列表（每个参数是token列表）"""
+    args, cur, depth = [], [], 0
+    for kind, val in tokens[i:]:
+        if val in "([{" and kind == "punct":
+            depth += 1
+            if depth == 1:
+                continue
+        elif val in ")]}" and kind == "punct":
+            depth -= 1
+            if depth == 0:
+                args.append(cur)
+                return args
+        elif val == "," and depth == 1:
+            args.append(cur)
+            cur = []
+            continue
+        cur.append((kind, val))
+    return args
+
+
+def literal_text(arg):
+    """参数是（可能拼接的）字符串或字符字面量时返回内容，否则None"""
+    if arg and arg[0][1] == "(" and ")" in [v for _, v in arg]:
+        arg = arg[[v for _, v in arg].index(")") + 1:]  # 去掉类型转换 (uint8_t *)
+    if arg and all(k == "str" for k, _ in arg):
+        return "".join(unescape(v[1:-1]) for _, v in arg)
+    if len(arg) == 1 and arg[0][0] == "chr":
+        return unescape(arg[0][1][1:-1])
+    return None
+
+
+def scan(path, text, need, notes):
+    tokens = tokenize(text)
+    for i, (kind, val) in enumerate(tokens):
+        if kind != "id" or val not in CALLS or i + 1 >= len(tokens) or tokens[i + 1][1] != "(":
+            continue
+        if i > 0 and tokens[i - 1][0] == "id" and tokens[i - 1][1] not in ("return", "else"):
+            continue  # 函数定义/声明
+        text_idx, size_idx, kind_of = CALLS[val]
+        args = split_args(tokens, i + 1)
+        where = "%s: %s" % (os.path.relpath(path, ROOT), val)
+        if isinstance(size_idx, tuple):
+            size = size_idx[1]
+        else:
+            if size_idx >= len(args) or len(args[size_idx]) != 1 or args[size_idx][0][0] != "num":
+                notes.append("%s: font size is not a literal, skipped" % where)
+                continue
+            size = int(args[size_idx][0][1], 0)
+        chars = need.setdefault(size, set())
+        if kind_of == "number":
+            chars.update("0123456789")
+            continue
+        s = literal_text(args[text_idx]) if text_idx < len(args) else None
+        if s is None:
+            if not EXTRA.get(size):
+                notes.append("%s: runtime text at size %d not covered by EXTRA" % (where, size))
+            continue
+        if kind_of == "format":
+            for conv in CONV_RE.finditer(s):
+                width = conv.group(1)
+                if width and width != "*" and int(width) > 0:
+                    chars.add(" ")
+                c = conv.group(3)
+                if c in CONV_CHARS:
+                    chars.update(CONV_CHARS[c])
+                elif c == "%":
+                    chars.add("%")
+                elif not EXTRA.get(size):
+                    notes.append("%s: %%%s at size %d not covered by EXTRA" % (where, c, size))
+            s = CONV_RE.sub("", s)
+        chars.update(ch for ch in s if ch >= " ")
+
+
+def read_source(path):
+    raw = open(path, "rb").read()
+    try:
+        return raw.decode("utf-8"), True
+    except UnicodeDecodeError:
+        return raw.decode("gbk"), False
+
+
+# ---------------------------------------------------------------- 生成
+
+def assign(fonts, need):
+    """把每个字号需要的字符分配到字库，返回缺字列表"""
+    missing = []
+    for size, chars in sorted(need.items()):
+        for ch in sorted(chars):
+            code = ord(ch)
+            if code < 0x80:
+                cands = [f for f in fonts if f["ascii"] and f["h"] == size]
+            else:
+                cands = sorted((f for f in fonts if not f["ascii"] and f["h"] >= size), key=lambda f: f["h"])
+            for f in cands:
+                if code in f["glyphs"]:
+                    f["need"].add(code)
+                    break
+            else:
+                missing.append("size %d: %r (U+%04X)" % (size, ch, code))
+    return missing
+
+
+def ink_columns(glyph, width, pages):
+    return [c for c in range(width) if any(glyph[p * width + c] for p in range(pages))]
+
+
+def metrics(font, codes):
+    """比例字体每字模一字节：高4位为起始列，低4位为字宽（含1列字距）"""
+    w, pages = font["w"], (font["h"] + 7) // 8
+    ink = {c: ink_columns(font["glyphs"][c], w, pages) for c in codes}
+    digits = [c for c in map(ord, TABULAR) if c in font["glyphs"] and ink_columns(font["glyphs"][c], w, pages)]
+    if digits:
+        tab_l = min(ink_columns(font["glyphs"][c], w, pages)[0] for c in digits)
+        tab_r = max(ink_columns(font["glyphs"][c], w, pages)[-1] for c in digits)
+    else:
+        tab_l, tab_r = 0, w - 2
+    out = []
+    for c in codes:
+        if chr(c) in TABULAR or not ink[c]:
+            left, right = tab_l, tab_r
+        else:
+            left, right = ink[c][0], ink[c][-1]
+        advance = min(right - left + 2, w)  # 占满整格的字按原设计紧贴下一个字，不比等宽更宽
+        if left > 15 or advance > 15:
+            raise ValueError("%s U+%04X: metrics do not fit in a byte" % (font["name"], c))
+        out.append((left << 4) | advance)
+    return out
+
+
+def build(font):
+    codes = sorted(font["need"])
+    font["metrics"] = metrics(font, codes) if font["ascii"] and font["h"] in PROPORTIONAL else None
+    pages = (font["h"] + 7) // 8
+    stride = font["w"] * pages
+    raw = [b for c in codes for b in font["glyphs"][c]]
+    packed, offsets = [], []
+    for c in codes:
+        offsets.append(len(packed))
+        code = encode(font["glyphs"][c])
+        if decode(code, stride) != font["glyphs"][c]:
+            raise AssertionError("%s U+%04X: round trip failed" % (font["name"], c))
+        packed.extend(code)
+    contiguous = codes == list(range(codes[0], codes[0] + len(codes)))
+    font["codes"] = codes
+    font["contiguous"] = contiguous
+    font["index_bytes"] = 0 if contiguous else 2 * len(codes)
+    if len(packed) + 2 * len(codes) < len(raw) and len(packed) < 0x10000:
+        font["data"], font["offsets"] = packed, offsets
+    else:
+        font["data"], font["offsets"] = raw, None
+    font["total"] = (len(font["data"]) + font["index_bytes"] + DESC_SIZE
+                     + (2 * len(codes) if font["offsets"] else 0)
+                     + (len(codes) if font["metrics"] else 0))
+
+
+def c_array(ctype, name, values, fmt):
+    out = ["static const %s %s[%d] = {" % (ctype, name, len(values))]
+    per = 16 if fmt == "0x%02X" else 12
+    for i in range(0, len(values), per):
+        out.append("    " + ", ".join(fmt % v for v in values[i:i + per]) + ",")
+    out.append("};")
+    return out
+
+
+def char_comment(codes):
+    if codes == list(range(codes[0], codes[0] + len(codes))):
+        return "U+%04X~U+%04X" % (codes[0], codes[-1])
+    return "".join(chr(c) if chr(c) not in "*/\\" else "?" for c in codes)
+
+
+def main():
+    with open(SRC, "r", encoding="utf-8") as f:
+        fonts = parse_sources(f.read())
+
+    need = {size: set(chars) for size, chars in EXTRA.items()}
+    notes = []
+    for dirpath, _, files in os.walk(SCAN_DIR):
+        if dirpath.startswith(SKIP_DIRS):
+            continue
+        for name in sorted(files):
+            if not name.endswith(".c"):
+                continue
+            path = os.path.join(dirpath, name)
+            text, utf8 = read_source(path)
+            before = {s: set(c) for s, c in need.items()}
+            scan(path, text, need, notes)
+            if not utf8:
+                for size, chars in need.items():
+                    if any(ord(c) >= 0x80 for c in chars - before.get(size, set())):
+                        notes.append("%s: non-ASCII text in a GBK source file" % os.path.relpath(path, ROOT))
+                        break
+
+    missing = assign(fonts, need)
+    for n in notes:
+        print("note: " + n)
+    if missing:
+        for m in missing:
+            print("missing glyph: " + m)
+        print("add the glyphs to %s and run again" % os.path.relpath(SRC, ROOT))
+        return 1
+
+    used = [f for f in fonts if f["need"]]
+    used.sort(key=lambda f: (f["h"], not f["ascii"]))
+    for f in used:
+        build(f)
+
+    src_total = sum(f["raw_full"] for f in fonts if f["ascii"])
+    total = sum(f["total"] for f in used)
+    report = ["%-10s %6s %6s %7s %6s  %s" % ("font", "size", "glyphs", "storage", "bytes", "")]
+    for f in fonts:
+        if f["need"]:
+            report.append("%-10s %6s %6d %7s %6d  %s" % (
+                f["name"], "%dx%d" % (f["w"], f["h"]), len(f["codes"]),
+                "packed" if f["offsets"] else "raw", f["total"],
+                "proportional" if f["metrics"] else ""))
+        elif f["ascii"]:
+            report.append("%-10s %6s %6d %7s %6d" % (f["name"], "%dx%d" % (f["w"], f["h"]), 0, "-", 0))
+    report.append("%-10s %6s %6s %7s %6d  (full ASCII tables: %d)" % ("total", "", "", "", total, src_total))
+
+    out = []
+    out.append("/**")
+    out.append(" * @file oledfont.c")
+    out.append(" * @brief 字库（由 Tools/font_packer.py 从 Tools/assets/font_src.h 生成，请勿手工修改）")
+    out.append(" *")
+    out.append(" * 只含固件里用到的字符；bytes 含索引和 %d 字节描述符" % DESC_SIZE)
+    for line in report:
+        out.append(" *   " + line.rstrip())
+    out.append(" */")
+    out.append('#include "oledfont.h"')
+    out.append("#include <stddef.h>")
+    out.append("")
+    for f in used:
+        tag = "%s_%02d%02d" % ("asc" if f["ascii"] else "hzk", f["h"], f["w"])
+        f["tag"] = tag
+        out.append("// %s: %s" % (f["name"], char_comment(f["codes"])))
+        out.extend(c_array("uint8_t", "font_%s_data" % tag, f["data"], "0x%02X"))
+        if f["offsets"]:
+            out.extend(c_array("uint16_t", "font_%s_offset" % tag, f["offsets"], "%d"))
+        if not f["contiguous"]:
+            out.extend(c_array("uint16_t", "font_%s_codes" % tag, f["codes"], "0x%04X"))
+        if f["metrics"]:
+            out.extend(c_array("uint8_t", "font_%s_metrics" % tag, f["metrics"], "0x%02X"))
+        out.append("")
+    out.append("// 按字号从小到大排列，同字号ASCII在前")
+    out.append("const oled_font_t oled_fonts[OLED_FONT_COUNT] = {")
+    for f in used:
+        out.append("    {font_%s_data, %s, %s, %s, 0x%04X, %d, %d, %d}," % (
+            f["tag"],
+            "font_%s_offset" % f["tag"] if f["offsets"] else "NULL",
+            "NULL" if f["contiguous"] else "font_%s_codes" % f["tag"],
+            "font_%s_metrics" % f["tag"] if f["metrics"] else "NULL",
+            f["codes"][0], len(f["codes"]), f["h"], f["w"]))
+    out.append("};")
+    out.append("")
+    with open(OUT_C, "w", encoding="utf-8", newline="\n") as fp:
+        fp.write("\n".join(out))
+
+    out = []
+    out.append("/**")
+    out.append(" * @file oledfont.h")
+    out.append(" * @brief 字库声明（由 Tools/font_packer.py 生成，请勿手工修改），用 OLED_Font_Glyph 查找字模")
+    out.append(" */")
+    out.append("#ifndef __OLEDFONT_H")
+    out.append("#define __OLEDFONT_H")
+    out.append("")
+    out.append('#include "oled.h"')
+    out.append("")
+    out.append("#define OLED_FONT_COUNT %d" % len(used))
+    out.append("")
+    out.append("extern const oled_font_t oled_fonts[OLED_FONT_COUNT];")
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    with open(OUT_H, "w", encoding="utf-8", newline="\n") as fp:
+        fp.write("\n".join(out))
+
+    print("\n".join(line.rstrip() for line in report))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+令牌化日志主机端解码器：普通文本行原样输出，"$<base64>" 行按 Tools/log_tokens.csv 还原。
+
+用法：
+  python Tools/log_decode.py capture.txt            # 解码抓取的串口日志
+  python Tools/log_decode.py --port COM5            # 直接读串口（需要 pyserial）
+  python Tools/log_decode.py --db other.csv -       # 从标准输入读取
+"""
+import argparse
+import base64
+import csv
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from log_tokenizer import CONV_RE, db_hash, format_signature, unescape_c  # noqa: E402
+
+DEFAULT_DB = os.path.join(os.path.dirname(os.path.abspath(__file__)), "log_tokens.csv")
+STR_MAX = 24
+
+
+def load_db(path):
+    """返回 (令牌表, 数据库哈希)，哈希与固件启动时打印的 token db 值对应"""
+    db = {}
+    rows = []
+    with open(path, encoding="utf-8", newline="") as f:
+        text = f.read()
+    for row in csv.DictReader(text.splitlines()):
+        token = int(row["token"], 16)
+        rows.append((token, row["file"], int(row["line"]), row["format"]))
+        db.setdefault(token, (unescape_c(row["format"]), row["file"], int(row["line"])))
+    return db, db_hash(rows)
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return value, pos
+
+
+def unpack_args(fmt, data, pos):
+    args = []
+    for kind in format_signature(fmt):
+        if pos >= len(data):
+            args.append(None)  # 设备端因负载上限截断
+            continue
+        if kind == "i":
+            v, pos = read_varint(data, pos)
+            args.append((v >> 1) ^ -(v & 1))
+        elif kind == "u":
+            v, pos = read_varint(data, pos)
+            args.append(v)
+        elif kind == "c":
+            args.append(chr(data[pos]))
+            pos += 1
+        elif kind == "f":
+            args.append(struct.unpack_from("<f", data, pos)[0])
+            pos += 4
+        elif kind == "s":
+            n = data[pos]
+            args.append(data[pos + 1:pos + 1 + n].decode("utf-8", "replace"))
+            pos += 1 + n
+    return args
+
+
+def render(fmt, args):
+    """用Python的%格式化还原C格式串（去掉长度修饰符，缺失参数显示为?）"""
+    out = []
+    last = 0
+    it = iter(args)
+    for m in CONV_RE.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        if width == "*":
+            width = str(next(it, 0) or 0)
+        if prec == "*":
+            prec = str(next(it, 0) or 0)
+        value = next(it, None)
+        if value is None:
+            out.append("?")
+            continue
+        spec = "%" + flags + (width or "") + ("." + prec if prec else "")
+        if conv == "p":
+            out.append("0x%08x" % value)
+        elif conv == "u":
+            out.append((spec + "d") % value)
+        else:
+            out.append((spec + conv) % value)
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+def decode_line(line, db):
+    payload = line.strip()[1:]
+    try:
+        data = base64.b64decode(payload + "=" * (-len(payload) % 4))
+        token, pos = read_varint(data, 0)
+        tick, pos = read_varint(data, pos)
+    except (ValueError, IndexError):
+        return line.rstrip("\r\n") + "  <undecodable>"
+    entry = db.get(token)
+    if entry is None:
+        return "[%6d] <unknown token %08X, regenerate log_tokens.csv>" % (tick, token)
+    fmt, _, _ = entry
+    try:
+        text = render(fmt, unpack_args(fmt, data, pos))
+    except (IndexError, struct.error, TypeError, ValueError):
+        text = fmt + "  <bad args>"
+    return "[%6d] %s" % (tick, text.rstrip("\r\n"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?", default="-", help="日志文件，- 表示标准输入")
+    parser.add_argument("--db", default=DEFAULT_DB, help="令牌数据库（log_tokenizer.py生成）")
+    parser.add_argument("--port", help="串口名，指定后直接读取串口")
+    parser.add_argument("--baud", type=int, default=115200)
+    opts = parser.parse_args()
+
+    db, db_hash = load_db(opts.db)
+    token_re = re.compile(r"^\$[A-Za-z0-9+/]+=*\s*$")
+    hash_re = re.compile(r"token db ([0-9A-Fa-f]{8})")
+
+    if opts.port:
+        import serial  # pyserial
+        stream = (raw.decode("utf-8", "replace") for raw in serial.Serial(opts.port, opts.baud))
+    elif opts.input == "-":
+        stream = sys.stdin
+    else:
+        stream = open(opts.input, encoding="utf-8", errors="replace")
+
+    for line in stream:
+        if token_re.match(line):
+            print(decode_line(line, db))
+        else:
+            sys.stdout.write(line if line.endswith("\n") else line + "\n")
+            m = hash_re.search(line)
+            if m and int(m.group(1), 16) != db_hash:
+                print("!! firmware token db %s does not match %s (%08X)" % (m.group(1), opts.db, db_hash))
+
+
+if __name__ == "__main__":
+    main()
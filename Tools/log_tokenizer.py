@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+令牌化日志的构建期扫描器。
+
+扫描 User/ 下所有 .c 文件中的 LOG_E/W/I/D(模块, 格式, ...) 调用，格式串加上与文本输出相同的
+"级别/模块: " 前缀后入库（被编译期级别删掉的调用也入库，只是不会被引用），
+令牌ID = (LOG_FILE_ID << 16) | 格式串CRC32低16位（同文件内冲突时顺延），只取决于文件号和格式串，
+与行号无关：插删代码不会改变已发布固件的令牌，旧日志仍能用新数据库解码。生成：
+  User/System/log_token_ids.h 调用点(文件号, 行号) -> 令牌ID，LOG_x宏按 __LINE__ 取用
+  User/System/log_token_db.c  设备端参数类型表（按ID升序，供 Log_Token_Emit 打包参数）
+  Tools/log_tokens.csv        主机端数据库（ID、文件、行号、格式串），供 log_decode.py 使用
+
+调用点行号变化后没有重新生成时，LOG_x展开出的 LOG_TOKEN_ID_<文件号>_<行号> 未定义，编译直接失败。
+格式串在原行上修改不会改变行号，编译器发现不了，用 --check 检查（生成物过期时返回1，
+适合放在编译前步骤或提交前检查里）：
+  python Tools/log_tokenizer.py            # 重新生成
+  python Tools/log_tokenizer.py --check    # 只检查，不写文件
+"""
+import csv
+import io
+import os
+import re
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC_DIR = os.path.join(ROOT, "User")
+DB_C = os.path.join(SRC_DIR, "System", "log_token_db.c")
+DB_H = os.path.join(SRC_DIR, "System", "log_token_ids.h")
+DB_CSV = os.path.join(ROOT, "Tools", "log_tokens.csv")
+
+# 日志宏 -> 级别标签（与 log.h 中 LOG_EMIT 拼出的前缀一致）
+TOKEN_MACROS = {"LOG_E": "E", "LOG_W": "W", "LOG_I": "I", "LOG_D": "D"}
+
+FILE_ID_RE = re.compile(r"^\s*#\s*define\s+LOG_FILE_ID\s+(\d+)", re.M)
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+MODULE_RE = re.compile(r"\s*([A-Za-z_][A-Za-z0-9_]*)\s*,\s*")
+CONV_RE = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|L|z|j|t)?([diouxXcsfFeEgGp%])")
+
+
+def read_source(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    for enc in ("utf-8", "gbk"):
+        try:
+            return data.decode(enc)
+        except UnicodeDecodeError:
+            pass
+    return data.decode("latin-1")
+
+
+def unescape_c(s):
+    return bytes(s, "latin-1", "backslashreplace").decode("unicode_escape") if "\\" in s else s
+
+
+def format_signature(fmt):
+    """由printf格式串推出参数类型串（与 log_token.c 的打包规则一致）"""
+    sig = []
+    for m in CONV_RE.finditer(fmt):
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            continue
+        if length in ("ll", "L", "j"):
+            raise ValueError("64-bit argument not supported: %" + m.group(0))
+        if width == "*":
+            sig.append("i")
+        if prec == "*":
+            sig.append("i")
+        if conv in "di":
+            sig.append("i")
+        elif conv in "ouxXp":
+            sig.append("u")
+        elif conv == "c":
+            sig.append("c")
+        elif conv == "s":
+            sig.append("s")
+        else:
+            sig.append("f")
+    return "".join(sig)
+
+
+def scan_file(path, rel):
+    text = read_source(path)
+    if not any(m + "(" in text for m in TOKEN_MACROS):
+        return None, []
+    fid = FILE_ID_RE.search(text)
+    entries = []
+    for lineno, line in enumerate(text.splitlines(), 1):
+        stripped = line.strip()
+        if stripped.startswith("//") or stripped.startswith("#"):
+            continue
+        calls = 0
+        for macro, tag in sorted(TOKEN_MACROS.items()):
+            start = line.find(macro + "(")
+            if start < 0 or (start > 0 and (line[start - 1].isalnum() or line[start - 1] == "_")):
+                continue
+            calls += line.count(macro + "(")
+            if fid is None:
+                raise SystemExit("%s:%d: %s used without LOG_FILE_ID" % (rel, lineno, macro))
+            rest = line[start + len(macro) + 1:]
+            if ");" not in rest and not rest.rstrip().endswith(")"):
+                raise SystemExit("%s:%d: %s call must fit on one line" % (rel, lineno, macro))
+            module = MODULE_RE.match(rest)
+            if module is None:
+                raise SystemExit("%s:%d: %s needs a module name" % (rel, lineno, macro))
+            # 相邻字符串字面量拼接
+            fmt = ""
+            pos = module.end()
+            while True:
+                m = STRING_RE.match(rest, pos)
+                if m is None:
+                    break
+                fmt += m.group(1)
+                pos = m.end()
+                while pos < len(rest) and rest[pos] in " \t":
+                    pos += 1
+            if pos == module.end():
+                raise SystemExit("%s:%d: %s format must be a string literal" % (rel, lineno, macro))
+            fmt = "%s/%s: %s" % (tag, module.group(1), fmt)
+            # 数据库中保存C源码里的转义形式，解码器加载时再反转义；令牌在assign_tokens中分配
+            entries.append([0, rel, lineno, fmt, format_signature(unescape_c(fmt))])
+        if calls > 1:
+            raise SystemExit("%s:%d: one log call per line (the token is looked up by line)" % (rel, lineno))
+    if entries:
+        assign_tokens(int(fid.group(1)), entries)
+    return (int(fid.group(1)) if fid else None), entries
+
+
+def assign_tokens(fid, entries):
+    """同一文件内相同格式串共用一个令牌，不同格式串哈希冲突时按格式串排序顺延"""
+    used = {}
+    for fmt in sorted(set(e[3] for e in entries)):
+        low = zlib.crc32(fmt.encode("utf-8")) & 0xFFFF
+        while low in used:
+            low = (low + 1) & 0xFFFF
+        used[low] = fmt
+    tokens = dict((fmt, (fid << 16) | low) for low, fmt in used.items())
+    for e in entries:
+        e[0] = tokens[e[3]]
+
+
+def db_hash(entries):
+    """数据库哈希只覆盖令牌和格式串：仅行号变化时不变，与固件启动时打印的 token db 对应"""
+    rows = sorted(set("%08X,%s\n" % (e[0], e[3]) for e in entries))
+    return zlib.crc32("".join(rows).encode("utf-8")) & 0xFFFFFFFF
+
+
+def c_escape(s):
+    return s.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def generate():
+    """扫描源码，返回 {路径: 内容} 和统计信息"""
+    entries = []
+    owners = {}
+    for dirpath, _, files in os.walk(SRC_DIR):
+        if "FreeRTOS" in dirpath:
+            continue
+        for name in sorted(files):
+            if not name.endswith(".c"):
+                continue
+            path = os.path.join(dirpath, name)
+            rel = os.path.relpath(path, ROOT).replace("\\", "/")
+            fid, found = scan_file(path, rel)
+            if not found:
+                continue
+            if fid in owners:
+                raise SystemExit("LOG_FILE_ID %d used by both %s and %s" % (fid, owners[fid], rel))
+            owners[fid] = rel
+            entries.extend(found)
+    entries.sort(key=lambda e: (e[0], e[1], e[2]))
+
+    csv_buf = io.StringIO()
+    writer = csv.writer(csv_buf, lineterminator="\n")
+    writer.writerow(["token", "file", "line", "format"])
+    for token, rel, lineno, fmt, _ in entries:
+        writer.writerow(["%08X" % token, rel, lineno, fmt])
+    csv_text = csv_buf.getvalue()
+    hash_value = db_hash(entries)
+
+    ids = []
+    ids.append("/**")
+    ids.append(" * @file log_token_ids.h")
+    ids.append(" * @brief 调用点到令牌ID的映射（由 Tools/log_tokenizer.py 生成，请勿手工修改）")
+    ids.append(" */")
+    ids.append("#ifndef __LOG_TOKEN_IDS_H")
+    ids.append("#define __LOG_TOKEN_IDS_H")
+    ids.append("")
+    for token, rel, lineno, fmt, _ in sorted(entries, key=lambda e: (e[0] >> 16, e[2])):
+        ids.append("#define LOG_TOKEN_ID_%d_%d 0x%08XUL // %s" % (token >> 16, lineno, token, rel.split("/")[-1]))
+    ids.append("")
+    ids.append("#endif")
+    ids.append("")
+
+    out = []
+    out.append("/**")
+    out.append(" * @file log_token_db.c")
+    out.append(" * @brief 令牌参数类型表（由 Tools/log_tokenizer.py 生成，请勿手工修改）")
+    out.append(" */")
+    out.append('#include "log_token.h"')
+    out.append("")
+    out.append("const uint32_t log_token_db_hash = 0x%08XUL;" % hash_value)
+    out.append("")
+    out.append("const log_token_sig_t log_token_sigs[] = {")
+    sigs = []
+    for token, rel, lineno, fmt, sig in entries:
+        if sigs and sigs[-1][0] == token:
+            continue  # 同一格式串的其他调用点
+        sigs.append((token, sig, rel, lineno))
+        out.append('    {0x%08XUL, "%s"}, // %s:%d' % (token, sig, rel.split("/")[-1], lineno))
+    if not sigs:
+        out.append("    {0, \"\"},")
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t log_token_sig_count = %d;" % len(sigs))
+    out.append("")
+
+    files = {DB_CSV: csv_text, DB_H: "\n".join(ids), DB_C: "\n".join(out)}
+    saved = sum(len(unescape_c(e[3])) + 1 for e in entries)
+    return files, (len(sigs), hash_value, saved)
+
+
+def read_text(path):
+    try:
+        with open(path, encoding="utf-8", newline="") as f:
+            return f.read()
+    except IOError:
+        return None
+
+
+def main():
+    files, (count, hash_value, saved) = generate()
+
+    if "--check" in sys.argv[1:]:
+        stale = [os.path.relpath(p, ROOT) for p, text in sorted(files.items()) if read_text(p) != text]
+        if stale:
+            print("log token database is stale, run Tools/log_tokenizer.py: " + ", ".join(stale))
+            sys.exit(1)
+        print("%d tokens, db hash %08X, up to date" % (count, hash_value))
+        return
+
+    for path, text in files.items():
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+    print("%d tokens, db hash %08X, %d bytes of format strings removed from flash"
+          % (count, hash_value, saved))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,50 @@
+/* 主机端基准测试用的FreeRTOS替身：调度器默认视为未启动，OLED驱动走同步刷新路径；
+ * 切换动画测试把bench_scheduler_state设为运行，节拍由vTaskDelayUntil和总线桩推进 */
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void *);
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE                      1
+#define pdFALSE                     0
+#define pdPASS                      1
+#define portMAX_DELAY               0xFFFFFFFFUL
+#define taskSCHEDULER_NOT_STARTED   1
+#define taskSCHEDULER_RUNNING       2
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(ms))
+#define portTICK_PERIOD_MS          1
+
+static BaseType_t bench_scheduler_state = taskSCHEDULER_NOT_STARTED;
+static TickType_t bench_tick;
+
+static inline BaseType_t xTaskGetSchedulerState(void) { return bench_scheduler_state; }
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void) { return NULL; }
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t h) { (void)h; return pdPASS; }
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) { (void)clear; (void)ticks; return 0; }
+static inline void vTaskDelay(TickType_t ticks) { (void)ticks; }
+static inline void vTaskDelayUntil(TickType_t *wake, TickType_t ticks)
+{
+	*wake += ticks;
+	if ((int32_t)(*wake - bench_tick) > 0)
+		bench_tick = *wake;
+}
+static inline TickType_t xTaskGetTickCount(void) { return bench_tick; }
+static inline SemaphoreHandle_t xSemaphoreCreateMutex(void) { return NULL; }
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) { (void)s; (void)ticks; return pdTRUE; }
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) { (void)s; return pdTRUE; }
+static inline BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint16_t stack, void *arg,
+                                     UBaseType_t prio, TaskHandle_t *handle)
+{
+	(void)fn; (void)name; (void)stack; (void)arg; (void)prio; (void)handle;
+	return pdFALSE;
+}
+
+#endif
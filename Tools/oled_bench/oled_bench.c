@@ -0,0 +1,394 @@
+/**
+ * @file oled_bench.c
+ * @brief 主机端基准：按列字节的点阵写入(OLED_Blit/OLED_Fill_Rect) 对比 逐点OLED_DrawPoint
+ *
+ * 直接包含设备端 oled.c（I2C发送替换为SSD1306模拟器），先逐字节核对两种路径写出的显存一致，
+ * 再各跑若干轮统计耗时；最后在模拟器上逐次传输核对切换动画(OLED_Slide)的屏幕画面。
+ * 用法（仓库根目录）：
+ *   gcc -O2 -I Tools/oled_bench -I User/Hardware/OLED -I User/System \
+ *       Tools/oled_bench/oled_bench.c -o oled_bench && ./oled_bench
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "oled.c"
+#include "oled_anim.c"
+#include "oledfont.c"
+#include "../assets/font_src.h" // 原始字模，作为点阵数据样本
+
+uint8_t log_runtime_level[LOG_MOD_COUNT];
+int Log_Printf(const char *format, ...) { (void)format; return 0; }
+void Log_Token_Emit(uint32_t id, ...) { (void)id; }
+void OLED_HW_I2C_Init(void) {}
+
+// SSD1306模拟器：解析命令流（寻址模式、列/页窗口、页模式寻址、起始行），数据写进屏幕RAM。
+// 屏幕第r行显示RAM第(r+起始行)%64行（复用率1/64、显示偏移0）
+static struct
+{
+	uint8_t ram[8][128];
+	uint8_t mode;               // 0水平 1垂直 2页寻址
+	uint8_t col, page;          // 当前写入位置
+	uint8_t col1, col2, page1, page2;
+	uint8_t start;              // 起始行
+	uint8_t cmd, argc, args[6]; // 正在收参数的多字节命令
+	uint32_t bytes;             // 数据字节数
+	uint16_t bytes_per_tick;    // 非0时每写这么多数据字节节拍加1，模拟慢总线
+	void (*hook)(void);         // 每次传输结束后调用（切换动画核对）
+} emu = {.mode = 2, .col2 = 127, .page2 = 7};
+
+static uint8_t Emu_Arg_Count(uint8_t c)
+{
+	switch (c)
+	{
+	case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+	case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+		return 1;
+	case 0x21: case 0x22: case 0xA3:
+		return 2;
+	case 0x29: case 0x2A:
+		return 5;
+	case 0x26: case 0x27:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+static void Emu_Command(uint8_t c)
+{
+	if (emu.argc > 0)
+	{
+		emu.args[Emu_Arg_Count(emu.cmd) - emu.argc] = c;
+		if (--emu.argc > 0)
+			return;
+		switch (emu.cmd)
+		{
+		case 0x20: emu.mode = emu.args[0] & 0x03; break;
+		case 0x21: emu.col = emu.col1 = emu.args[0] & 0x7F; emu.col2 = emu.args[1] & 0x7F; break;
+		case 0x22: emu.page = emu.page1 = emu.args[0] & 0x07; emu.page2 = emu.args[1] & 0x07; break;
+		}
+		return;
+	}
+	if (Emu_Arg_Count(c) > 0)
+	{
+		emu.cmd = c;
+		emu.argc = Emu_Arg_Count(c);
+	}
+	else if (c >= 0x40 && c <= 0x7F)
+		emu.start = c & 0x3F;
+	else if (emu.mode == 2 && c >= 0xB0 && c <= 0xB7)
+		emu.page = c & 0x07;
+	else if (emu.mode == 2 && c <= 0x0F)
+		emu.col = (emu.col & 0xF0) | c;
+	else if (emu.mode == 2 && c >= 0x10 && c <= 0x17)
+		emu.col = (emu.col & 0x0F) | ((c & 0x07) << 4);
+}
+
+static void Emu_Data(uint8_t d)
+{
+	emu.ram[emu.page][emu.col] = d;
+	if (++emu.bytes % (emu.bytes_per_tick ? emu.bytes_per_tick : 1) == 0 && emu.bytes_per_tick)
+		bench_tick++;
+	if (emu.mode == 2)
+	{
+		emu.col = (emu.col + 1) & 0x7F;
+	}
+	else if (emu.mode == 0)
+	{
+		if (emu.col++ == emu.col2)
+		{
+			emu.col = emu.col1;
+			emu.page = (emu.page == emu.page2) ? emu.page1 : emu.page + 1;
+		}
+	}
+	else if (emu.page++ == emu.page2)
+	{
+		emu.page = emu.page1;
+		emu.col = (emu.col == emu.col2) ? emu.col1 : emu.col + 1;
+	}
+}
+
+static void Emu_Write(uint8_t reg_addr, uint8_t data)
+{
+	if (reg_addr == 0x40)
+		Emu_Data(data);
+	else
+		Emu_Command(data);
+}
+
+static void Emu_End(void)
+{
+	if (emu.hook)
+		emu.hook();
+}
+
+// 屏幕上第p页（8行）的显示内容
+static void Emu_Screen_Page(uint8_t p, uint8_t out[128])
+{
+	uint8_t x, b, row;
+
+	memset(out, 0, 128);
+	for (b = 0; b < 8; b++)
+	{
+		row = (p * 8 + b + emu.start) & 0x3F;
+		for (x = 0; x < 128; x++)
+			out[x] |= ((emu.ram[row / 8][x] >> (row % 8)) & 1) << b;
+	}
+}
+
+uint8_t OLED_HW_I2C_Write_Byte(uint8_t dev_addr, uint8_t reg_addr, uint8_t data)
+{
+	(void)dev_addr;
+	Emu_Write(reg_addr, data);
+	Emu_End();
+	return OLED_I2C_OK;
+}
+uint8_t OLED_HW_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data)
+{
+	(void)dev_addr;
+	while (len--)
+		Emu_Write(reg_addr, *data++);
+	Emu_End();
+	return OLED_I2C_OK;
+}
+uint8_t OLED_HW_I2C_Write_Window(uint8_t dev_addr, uint8_t reg_addr, uint32_t width, uint32_t rows,
+                                 uint32_t stride, const uint8_t *data)
+{
+	uint32_t r, x;
+
+	(void)dev_addr;
+	for (r = 0; r < rows; r++)
+		for (x = 0; x < width; x++)
+			Emu_Write(reg_addr, data[r * stride + x]);
+	Emu_End();
+	return OLED_I2C_OK;
+}
+
+#define ROUNDS 20000
+
+// 原逐点实现（字模/图片格式相同），作为对照
+static void Ref_Blit(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *src, uint8_t mode)
+{
+	uint8_t m, temp;
+	uint8_t x0 = x, y0 = y;
+	uint16_t j;
+
+	for (j = 0; j < (uint16_t)w * pages; j++)
+	{
+		temp = src[j];
+		for (m = 0; m < 8; m++)
+		{
+			if (temp & 0x01)
+				OLED_DrawPoint(x, y, mode);
+			else
+				OLED_DrawPoint(x, y, !mode);
+			temp >>= 1;
+			y++;
+		}
+		x++;
+		if ((uint8_t)(x - x0) == w)
+		{
+			x = x0;
+			y0 = y0 + 8;
+		}
+		y = y0;
+	}
+}
+
+static void Ref_Fill_Rect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t t)
+{
+	for (uint8_t x = x1; x <= x2; x++)
+		for (uint8_t y = y1; y <= y2; y++)
+			OLED_DrawPoint(x, y, t);
+}
+
+static double Now_Us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static uint8_t Check(const char *name, uint8_t ref[8][128])
+{
+	if (memcmp(ref, OLED_GRAM, sizeof(OLED_GRAM)) != 0)
+	{
+		printf("MISMATCH: %s\n", name);
+		return 1;
+	}
+	return 0;
+}
+
+// 切换动画核对：每次传输后屏幕必须是按起始行算出的滚动位置上旧/新画面的拼接，
+// 只允许新进入边缘那一页还显示旧画面（先移起始行、这一页还没写完）
+static uint8_t slide_old[8][128], slide_new[8][128];
+static uint8_t slide_dir, slide_k, slide_steps, slide_stale;
+static uint16_t slide_errors;
+
+static void Slide_Check(void)
+{
+	uint8_t screen[128];
+	uint8_t k, p, edge;
+	const uint8_t *want, *stale;
+
+	k = (slide_dir == OLED_SLIDE_UP) ? emu.start / 8 : (8 - emu.start / 8) & 7;
+	if (k < slide_k)
+		k = 8; // 起始行回到0：最后一页
+	if (k != slide_k)
+		slide_steps++;
+	slide_k = k;
+
+	edge = (slide_dir == OLED_SLIDE_UP) ? 7 : 0;
+	for (p = 0; p < 8; p++)
+	{
+		if (slide_dir == OLED_SLIDE_UP)
+		{
+			want = (p < 8 - k) ? slide_old[p + k] : slide_new[p + k - 8];
+			stale = (k > 0) ? slide_old[k - 1] : NULL;
+		}
+		else
+		{
+			want = (p < k) ? slide_new[p + 8 - k] : slide_old[p - k];
+			stale = (k > 0) ? slide_old[8 - k] : NULL;
+		}
+		Emu_Screen_Page(p, screen);
+		if (memcmp(screen, want, 128) == 0)
+			continue;
+		if (p == edge && stale && memcmp(screen, stale, 128) == 0)
+		{
+			slide_stale++;
+			continue;
+		}
+		slide_errors++;
+	}
+}
+
+// 旧画面在屏上时切换到新画面，逐次传输核对；running为0时走调度器未运行的一步到位路径
+static uint8_t Slide_Run(const char *name, uint8_t dir, uint16_t bytes_per_tick, uint8_t running)
+{
+	uint8_t p, x, fail;
+
+	for (p = 0; p < 8; p++)
+		for (x = 0; x < 128; x++)
+		{
+			slide_old[p][x] = (uint8_t)(x * 3 + p * 29 + 1);
+			slide_new[p][x] = (uint8_t)(x * 7 + p * 53 + 0x80);
+		}
+	memcpy(OLED_GRAM, slide_old, sizeof(slide_old));
+	OLED_Refresh();
+	if (memcmp(emu.ram, slide_old, sizeof(slide_old)) != 0 || emu.start != 0)
+	{
+		printf("MISMATCH: %s: old frame not on panel\n", name);
+		return 1;
+	}
+
+	memcpy(OLED_GRAM, slide_new, sizeof(slide_new));
+	OLED_Slide(dir);
+	slide_dir = dir;
+	slide_k = slide_steps = slide_stale = 0;
+	slide_errors = 0;
+	emu.bytes_per_tick = bytes_per_tick;
+	emu.hook = Slide_Check;
+	if (running)
+	{
+		bench_scheduler_state = taskSCHEDULER_RUNNING;
+		oled_display_handle = (TaskHandle_t)1;
+	}
+	OLED_Capture(); // 显示任务：取帧后发送
+	OLED_Transmit();
+	bench_scheduler_state = taskSCHEDULER_NOT_STARTED;
+	oled_display_handle = NULL;
+	emu.hook = NULL;
+	emu.bytes_per_tick = 0;
+
+	fail = slide_errors > 0 || slide_k != 8 || emu.start != 0 ||
+		   memcmp(emu.ram, slide_new, sizeof(slide_new)) != 0;
+	printf("%-26s %5u steps %4u stale-edge %4u bad\n", name, slide_steps, slide_stale, slide_errors);
+	if (fail)
+		printf("MISMATCH: %s\n", name);
+	return fail;
+}
+
+typedef struct
+{
+	const char *name;
+	uint8_t x, y, w, pages;
+	const uint8_t *src;
+	uint8_t mode;
+} bench_case_t;
+
+int main(void)
+{
+	static uint8_t icon[32 * 4];
+	static uint8_t ref[8][128];
+	uint8_t errors = 0;
+	double t0, t_ref, t_new;
+	uint32_t r, i;
+
+	for (i = 0; i < sizeof(icon); i++)
+		icon[i] = (uint8_t)(i * 37 + 11);
+
+	const bench_case_t cases[] = {
+		{"glyph 12x24 aligned", 8, 16, 12, 3, asc2_2412['A' - ' '], OLED_MODE_NORMAL},
+		{"glyph 12x24 y+3", 8, 19, 12, 3, asc2_2412['A' - ' '], OLED_MODE_NORMAL},
+		{"glyph 6x12 inverse y+5", 40, 5, 6, 2, asc2_1206['7' - ' '], OLED_MODE_INVERSE},
+		{"icon 32x32 aligned", 48, 0, 32, 4, icon, OLED_MODE_NORMAL},
+		{"icon 32x32 y+6", 48, 30, 32, 4, icon, OLED_MODE_NORMAL},
+		{"icon 32x32 x<0", (uint8_t)-20, 8, 32, 4, icon, OLED_MODE_NORMAL},
+	};
+
+	printf("%-26s %12s %12s %8s\n", "case", "pixel us", "blit us", "speedup");
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+	{
+		const bench_case_t *c = &cases[i];
+
+		memset(OLED_GRAM, 0x5A, sizeof(OLED_GRAM));
+		Ref_Blit(c->x, c->y, c->w, c->pages, c->src, c->mode);
+		memcpy(ref, OLED_GRAM, sizeof(ref));
+		memset(OLED_GRAM, 0x5A, sizeof(OLED_GRAM));
+		OLED_Blit(c->x, c->y, c->w, c->pages, c->src, c->mode);
+		errors += Check(c->name, ref);
+
+		t0 = Now_Us();
+		for (r = 0; r < ROUNDS; r++)
+			Ref_Blit(c->x, c->y, c->w, c->pages, c->src, c->mode);
+		t_ref = Now_Us() - t0;
+		t0 = Now_Us();
+		for (r = 0; r < ROUNDS; r++)
+			OLED_Blit(c->x, c->y, c->w, c->pages, c->src, c->mode);
+		t_new = Now_Us() - t0;
+		OLED_Dirty_Reset();
+
+		printf("%-26s %12.3f %12.3f %7.1fx\n", c->name, t_ref / ROUNDS, t_new / ROUNDS, t_ref / t_new);
+	}
+
+	// 矩形填充（OLED_Clear_Rect / 进度条）
+	memset(OLED_GRAM, 0xA5, sizeof(OLED_GRAM));
+	Ref_Fill_Rect(3, 5, 120, 40, 0);
+	memcpy(ref, OLED_GRAM, sizeof(ref));
+	memset(OLED_GRAM, 0xA5, sizeof(OLED_GRAM));
+	OLED_Fill_Rect(3, 5, 120, 40, 0);
+	errors += Check("fill rect", ref);
+
+	t0 = Now_Us();
+	for (r = 0; r < ROUNDS; r++)
+		Ref_Fill_Rect(3, 5, 120, 40, r & 1);
+	t_ref = Now_Us() - t0;
+	t0 = Now_Us();
+	for (r = 0; r < ROUNDS; r++)
+		OLED_Fill_Rect(3, 5, 120, 40, r & 1);
+	t_new = Now_Us() - t0;
+	printf("%-26s %12.3f %12.3f %7.1fx\n", "fill rect 118x36", t_ref / ROUNDS, t_new / ROUNDS, t_ref / t_new);
+
+	// 切换动画：按时间走的多帧、慢总线补写多页、调度器未运行一步到位
+	OLED_Init();
+	errors += Slide_Run("slide up", OLED_SLIDE_UP, 0, 1);
+	errors += Slide_Run("slide down", OLED_SLIDE_DOWN, 0, 1);
+	errors += Slide_Run("slide up slow bus", OLED_SLIDE_UP, 16, 1);
+	errors += Slide_Run("slide down slow bus", OLED_SLIDE_DOWN, 16, 1);
+	errors += Slide_Run("slide up no scheduler", OLED_SLIDE_UP, 0, 0);
+
+	printf(errors ? "FAILED: %u mismatches\n" : "all outputs identical\n", errors);
+	return errors ? 1 : 0;
+}
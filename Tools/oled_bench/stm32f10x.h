@@ -0,0 +1,11 @@
+/* 主机端基准测试用的最小替身：只提供OLED驱动编译需要的类型 */
+#ifndef __STM32F10x_H
+#define __STM32F10x_H
+
+#include <stdint.h>
+
+typedef uint32_t u32;
+typedef uint16_t u16;
+typedef uint8_t u8;
+
+#endif
@@ -6,6 +6,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include "debug.h"
+#include "cmd_router.h"
+#define LOG_FILE_ID 5
+#include "log.h"
 
 // HC-05状态变量
 static uint8_t hc05_connection_status = HC05_STATUS_DISCONNECTED;
@@ -23,7 +26,7 @@ uint8_t HC05_Init(uint32_t baudrate)
     // 延时等待模块启动
     Delay_ms(1000);
     
-    printf("HC-05 UART3 initialized at %d baud\r\n", baudrate);
+    LOG_I(HC05, "HC-05 UART3 initialized at %d baud\r\n", baudrate);
     
     // 初始化状态为未连接
     hc05_connection_status = HC05_STATUS_DISCONNECTED;
@@ -45,12 +48,12 @@ uint8_t HC05_Set_Slave_Mode(void)
     // 设置为从模式
     if(HC05_Send_AT_Cmd("AT+ROLE=0", "OK", 1000) == HC05_OK)
     {
-        printf("HC-05 set to slave mode successfully\r\n");
+        LOG_I(HC05, "HC-05 set to slave mode successfully\r\n");
         return HC05_OK;
     }
     else
     {
-        printf("Failed to set HC-05 to slave mode (may already be connected)\r\n");
+        LOG_W(HC05, "Failed to set HC-05 to slave mode (may already be connected)\r\n");
         return HC05_ERROR;
     }
 }
@@ -100,10 +103,10 @@ uint8_t HC05_Scan_Devices(char device_list[][32], uint8_t max_devices, uint16_t
         Delay_ms(100);
     }
     
-    printf("Bluetooth scan completed, found %d devices\r\n", device_count);
+    LOG_I(HC05, "Bluetooth scan completed, found %d devices\r\n", device_count);
     for(uint8_t i = 0; i < device_count; i++)
     {
-        printf("Device %d: %s\r\n", i+1, device_list[i]);
+        LOG_I(HC05, "Device %d: %s\r\n", i+1, device_list[i]);
     }
     
     return device_count;
@@ -146,10 +149,10 @@ uint8_t HC05_Get_Paired_Devices(char device_list[][32], uint8_t max_devices)
         }
     }
     
-    printf("Found %d paired devices\r\n", device_count);
+    LOG_I(HC05, "Found %d paired devices\r\n", device_count);
     for(uint8_t i = 0; i < device_count; i++)
     {
-        printf("Paired device %d: %s\r\n", i+1, device_list[i]);
+        LOG_I(HC05, "Paired device %d: %s\r\n", i+1, device_list[i]);
     }
     
     return device_count;
@@ -161,17 +164,17 @@ uint8_t HC05_Get_Paired_Devices(char device_list[][32], uint8_t max_devices)
  */
 uint8_t HC05_Clear_Paired_Devices(void)
 {
-    printf("Clearing all paired devices...\r\n");
+    LOG_I(HC05, "Clearing all paired devices...\r\n");
     
     // 发送清除配对指令
     if(HC05_Send_AT_Cmd("AT+RMAAD", "OK", 2000) == HC05_OK)
     {
-        printf("All paired devices cleared successfully\r\n");
+        LOG_I(HC05, "All paired devices cleared successfully\r\n");
         return HC05_OK;
     }
     else
     {
-        printf("Failed to clear paired devices\r\n");
+        LOG_E(HC05, "Failed to clear paired devices\r\n");
         return HC05_ERROR;
     }
 }
@@ -182,18 +185,18 @@ uint8_t HC05_Clear_Paired_Devices(void)
  */
 uint8_t HC05_Disconnect(void)
 {
-    printf("Disconnecting current Bluetooth connection...\r\n");
+    LOG_I(HC05, "Disconnecting current Bluetooth connection...\r\n");
     
     // 发送断开连接指令
     if(HC05_Send_AT_Cmd("AT+DISC", "OK", 2000) == HC05_OK)
     {
         hc05_connection_status = HC05_STATUS_DISCONNECTED;
-        printf("Bluetooth disconnected successfully\r\n");
+        LOG_I(HC05, "Bluetooth disconnected successfully\r\n");
         return HC05_OK;
     }
     else
     {
-        printf("Failed to disconnect Bluetooth\r\n");
+        LOG_E(HC05, "Failed to disconnect Bluetooth\r\n");
         return HC05_ERROR;
     }
 }
@@ -215,7 +218,7 @@ uint8_t HC05_Set_Connection_Timeout(uint8_t timeout_seconds)
     sprintf(cmd, "AT+CNCTO=%d", timeout_seconds);
     if(HC05_Send_AT_Cmd(cmd, "OK", 1000) == HC05_OK)
     {
-        printf("Connection timeout set to %d seconds\r\n", timeout_seconds);
+        LOG_I(HC05, "Connection timeout set to %d seconds\r\n", timeout_seconds);
         return HC05_OK;
     }
     
@@ -228,7 +231,7 @@ uint8_t HC05_Set_Connection_Timeout(uint8_t timeout_seconds)
  */
 uint8_t HC05_Get_Module_Info(void)
 {
-    printf("=== HC-05 Module Information ===\r\n");
+    LOG_I(HC05, "=== HC-05 Module Information ===\r\n");
     
     // 获取版本信息
     if(HC05_Send_AT_Cmd("AT+VERSION?", "+VERSION:", 1000) == HC05_OK)
@@ -239,7 +242,7 @@ uint8_t HC05_Get_Module_Info(void)
             char *version = strstr(buffer, "+VERSION:");
             if(version)
             {
-                printf("Version: %s\r\n", version + 9);
+                LOG_I(HC05, "Version: %s\r\n", version + 9);
             }
         }
     }
@@ -255,7 +258,7 @@ uint8_t HC05_Get_Module_Info(void)
             char *addr = strstr(buffer, "+ADDR:");
             if(addr)
             {
-                printf("Address: %s\r\n", addr + 6);
+                LOG_I(HC05, "Address: %s\r\n", addr + 6);
             }
         }
     }
@@ -271,13 +274,11 @@ uint8_t HC05_Get_Module_Info(void)
             char *role = strstr(buffer, "+ROLE:");
             if(role)
             {
-                uint8_t role_num = atoi(role + 6);
-                printf("Role: %s\r\n", role_num == 0 ? "Slave" : "Master");
+                LOG_I(HC05, "Role: %s\r\n", atoi(role + 6) == 0 ? "Slave" : "Master");
             }
         }
     }
     
-    printf("================================\r\n");
     return HC05_OK;
 }
 
@@ -291,12 +292,12 @@ uint8_t HC05_Set_Master_Mode(void)
     // 设置为主模式
     if(HC05_Send_AT_Cmd("AT+ROLE=1", "OK", 1000) == HC05_OK)
     {
-        printf("HC-05 set to master mode successfully\r\n");
+        LOG_I(HC05, "HC-05 set to master mode successfully\r\n");
         return HC05_OK;
     }
     else
     {
-        printf("Failed to set HC-05 to master mode\r\n");
+        LOG_E(HC05, "Failed to set HC-05 to master mode\r\n");
         return HC05_ERROR;
     }
 }
@@ -320,7 +321,7 @@ uint8_t HC05_Send_AT_Cmd(const char *cmd, const char *wait_string, uint16_t time
     
     // 发送AT指令
     len = strlen(cmd);
-    printf("Sending AT command: %s\r\n", cmd);
+    LOG_D(HC05, "Sending AT command: %s\r\n", cmd);
     UART3_SendDataToBLE_Poll((uint8_t*)cmd, len);
     UART3_SendDataToBLE_Poll((uint8_t*)"\r\n", 2);
     
@@ -331,7 +332,7 @@ uint8_t HC05_Send_AT_Cmd(const char *cmd, const char *wait_string, uint16_t time
         if(uart3_rx_len > 0)
         {
             response = (char*)uart3_buffer;
-            printf("HC-05 response: %s\r\n", response);
+            LOG_D(HC05, "HC-05 response: %s\r\n", response);
             if(strstr(response, wait_string) != NULL)
             {
                 return HC05_OK;
@@ -345,7 +346,7 @@ uint8_t HC05_Send_AT_Cmd(const char *cmd, const char *wait_string, uint16_t time
         Delay_ms(10);
     }
     
-    printf("AT command timeout after %dms\r\n", timeout);
+    LOG_W(HC05, "AT command timeout after %dms\r\n", timeout);
     return HC05_ERROR;
 }
 
@@ -365,12 +366,12 @@ uint8_t HC05_Set_Name(char *name)
     sprintf(cmd, "AT+NAME=%s", name);
     if(HC05_Send_AT_Cmd(cmd, "OK", 1000) == HC05_OK)
     {
-        printf("Bluetooth name set successfully to: %s\r\n", name);
+        LOG_I(HC05, "Bluetooth name set successfully to: %s\r\n", name);
         return HC05_OK;
     }
     else
     {
-        printf("Failed to set Bluetooth name\r\n");
+        LOG_E(HC05, "Failed to set Bluetooth name\r\n");
         return HC05_ERROR;
     }
 }
@@ -391,12 +392,12 @@ uint8_t HC05_Set_PIN(char *pin)
     sprintf(cmd, "AT+PSWD=%s", pin);
     if(HC05_Send_AT_Cmd(cmd, "OK", 1000) == HC05_OK)
     {
-        printf("Bluetooth PIN set successfully to: %s\r\n", pin);
+        LOG_I(HC05, "Bluetooth PIN set successfully to: %s\r\n", pin);
         return HC05_OK;
     }
     else
     {
-        printf("Failed to set Bluetooth PIN\r\n");
+        LOG_E(HC05, "Failed to set Bluetooth PIN\r\n");
         return HC05_ERROR;
     }
 }
@@ -527,95 +528,15 @@ void HC05_Receive_Start(void)
 }
 
 /**
- * @brief  HC-05解析命令
- * @param  buffer: 接收缓冲区
- * @param  topic: 命令主题
- * @param  msg_value: 消息值
- * @retval HC05_OK: 成功, HC05_ERROR: 失败
- */
-uint8_t HC05_Parse_Command(const char *buffer, const char *topic, char *msg_value)
-{
-    char *start;
-    char *end;
-    int len;
-    
-    // 查找主题
-    start = strstr(buffer, topic);
-    if(start == NULL)
-    {
-        return HC05_ERROR;
-    }
-    
-    // 移动到值部分
-    start = strchr(start, ':');
-    if(start == NULL)
-    {
-        return HC05_ERROR;
-    }
-    start++; // 跳过':'
-    
-    // 查找结束符
-    end = strchr(start, '\n');
-    if(end == NULL)
-    {
-        end = strchr(start, '\r');
-        if(end == NULL)
-        {
-            return HC05_ERROR;
-        }
-    }
-    
-    // 提取值
-    len = end - start;
-    strncpy(msg_value, start, len);
-    msg_value[len] = '\0';
-    
-    return HC05_OK;
-}
-
-/**
- * @brief  HC-05处理命令
+ * @brief  HC-05处理命令（USART3适配层，命令表见cmd_table.c）
  * @param  buffer: 接收缓冲区
  * @retval HC05_OK: 成功, HC05_ERROR: 失败
  */
 uint8_t HC05_Process_Commands(const char *buffer)
 {
-  
-    // 解析命令
-    char msg_value[64];
-    
-    //接收light:get回复数据
-    if(HC05_Parse_Command(buffer, "light", msg_value) == HC05_OK)
-    { 
-        if (strcmp("get",msg_value)==0)
-        {
-            printf("light: %d\r\n",SensorData.light_data.lux);
-            // 只调用一次uart3_printf
-            uart3_printf("light: %d\r\n",SensorData.light_data.lux);
-            return HC05_OK;  // 添加返回成功标志
-        }
-        if (strcmp("OFF",msg_value)==0||strcmp("off",msg_value)==0)
-        {
-            Light_ON = 0;
-            uart3_printf("light: OFF\r\n");
-            printf("light: OFF\r\n");
-            return HC05_OK;
-        }
-        if (strcmp("ON",msg_value)==0||strcmp("on",msg_value)==0)
-        {
-            Light_ON = 1;
-            uart3_printf("light: ON\r\n");
-            printf("light: ON\r\n");
-            return HC05_OK;
-        }
-        
-        
+    if (Cmd_Process_Text(buffer, CMD_SRC_BLE) == CMD_OK)
+    {
+        return HC05_OK;
     }
-
-    
-   
-    
-    // 解析其他命令...
-    
     return HC05_ERROR;
 }
@@ -37,7 +37,6 @@ uint8_t HC05_Check_Connection(void);
 void HC05_Receive_Start(void);
 
 // HC-05数据处理函数
-uint8_t HC05_Parse_Command(const char *buffer, const char *topic, char *msg_value);
 uint8_t HC05_Process_Commands(const char *buffer);
 
 #endif
@@ -0,0 +1,322 @@
+/**
+ * @file cmd_router.c
+ * @brief 统一命令路由：所有串口的命令都经同一张表查找、同一套参数解析
+ * @version 0.1
+ * @date 2025-12-21
+ */
+#include "cmd_router.h"
+#include "uart3.h"
+#include "debug.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+/**
+ * @brief  不区分大小写的字符串比较
+ * @retval 1-相等，0-不等
+ */
+static uint8_t Cmd_Str_Equal(const char *a, const char *b)
+{
+    while (*a != '\0' && *b != '\0')
+    {
+        char ca = (*a >= 'A' && *a <= 'Z') ? (*a + 32) : *a;
+        char cb = (*b >= 'A' && *b <= 'Z') ? (*b + 32) : *b;
+        if (ca != cb)
+        {
+            return 0;
+        }
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/**
+ * @brief  按命令名查找
+ * @param  name: 命令名
+ * @retval 命令表项，NULL表示未找到
+ */
+const cmd_entry_t *Cmd_Find(const char *name)
+{
+    for (uint8_t i = 0; i < cmd_table_size; i++)
+    {
+        if (Cmd_Str_Equal(cmd_table[i].name, name))
+        {
+            return &cmd_table[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  按巴法云主题查找
+ * @param  topic: 主题
+ * @retval 命令表项，NULL表示未找到
+ */
+const cmd_entry_t *Cmd_Find_Topic(const char *topic)
+{
+    for (uint8_t i = 0; i < cmd_table_size; i++)
+    {
+        if (cmd_table[i].topic != NULL && strcmp(cmd_table[i].topic, topic) == 0)
+        {
+            return &cmd_table[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  按命令的参数模式解析参数
+ * @param  cmd: 命令表项
+ * @param  text: 参数文本，NULL或空串表示无参数
+ * @param  arg: 解析结果
+ * @retval CMD_OK: 成功, CMD_ERROR: 参数不符合模式
+ */
+uint8_t Cmd_Parse_Arg(const cmd_entry_t *cmd, const char *text, cmd_arg_t *arg)
+{
+    arg->kind = 0;
+    arg->value = 0;
+
+    if (text == NULL || text[0] == '\0' || Cmd_Str_Equal(text, "get"))
+    {
+        if (cmd->arg_mask & CMD_ARG_GET)
+        {
+            arg->kind = CMD_ARG_GET;
+            return CMD_OK;
+        }
+        return CMD_ERROR;
+    }
+
+    if (cmd->arg_mask & CMD_ARG_ONOFF)
+    {
+        if (Cmd_Str_Equal(text, "on"))
+        {
+            arg->kind = CMD_ARG_ONOFF;
+            arg->value = 1;
+            return CMD_OK;
+        }
+        if (Cmd_Str_Equal(text, "off"))
+        {
+            arg->kind = CMD_ARG_ONOFF;
+            arg->value = 0;
+            return CMD_OK;
+        }
+    }
+
+    if (cmd->arg_mask & CMD_ARG_UINT)
+    {
+        char *end;
+        unsigned long value = strtoul(text, &end, 10);
+        if (end != text && *end == '\0' && value >= cmd->arg_min && value <= cmd->arg_max)
+        {
+            arg->kind = CMD_ARG_UINT;
+            arg->value = value;
+            return CMD_OK;
+        }
+    }
+
+    return CMD_ERROR;
+}
+
+/**
+ * @brief  解析参数并执行命令
+ * @param  cmd: 命令表项
+ * @param  arg_text: 参数文本
+ * @param  reply: 回复缓冲（可为NULL）
+ * @param  size: 回复缓冲大小
+ * @retval CMD_OK: 成功, CMD_ERROR: 参数错误或执行失败
+ */
+uint8_t Cmd_Execute(const cmd_entry_t *cmd, const char *arg_text, char *reply, uint16_t size)
+{
+    cmd_arg_t arg;
+
+    if (reply != NULL && size > 0)
+    {
+        reply[0] = '\0';
+    }
+    if (cmd == NULL || Cmd_Parse_Arg(cmd, arg_text, &arg) != CMD_OK)
+    {
+        return CMD_ERROR;
+    }
+    if (cmd->handler != NULL && cmd->handler(&arg) != CMD_OK)
+    {
+        return CMD_ERROR;
+    }
+    if (reply != NULL && size > 0 && cmd->encode != NULL)
+    {
+        cmd->encode(reply, size, &arg);
+    }
+    return CMD_OK;
+}
+
+/**
+ * @brief  把回复送回命令来源
+ */
+static void Cmd_Reply(cmd_source_t src, const char *reply)
+{
+    if (reply[0] == '\0')
+    {
+        return;
+    }
+    if (src == CMD_SRC_BLE)
+    {
+        uart3_printf("%s\r\n", reply);
+    }
+    printf("%s\r\n", reply);
+}
+
+/**
+ * @brief  处理一行文本命令（蓝牙/调试串口）："name:arg"、"name arg" 或 "name"
+ * @param  line: 命令行（可带\r\n）
+ * @param  src: 命令来源
+ * @retval CMD_OK: 成功, CMD_ERROR: 未知命令或参数错误
+ */
+uint8_t Cmd_Process_Line(const char *line, cmd_source_t src)
+{
+    char name[CMD_NAME_LEN];
+    char arg[CMD_ARG_LEN];
+    char reply[CMD_REPLY_LEN];
+    const cmd_entry_t *cmd;
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    while (*line == ' ')
+    {
+        line++;
+    }
+    while (*line != '\0' && *line != ':' && *line != ' ' && *line != '\r' && *line != '\n' &&
+           i < CMD_NAME_LEN - 1)
+    {
+        name[i++] = *line++;
+    }
+    name[i] = '\0';
+    if (i == 0)
+    {
+        return CMD_ERROR;
+    }
+
+    if (*line == ':' || *line == ' ')
+    {
+        line++;
+        while (*line == ' ')
+        {
+            line++;
+        }
+        while (*line != '\0' && *line != '\r' && *line != '\n' && j < CMD_ARG_LEN - 1)
+        {
+            arg[j++] = *line++;
+        }
+    }
+    while (j > 0 && arg[j - 1] == ' ')
+    {
+        j--;
+    }
+    arg[j] = '\0';
+
+    cmd = Cmd_Find(name);
+    if (cmd == NULL)
+    {
+        snprintf(reply, sizeof(reply), "unknown command: %s", name);
+        Cmd_Reply(src, reply);
+        return CMD_ERROR;
+    }
+
+    if (Cmd_Execute(cmd, arg, reply, sizeof(reply)) != CMD_OK)
+    {
+        snprintf(reply, sizeof(reply), "%s: bad argument '%s'", name, arg);
+        Cmd_Reply(src, reply);
+        return CMD_ERROR;
+    }
+    Cmd_Reply(src, reply);
+    return CMD_OK;
+}
+
+/**
+ * @brief  逐行处理一段文本（一次IDLE可能收到多行）
+ * @param  buffer: 以'\0'结尾的文本
+ * @param  src: 命令来源
+ * @retval CMD_OK: 至少一行执行成功, CMD_ERROR: 无有效命令
+ */
+uint8_t Cmd_Process_Text(const char *buffer, cmd_source_t src)
+{
+    uint8_t result = CMD_ERROR;
+    const char *p = buffer;
+
+    while (*p != '\0')
+    {
+        if (*p != '\r' && *p != '\n')
+        {
+            if (Cmd_Process_Line(p, src) == CMD_OK)
+            {
+                result = CMD_OK;
+            }
+            while (*p != '\0' && *p != '\r' && *p != '\n')
+            {
+                p++;
+            }
+        }
+        else
+        {
+            p++;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief  从巴法云报文中取出 key= 对应的值
+ */
+static uint8_t Cmd_Bemfa_Field(const char *buffer, const char *key, char *value, uint8_t size)
+{
+    const char *start = strstr(buffer, key);
+    uint8_t i = 0;
+
+    if (start == NULL)
+    {
+        return CMD_ERROR;
+    }
+    start += strlen(key);
+    while (start[i] != '\0' && start[i] != '&' && start[i] != '\r' && start[i] != '\n' &&
+           i < size - 1)
+    {
+        value[i] = start[i];
+        i++;
+    }
+    value[i] = '\0';
+    return CMD_OK;
+}
+
+/**
+ * @brief  处理巴法云下发报文：topic映射到命令，msg作为参数
+ * @param  buffer: ESP8266收到的数据
+ * @retval CMD_OK: 成功, CMD_ERROR: 非命令主题或参数错误
+ */
+uint8_t Cmd_Process_Bemfa(const char *buffer)
+{
+    char topic[CMD_NAME_LEN];
+    char msg[CMD_ARG_LEN];
+    char reply[CMD_REPLY_LEN];
+    const cmd_entry_t *cmd;
+
+    if (buffer == NULL ||
+        Cmd_Bemfa_Field(buffer, "topic=", topic, sizeof(topic)) != CMD_OK ||
+        Cmd_Bemfa_Field(buffer, "msg=", msg, sizeof(msg)) != CMD_OK)
+    {
+        return CMD_ERROR;
+    }
+
+    cmd = Cmd_Find_Topic(topic);
+    if (cmd == NULL)
+    {
+        return CMD_ERROR;
+    }
+
+    if (Cmd_Execute(cmd, msg, reply, sizeof(reply)) != CMD_OK)
+    {
+        snprintf(reply, sizeof(reply), "%s: bad argument '%s'", topic, msg);
+        Cmd_Reply(CMD_SRC_WIFI, reply);
+        return CMD_ERROR;
+    }
+    Cmd_Reply(CMD_SRC_WIFI, reply);
+    return CMD_OK;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file cmd_router.h
+ * @brief 统一命令路由：命令表（名称、参数模式、处理函数、回复编码）+ 各串口的薄适配层
+ * @version 0.1
+ * @date 2025-12-21
+ *
+ * 蓝牙/调试串口：  light:on   light on   light:get   light
+ * 巴法云下发：     cmd=2&uid=...&topic=myLUX004&msg=on  （主题别名映射到命令）
+ */
+#ifndef __CMD_ROUTER_H
+#define __CMD_ROUTER_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+// 命令路由返回值
+#define CMD_OK          0
+#define CMD_ERROR       1
+
+#define CMD_NAME_LEN    16
+#define CMD_ARG_LEN     32
+#define CMD_REPLY_LEN   48
+
+// 参数模式（位掩码，一条命令可接受多种）
+#define CMD_ARG_GET     0x01 // 无参数或"get"：查询
+#define CMD_ARG_ONOFF   0x02 // on/off（不区分大小写）
+#define CMD_ARG_UINT    0x04 // 无符号整数，范围[arg_min, arg_max]
+
+// 命令来源
+typedef enum
+{
+    CMD_SRC_DEBUG = 0, // USART1 调试串口
+    CMD_SRC_WIFI,      // USART2 ESP8266/巴法云
+    CMD_SRC_BLE        // USART3 HC-05
+} cmd_source_t;
+
+// 解析后的参数
+typedef struct
+{
+    uint8_t  kind;  // CMD_ARG_GET / CMD_ARG_ONOFF / CMD_ARG_UINT
+    uint32_t value; // on=1/off=0 或整数值
+} cmd_arg_t;
+
+typedef struct
+{
+    const char *name;   // 命令名
+    const char *topic;  // 巴法云主题别名，NULL表示不接受云端下发
+    uint8_t  arg_mask;  // 接受的参数模式
+    uint32_t arg_min;   // CMD_ARG_UINT 下限
+    uint32_t arg_max;   // CMD_ARG_UINT 上限
+
+    // 处理函数：执行命令，返回CMD_OK/CMD_ERROR
+    uint8_t (*handler)(const cmd_arg_t *arg);
+    // 回复编码：把执行结果写入buf，返回长度（0表示无回复）
+    int (*encode)(char *buf, uint16_t size, const cmd_arg_t *arg);
+} cmd_entry_t;
+
+// 命令表（cmd_table.c）
+extern const cmd_entry_t cmd_table[];
+extern const uint8_t cmd_table_size;
+
+// 路由核心
+const cmd_entry_t *Cmd_Find(const char *name);
+const cmd_entry_t *Cmd_Find_Topic(const char *topic);
+uint8_t Cmd_Parse_Arg(const cmd_entry_t *cmd, const char *text, cmd_arg_t *arg);
+uint8_t Cmd_Execute(const cmd_entry_t *cmd, const char *arg_text, char *reply, uint16_t size);
+
+// 传输适配
+uint8_t Cmd_Process_Line(const char *line, cmd_source_t src);
+uint8_t Cmd_Process_Text(const char *buffer, cmd_source_t src);
+uint8_t Cmd_Process_Bemfa(const char *buffer);
+
+#endif
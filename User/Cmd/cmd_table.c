@@ -0,0 +1,42 @@
+/**
+ * @file cmd_table.c
+ * @brief 命令表：新增命令只需在此添加处理函数、回复编码和一个表项
+ * @version 0.1
+ * @date 2025-12-21
+ */
+#include "cmd_router.h"
+#include "sensordata.h"
+#include <stdio.h>
+
+// ==================================
+// light：查询照度 / 开关光照传感器
+// ==================================
+
+static uint8_t Cmd_Light_Handler(const cmd_arg_t *arg)
+{
+    if (arg->kind == CMD_ARG_ONOFF)
+    {
+        Light_ON = (uint8_t)arg->value;
+    }
+    return CMD_OK;
+}
+
+static int Cmd_Light_Encode(char *buf, uint16_t size, const cmd_arg_t *arg)
+{
+    if (arg->kind == CMD_ARG_GET)
+    {
+        return snprintf(buf, size, "light: %d", SensorData.light_data.lux);
+    }
+    return snprintf(buf, size, "light: %s", Light_ON ? "ON" : "OFF");
+}
+
+// ==================================
+// 命令表
+// ==================================
+
+const cmd_entry_t cmd_table[] = {
+    // name     topic       参数模式                        min max  处理函数            回复编码
+    {"light", "myLUX004", CMD_ARG_GET | CMD_ARG_ONOFF, 0, 0, Cmd_Light_Handler, Cmd_Light_Encode},
+};
+
+const uint8_t cmd_table_size = sizeof(cmd_table) / sizeof(cmd_table[0]);
@@ -0,0 +1,540 @@
+/**
+ * @file console.c
+ * @brief USART1诊断控制台：中断只负责按行收集，命令在低优先级任务中执行
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * 输出直接写日志缓冲（不加时间戳），大段输出时等待缓冲排空，不会挤掉业务日志。
+ */
+#include "console.h"
+#include "debug.h"
+#include "log.h"
+#include "perf_counter.h"
+#include "cmd_router.h"
+#include "soft_i2c.h"
+#include "oled.h"
+#include "oled_draw.h"
+#include "uart2.h"
+#include "uart3.h"
+#include "esp8266.h"
+#include "sensordata.h"
+#include "gateway.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+#define CONSOLE_LINE_MAX    96
+#define CONSOLE_ARGC_MAX    4
+#define CONSOLE_MSP_FILL    0xA5A5A5A5UL
+
+extern uint32_t __initial_sp; // 启动文件导出的主栈(MSP)栈顶
+
+typedef struct
+{
+    const char *name;
+    const char *help;
+    void (*handler)(uint8_t argc, char *argv[]);
+} console_cmd_t;
+
+// 可在线修改的参数
+typedef struct
+{
+    const char *name;
+    uint16_t *value;
+    uint16_t min;
+    uint16_t max;
+    const char *unit;
+} console_param_t;
+
+static const console_param_t console_params[] = {
+    {"publish_delaytime", &publish_delaytime, 5, 60, "s"},
+    {"Sensordata_delaytime", &Sensordata_delaytime, 1000, 10000, "ms"},
+};
+#define CONSOLE_PARAM_COUNT (sizeof(console_params) / sizeof(console_params[0]))
+
+static TaskHandle_t console_handle = NULL;
+
+// top命令的上一次快照（按任务编号对应）
+static UBaseType_t console_prev_num[CONSOLE_MAX_TASKS];
+static uint32_t console_prev_time[CONSOLE_MAX_TASKS];
+static uint8_t console_prev_count = 0;
+static uint32_t console_prev_total = 0;
+
+/**
+ * @brief  控制台输出（不加时间戳），缓冲过半时先让日志任务发送
+ */
+static void Console_Printf(const char *format, ...)
+{
+    char line[CONSOLE_LINE_MAX];
+    va_list args;
+    int n;
+
+    while (Log_Pending() > LOG_RING_SIZE / 2)
+    {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+
+    va_start(args, format);
+    n = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (n <= 0)
+    {
+        return;
+    }
+    if (n > (int)sizeof(line) - 1)
+    {
+        n = sizeof(line) - 1;
+    }
+    Log_Write(line, (uint16_t)n);
+}
+
+/**
+ * @brief  不区分大小写的字符串比较
+ * @retval 1-相等，0-不等
+ */
+static uint8_t Console_Str_Equal(const char *a, const char *b)
+{
+    while (*a != '\0' && *b != '\0')
+    {
+        char ca = (*a >= 'A' && *a <= 'Z') ? (*a + 32) : *a;
+        char cb = (*b >= 'A' && *b <= 'Z') ? (*b + 32) : *b;
+        if (ca != cb)
+        {
+            return 0;
+        }
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/**
+ * @brief  取所有任务状态快照（调用者负责vPortFree）
+ */
+static TaskStatus_t *Console_Snapshot(UBaseType_t *count, uint32_t *total)
+{
+    UBaseType_t n = uxTaskGetNumberOfTasks();
+    TaskStatus_t *list = (TaskStatus_t *)pvPortMalloc(n * sizeof(TaskStatus_t));
+
+    if (list == NULL)
+    {
+        Console_Printf("no memory for %u tasks\r\n", (unsigned)n);
+        return NULL;
+    }
+    *count = uxTaskGetSystemState(list, n, total);
+    return list;
+}
+
+static void Console_Cmd_Tasks(uint8_t argc, char *argv[])
+{
+    static const char state_char[] = "*RBSD?"; // 运行 就绪 阻塞 挂起 删除 无效
+    TaskStatus_t *list;
+    UBaseType_t count;
+    uint32_t total;
+
+    list = Console_Snapshot(&count, &total);
+    if (list == NULL)
+    {
+        return;
+    }
+    Console_Printf("%-10s St Pri  Free  Num\r\n", "Task");
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        uint8_t st = list[i].eCurrentState <= eInvalid ? list[i].eCurrentState : eInvalid;
+        Console_Printf("%-10s %c  %2u  %4u  %3u\r\n",
+                       list[i].pcTaskName, state_char[st],
+                       (unsigned)list[i].uxCurrentPriority,
+                       (unsigned)list[i].usStackHighWaterMark,
+                       (unsigned)list[i].xTaskNumber);
+    }
+    vPortFree(list);
+}
+
+static void Console_Cmd_Top(uint8_t argc, char *argv[])
+{
+    TaskStatus_t *list;
+    UBaseType_t count;
+    uint32_t total;
+    uint32_t span;
+
+    list = Console_Snapshot(&count, &total);
+    if (list == NULL)
+    {
+        return;
+    }
+
+    span = total - console_prev_total;
+    if (span == 0)
+    {
+        span = 1;
+    }
+    Console_Printf("%-10s  CPU%%  (%lu ms window)\r\n", "Task",
+                   (unsigned long)((uint64_t)span * 1000 / (SystemCoreClock >> PERF_RUN_TIME_SHIFT)));
+
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        uint32_t used = list[i].ulRunTimeCounter;
+        uint32_t permille;
+
+        for (uint8_t j = 0; j < console_prev_count; j++)
+        {
+            if (console_prev_num[j] == list[i].xTaskNumber)
+            {
+                used -= console_prev_time[j];
+                break;
+            }
+        }
+        permille = (uint32_t)((uint64_t)used * 1000 / span);
+        Console_Printf("%-10s %3lu.%lu\r\n", list[i].pcTaskName,
+                       (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+    }
+
+    // 保存本次快照作为下次的区间起点
+    console_prev_count = 0;
+    for (UBaseType_t i = 0; i < count && console_prev_count < CONSOLE_MAX_TASKS; i++)
+    {
+        console_prev_num[console_prev_count] = list[i].xTaskNumber;
+        console_prev_time[console_prev_count] = list[i].ulRunTimeCounter;
+        console_prev_count++;
+    }
+    console_prev_total = total;
+    vPortFree(list);
+}
+
+/**
+ * @brief  主栈(MSP)未用部分填充标记，heap命令据此统计中断栈最深用量
+ * @note   调度器启动后MSP只被中断使用，在任务中关中断填充当前栈顶以下的部分
+ */
+static void Console_Paint_MSP(void)
+{
+    uint32_t *p = (uint32_t *)((uint32_t)&__initial_sp - CONSOLE_MSP_SIZE);
+    uint32_t *limit;
+    uint32_t primask;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    limit = (uint32_t *)(__get_MSP() - 64); // 当前中断栈位置以下留出余量
+    while (p < limit)
+    {
+        *p++ = CONSOLE_MSP_FILL;
+    }
+    __set_PRIMASK(primask);
+}
+
+static uint32_t Console_MSP_Free(void)
+{
+    const uint32_t *p = (const uint32_t *)((uint32_t)&__initial_sp - CONSOLE_MSP_SIZE);
+    const uint32_t *top = (const uint32_t *)&__initial_sp;
+    uint32_t free_bytes = 0;
+
+    while (p < top && *p == CONSOLE_MSP_FILL)
+    {
+        p++;
+        free_bytes += 4;
+    }
+    return free_bytes;
+}
+
+static void Console_Cmd_Heap(uint8_t argc, char *argv[])
+{
+    Console_Printf("heap: free %u, min ever %u, total %u bytes\r\n",
+                   (unsigned)xPortGetFreeHeapSize(),
+                   (unsigned)xPortGetMinimumEverFreeHeapSize(),
+                   (unsigned)configTOTAL_HEAP_SIZE);
+    Console_Printf("msp : free %lu of %u bytes\r\n",
+                   (unsigned long)Console_MSP_Free(), (unsigned)CONSOLE_MSP_SIZE);
+}
+
+static void Console_Cmd_Link(uint8_t argc, char *argv[])
+{
+    Console_Printf("wifi %s, server %s\r\n",
+                   wifi_connected ? "up" : "down", Server_connected ? "up" : "down");
+    Console_Printf("publish ok %lu fail %lu, heartbeat %lu, rx %lu\r\n",
+                   (unsigned long)esp8266_link_stats.publish_ok,
+                   (unsigned long)esp8266_link_stats.publish_fail,
+                   (unsigned long)esp8266_link_stats.heartbeats,
+                   (unsigned long)esp8266_link_stats.rx_msgs);
+    Console_Printf("ble frames %lu\r\n", (unsigned long)uart3_rx_frames);
+#if GATEWAY_ENABLE
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        gateway_node_t *node = Gateway_Get_Node(i);
+        if (node == NULL)
+        {
+            continue;
+        }
+        Console_Printf("node %u %s rx %u err %u lost %u, seen %lu ms ago\r\n",
+                       node->id, node->topic, node->rx_frames, node->rx_errors, node->lost_frames,
+                       (unsigned long)(xTaskGetTickCount() - node->last_seen));
+    }
+#else
+    Console_Printf("gateway node id %u\r\n", Gateway_Node_Id());
+#endif
+}
+
+#if GATEWAY_ENABLE
+static void Console_Cmd_Node(uint8_t argc, char *argv[])
+{
+    char *end;
+    unsigned long id;
+
+    if (argc < 2)
+    {
+        Console_Printf("usage: node <id> [hc05 addr]\r\n");
+        return;
+    }
+    id = strtoul(argv[1], &end, 10);
+    if (*end != '\0' || id > 255 ||
+        Gateway_Add_Node((uint8_t)id, argc >= 3 ? argv[2] : NULL) != GATEWAY_OK)
+    {
+        Console_Printf("node: cannot register %s\r\n", argv[1]);
+        return;
+    }
+    Console_Printf("node %lu %s\r\n", id, argc >= 3 ? argv[2] : "(auto bind)");
+}
+#endif
+
+static void Console_Cmd_Err(uint8_t argc, char *argv[])
+{
+    log_stats_t stats;
+
+    Log_Get_Stats(&stats);
+    Console_Printf("i2c   nack %u\r\n", soft_i2c_nack_count);
+#if OLED_USE_HW_I2C
+    Console_Printf("i2c1  oled err %u\r\n", oled_i2c_error_count);
+#endif
+    Console_Printf("oled  draw dropped %u\r\n", oled_draw_dropped);
+    Console_Printf("uart1 err %u drop %u\r\n", uart1_rx_errors, uart1_rx_overruns);
+    Console_Printf("uart2 frames %lu err %u overrun %u\r\n",
+                   (unsigned long)uart2_rx_frames, uart2_rx_errors, uart2_rx_overruns);
+    Console_Printf("uart3 frames %lu err %u overrun %u\r\n",
+                   (unsigned long)uart3_rx_frames, uart3_rx_errors, uart3_rx_overruns);
+    Console_Printf("log   written %lu sent %lu dropped %lu peak %u\r\n",
+                   (unsigned long)stats.written, (unsigned long)stats.sent,
+                   (unsigned long)stats.dropped, stats.high_water);
+}
+
+#if !OLED_USE_HW_I2C
+static void Console_Cmd_I2c_Bench(uint8_t argc, char *argv[])
+{
+    // 测量期间挂起调度器，避免OLED刷新任务同时操作总线
+    vTaskSuspendAll();
+    Soft_I2C_Benchmark(0x3c);
+    xTaskResumeAll();
+}
+#endif
+
+static const console_param_t *Console_Find_Param(const char *name)
+{
+    for (uint8_t i = 0; i < CONSOLE_PARAM_COUNT; i++)
+    {
+        if (Console_Str_Equal(console_params[i].name, name))
+        {
+            return &console_params[i];
+        }
+    }
+    Console_Printf("unknown param: %s\r\n", name);
+    return NULL;
+}
+
+static void Console_Cmd_Get(uint8_t argc, char *argv[])
+{
+    const console_param_t *param;
+
+    if (argc < 2)
+    {
+        for (uint8_t i = 0; i < CONSOLE_PARAM_COUNT; i++)
+        {
+            Console_Printf("%s = %u %s [%u..%u]\r\n", console_params[i].name, *console_params[i].value,
+                           console_params[i].unit, console_params[i].min, console_params[i].max);
+        }
+        return;
+    }
+    param = Console_Find_Param(argv[1]);
+    if (param != NULL)
+    {
+        Console_Printf("%s = %u %s\r\n", param->name, *param->value, param->unit);
+    }
+}
+
+static void Console_Cmd_Set(uint8_t argc, char *argv[])
+{
+    const console_param_t *param;
+    char *end;
+    unsigned long value;
+
+    if (argc < 3)
+    {
+        Console_Printf("usage: set <param> <value>\r\n");
+        return;
+    }
+    param = Console_Find_Param(argv[1]);
+    if (param == NULL)
+    {
+        return;
+    }
+    value = strtoul(argv[2], &end, 10);
+    if (*end != '\0' || value < param->min || value > param->max)
+    {
+        Console_Printf("%s: value must be %u..%u\r\n", param->name, param->min, param->max);
+        return;
+    }
+    taskENTER_CRITICAL();
+    *param->value = (uint16_t)value;
+    taskEXIT_CRITICAL();
+    Console_Printf("%s = %u %s\r\n", param->name, *param->value, param->unit);
+}
+
+static void Console_Cmd_Log(uint8_t argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        for (uint8_t i = 0; i < LOG_MOD_COUNT; i++)
+        {
+            Console_Printf("%-8s %u\r\n", Log_Module_Name(i), Log_Get_Level(Log_Module_Name(i)));
+        }
+        return;
+    }
+    if (argc >= 3 && Log_Set_Level(argv[1], (uint8_t)atoi(argv[2])) != 0)
+    {
+        Console_Printf("unknown module: %s\r\n", argv[1]);
+        return;
+    }
+    if (argv[1][0] != '*')
+    {
+        uint8_t level = Log_Get_Level(argv[1]);
+        if (level == 0xFF)
+        {
+            Console_Printf("unknown module: %s\r\n", argv[1]);
+            return;
+        }
+        Console_Printf("%s %u\r\n", argv[1], level);
+    }
+}
+
+static void Console_Cmd_Help(uint8_t argc, char *argv[]);
+
+static const console_cmd_t console_cmds[] = {
+    {"help", "command list", Console_Cmd_Help},
+    {"tasks", "task state / priority / free stack (words)", Console_Cmd_Tasks},
+    {"top", "CPU usage since last top", Console_Cmd_Top},
+    {"heap", "heap and interrupt stack watermarks", Console_Cmd_Heap},
+    {"link", "wifi / cloud / bluetooth link counters", Console_Cmd_Link},
+#if GATEWAY_ENABLE
+    {"node", "node <id> [hc05 addr]", Console_Cmd_Node},
+#endif
+    {"err", "i2c / uart / log error counters", Console_Cmd_Err},
+    {"get", "get [param]", Console_Cmd_Get},
+    {"set", "set <param> <value>", Console_Cmd_Set},
+    {"log", "log [module|*] [0-4]", Console_Cmd_Log},
+#if !OLED_USE_HW_I2C
+    {"i2cbench", "soft i2c bus rate (OLED NOP commands)", Console_Cmd_I2c_Bench},
+#endif
+};
+#define CONSOLE_CMD_COUNT (sizeof(console_cmds) / sizeof(console_cmds[0]))
+
+static void Console_Cmd_Help(uint8_t argc, char *argv[])
+{
+    for (uint8_t i = 0; i < CONSOLE_CMD_COUNT; i++)
+    {
+        Console_Printf("%-6s %s\r\n", console_cmds[i].name, console_cmds[i].help);
+    }
+    Console_Printf("other input goes to the command table, e.g. light:on\r\n");
+}
+
+/**
+ * @brief  执行一行命令
+ * @param  line: 命令行
+ */
+static void Console_Execute(const char *line)
+{
+    char text[CONSOLE_LINE_MAX];
+    char *argv[CONSOLE_ARGC_MAX];
+    uint8_t argc = 0;
+    char *p = text;
+
+    // 在副本上按空白拆分参数，原始行留给命令路由
+    strncpy(text, line, sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+    while (*p != '\0' && argc < CONSOLE_ARGC_MAX)
+    {
+        while (*p == ' ' || *p == '\t')
+        {
+            *p++ = '\0';
+        }
+        if (*p == '\0')
+        {
+            break;
+        }
+        argv[argc++] = p;
+        while (*p != '\0' && *p != ' ' && *p != '\t')
+        {
+            p++;
+        }
+    }
+    if (argc == 0)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < CONSOLE_CMD_COUNT; i++)
+    {
+        if (Console_Str_Equal(console_cmds[i].name, argv[0]))
+        {
+            console_cmds[i].handler(argc, argv);
+            return;
+        }
+    }
+
+    // 不是控制台命令，交给统一命令路由
+    if (Cmd_Process_Line(line, CMD_SRC_DEBUG) != CMD_OK)
+    {
+        Console_Printf("try help\r\n"); // 原因已由命令路由回复
+    }
+}
+
+/**
+ * @brief  控制台任务：等待USART1中断通知整行到达，拷贝后立即释放接收缓冲
+ */
+static void Console_Task(void *pvParameters)
+{
+    static char line[UART1_BUF_SIZE];
+
+    Console_Paint_MSP();
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (uart1_rx_len == 0)
+        {
+            continue;
+        }
+        memcpy(line, uart1_buffer, uart1_rx_len + 1);
+        uart1_rx_len = 0;
+
+        Console_Printf("> %s\r\n", line);
+        Console_Execute(line);
+    }
+}
+
+/**
+ * @brief  创建控制台任务，并让USART1中断在收到整行时通知它
+ * @retval 0: 成功, 1: 堆不足创建失败
+ */
+uint8_t Console_CreateTask(void)
+{
+    if (xTaskCreate((TaskFunction_t)Console_Task,        /* 任务函数 */
+                    (const char *)"Console",             /* 任务名称 */
+                    (uint16_t)CONSOLE_TASK_STACK,        /* 任务堆栈大小 */
+                    (void *)NULL,                        /* 任务函数参数 */
+                    (UBaseType_t)CONSOLE_TASK_PRIO,      /* 任务优先级 */
+                    (TaskHandle_t *)&console_handle) != pdPASS) /* 任务控制句柄 */
+    {
+        return 1;
+    }
+    Debug_Set_Rx_Notify(console_handle);
+    return 0;
+}
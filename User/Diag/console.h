@@ -0,0 +1,32 @@
+/**
+ * @file console.h
+ * @brief USART1诊断控制台：按行接收命令，查看任务/CPU/堆栈/链路/错误计数，在线读写参数
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * 命令（回车结束，不区分大小写）：
+ *   help                 命令列表
+ *   tasks                任务状态、优先级、栈剩余（字）
+ *   top                  各任务CPU占用（距上次top的区间，首次为开机以来）
+ *   heap                 堆剩余/历史最低、中断栈(MSP)剩余
+ *   link                 WiFi/云端/蓝牙/网关链路计数
+ *   err                  I2C、UART1/2/3错误计数，日志丢弃数
+ *   get <参数>           读参数，不带参数列出全部
+ *   set <参数> <值>      写参数
+ *   log <模块|*> [级别]  读/写模块运行期日志级别
+ * 其他输入交给统一命令路由（如 light:on）。
+ */
+#ifndef __CONSOLE_H
+#define __CONSOLE_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+#define CONSOLE_TASK_PRIO       1    // 与日志任务同级，只在空闲时运行
+#define CONSOLE_TASK_STACK      256  // 任务堆栈（字）
+#define CONSOLE_MAX_TASKS       12   // top命令区间统计最多跟踪的任务数
+#define CONSOLE_MSP_SIZE        0x400 // 与启动文件中Stack_Size一致
+
+uint8_t Console_CreateTask(void);
+
+#endif
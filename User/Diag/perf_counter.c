@@ -0,0 +1,55 @@
+/**
+ * @file perf_counter.c
+ * @brief DWT周期计数器：代码段计时 + FreeRTOS运行时间统计时基
+ * @version 0.1
+ * @date 2025-12-25
+ */
+#include "perf_counter.h"
+
+static uint32_t perf_last_cycles = 0;
+static uint32_t perf_wraps = 0;
+
+/**
+ * @brief  使能DWT周期计数器（可重复调用）
+ */
+void Perf_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    PERF_DWT_CYCCNT = 0;
+    PERF_DWT_CTRL |= PERF_DWT_CYCCNTENA;
+    perf_last_cycles = 0;
+    perf_wraps = 0;
+}
+
+/**
+ * @brief  FreeRTOS运行时间统计计数值（portGET_RUN_TIME_COUNTER_VALUE）
+ * @note   内核在每次任务切换时调用，节拍钩子每1ms再调用一次，
+ *         保证在CYCCNT回绕（约59秒）之前总能检测到回绕并扩展高位
+ * @retval SYSCLK >> PERF_RUN_TIME_SHIFT 的计数
+ */
+uint32_t Perf_Run_Time_Get(void)
+{
+    uint32_t primask;
+    uint32_t now;
+    uint32_t value;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    now = PERF_DWT_CYCCNT;
+    if (now < perf_last_cycles)
+    {
+        perf_wraps++;
+    }
+    perf_last_cycles = now;
+    value = (perf_wraps << (32 - PERF_RUN_TIME_SHIFT)) | (now >> PERF_RUN_TIME_SHIFT);
+    __set_PRIMASK(primask);
+    return value;
+}
+
+/**
+ * @brief  周期数换算为微秒
+ */
+uint32_t Perf_Cycles_To_Us(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000);
+}
@@ -0,0 +1,29 @@
+/**
+ * @file perf_counter.h
+ * @brief DWT周期计数器：代码段计时 + FreeRTOS运行时间统计时基
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * CMSIS 1.30 没有DWT结构体定义，这里按地址直接访问寄存器。
+ */
+#ifndef __PERF_COUNTER_H
+#define __PERF_COUNTER_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+#define PERF_DWT_CTRL       (*(volatile uint32_t *)0xE0001000)
+#define PERF_DWT_CYCCNT     (*(volatile uint32_t *)0xE0001004)
+#define PERF_DWT_CYCCNTENA  (1UL << 0)
+
+// 运行时间统计时基 = SYSCLK >> PERF_RUN_TIME_SHIFT（72MHz时约70kHz，32位约17小时回绕）
+#define PERF_RUN_TIME_SHIFT 10
+
+// 读当前周期数（72MHz下约59秒回绕，差值计算不受影响）
+#define Perf_Cycles()       (PERF_DWT_CYCCNT)
+
+void Perf_Init(void);
+uint32_t Perf_Run_Time_Get(void);
+uint32_t Perf_Cycles_To_Us(uint32_t cycles);
+
+#endif
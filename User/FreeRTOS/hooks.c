@@ -1,6 +1,7 @@
 #include <FreeRTOS.h>
 #include <task.h>
 #include "debug.h"
+#include "perf_counter.h"
 
 
 void vApplicationIdleHook( void )
@@ -14,7 +15,8 @@ void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName )
 }
 void vApplicationTickHook( void )
 {
-   
+    // 每个节拍读一次，保证DWT周期计数回绕被及时记录
+    ( void ) Perf_Run_Time_Get();
 }
 void vApplicationMallocFailedHook( void )
 {
@@ -44,6 +44,8 @@
 #if defined (ICCARM)||(__CC_ARM)||(GNUC)
 #include <stdint.h>
 extern uint32_t SystemCoreClock;
+extern void Perf_Init(void);
+extern uint32_t Perf_Run_Time_Get(void);
 #endif
 
 #define configUSE_PREEMPTION			1
@@ -53,23 +55,31 @@ extern uint32_t SystemCoreClock;
 #define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES			( 5 )
 #define configMINIMAL_STACK_SIZE		( ( unsigned short ) 130 )
-#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 16 * 1024 ) )
+/* 任务栈和TCB都从这里分配（heap_4，每块另加8字节头）。按字计的栈：Menu 512、Bluetooth/Gateway 384、
+   Console 256、SensorData 256、Idle 130、OLED_Display 160、Log 128、KeyMain 96，网关模式另有ESP8266 512；
+   加上TCB、菜单事件队列、4个互斥量/信号量和控制台tasks命令的临时表，普通模式约9.5KB，网关模式约11.7KB。
+   整片20KB RAM：静态数据约5.4KB（网关模式5.7KB）+ 本堆12KB + MSP 1KB + C堆0.5KB，余约1KB */
+#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 12 * 1024 ) )
 #define configMAX_TASK_NAME_LEN			( 10 )
 #define configUSE_TRACE_FACILITY		1
 #define configUSE_16_BIT_TICKS			0
 #define configIDLE_SHOULD_YIELD			1
 #define configUSE_MUTEXES				1
-#define configQUEUE_REGISTRY_SIZE		8
+#define configQUEUE_REGISTRY_SIZE		0
 #define configCHECK_FOR_STACK_OVERFLOW	2
 #define configUSE_RECURSIVE_MUTEXES		1
 #define configUSE_MALLOC_FAILED_HOOK	1
 #define configUSE_APPLICATION_TASK_TAG	0
 #define configUSE_COUNTING_SEMAPHORES	1
-#define configGENERATE_RUN_TIME_STATS	0
+#define configGENERATE_RUN_TIME_STATS	1
+
+/* Run time stats use the DWT cycle counter, see Diag/perf_counter.c. */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	Perf_Init()
+#define portGET_RUN_TIME_COUNTER_VALUE()			Perf_Run_Time_Get()
 
 
 /* Software timer definitions. */
-#define configUSE_TIMERS				1
+#define configUSE_TIMERS				0	/* 工程没有软件定时器，不创建定时器任务和命令队列（省约1.4KB堆） */
 #define configTIMER_TASK_PRIORITY		( 2 )
 #define configTIMER_QUEUE_LENGTH		10
 #define configTIMER_TASK_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 2 )
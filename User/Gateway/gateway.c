@@ -0,0 +1,697 @@
+/**
+ * @file gateway.c
+ * @brief 蓝牙-云端网关：一块板子维持WiFi/TCP会话，经HC-05主机模式汇聚N个对端节点
+ * @version 0.1
+ * @date 2025-12-20
+ *
+ * 网关任务独占UART3：多节点时按GATEWAY_SLOT_MS轮流AT+LINK到各节点地址，
+ * 单节点（模块自动绑定）时保持连接并定时广播轮询帧。
+ * 收到的样本缓存在节点表中，由ESP8266任务在发布周期内与本板样本一起批量发布；
+ * 云端下发到节点主题的命令暂存在节点表中，轮到该节点时转发。
+ * 对端节点来源：GATEWAY_PEERS预配置、控制台node命令，或自动绑定模式下节点首次上报。
+ */
+#include "gateway.h"
+#include "HC-05.h"
+#include "uart3.h"
+#include "esp8266.h"
+#include "sensordata.h"
+#include "debug.h"
+#include "cmd_router.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#define LOG_FILE_ID 4
+#include "log.h"
+
+#if GATEWAY_ENABLE
+// 网关侧的节点表与拆帧状态只在网关模式下编译，普通节点只保留帧编解码和节点侧应答
+static gateway_node_t gateway_nodes[GATEWAY_MAX_NODES];
+
+// 帧拼接缓冲（IDLE中断可能把一帧拆成几段）
+static char gateway_line[GATEWAY_LINE_LEN];
+static uint8_t gateway_line_len = 0;
+
+static uint16_t gateway_bad_frames = 0; // 无法归属到节点的错误帧
+static uint8_t gateway_slot = 0;        // 当前轮询的节点槽位
+
+#ifdef GATEWAY_PEERS
+static const struct
+{
+    uint8_t id;
+    const char *addr;
+} gateway_peers[] = {GATEWAY_PEERS};
+#endif
+#endif
+
+/**
+ * @brief  计算帧校验（'$'与'*'之间所有字符异或）
+ */
+static uint8_t Gateway_Checksum(const char *body, uint16_t len)
+{
+    uint8_t cs = 0;
+    for (uint16_t i = 0; i < len; i++)
+    {
+        cs ^= (uint8_t)body[i];
+    }
+    return cs;
+}
+
+#if GATEWAY_ENABLE
+/**
+ * @brief  初始化网关节点表
+ * @retval GATEWAY_OK
+ */
+uint8_t Gateway_Init(void)
+{
+    memset(gateway_nodes, 0, sizeof(gateway_nodes));
+    gateway_line_len = 0;
+    gateway_bad_frames = 0;
+    gateway_slot = 0;
+#ifdef GATEWAY_PEERS
+    for (uint8_t i = 0; i < sizeof(gateway_peers) / sizeof(gateway_peers[0]); i++)
+    {
+        Gateway_Add_Node(gateway_peers[i].id, gateway_peers[i].addr);
+    }
+#endif
+    return GATEWAY_OK;
+}
+
+/**
+ * @brief  登记一个对端节点，已登记时更新地址
+ * @param  id: 节点号（不能与本板相同）
+ * @param  addr: HC-05地址，NULL表示不修改，空串表示由模块自动绑定
+ * @retval GATEWAY_OK: 成功, GATEWAY_ERROR: 节点号非法或节点表已满
+ * @note   网关任务、控制台都可能调用：槽位的查找、占用在同一个临界区内完成，
+ *         新节点的主题先格式化好，填完所有字段后才写入id，其他任务不会看到半填的节点
+ */
+uint8_t Gateway_Add_Node(uint8_t id, const char *addr)
+{
+    gateway_node_t *node = NULL;
+    gateway_node_t *slot = NULL;
+    char topic[GATEWAY_TOPIC_LEN];
+
+    if (id == 0 || id == GATEWAY_LOCAL_ID)
+    {
+        return GATEWAY_ERROR;
+    }
+    snprintf(topic, sizeof(topic), GATEWAY_TOPIC_FMT, id);
+
+    taskENTER_CRITICAL();
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        if (gateway_nodes[i].id == id)
+        {
+            node = &gateway_nodes[i];
+            break;
+        }
+        if (gateway_nodes[i].id == 0 && slot == NULL)
+        {
+            slot = &gateway_nodes[i];
+        }
+    }
+    if (node == NULL && slot != NULL)
+    {
+        memset(slot, 0, sizeof(gateway_node_t));
+        memcpy(slot->topic, topic, sizeof(topic));
+    }
+    if (addr != NULL && (node != NULL || slot != NULL))
+    {
+        gateway_node_t *target = (node != NULL) ? node : slot;
+        strncpy(target->addr, addr, GATEWAY_ADDR_LEN - 1);
+        target->addr[GATEWAY_ADDR_LEN - 1] = '\0';
+    }
+    if (node == NULL && slot != NULL)
+    {
+        slot->id = id; // 最后发布
+    }
+    taskEXIT_CRITICAL();
+
+    if (node == NULL)
+    {
+        if (slot == NULL)
+        {
+            LOG_W(GATEWAY, "node table full, drop node %d\r\n", id);
+            return GATEWAY_ERROR;
+        }
+        LOG_I(GATEWAY, "node %d registered, topic %s\r\n", id, topic);
+    }
+    return GATEWAY_OK;
+}
+
+/**
+ * @brief  按节点号查找节点
+ * @retval 节点指针，NULL表示未登记
+ */
+gateway_node_t *Gateway_Find_Node(uint8_t id)
+{
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        if (gateway_nodes[i].id != 0 && gateway_nodes[i].id == id)
+        {
+            return &gateway_nodes[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  已登记节点数量
+ */
+uint8_t Gateway_Node_Count(void)
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        if (gateway_nodes[i].id != 0)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+#endif
+
+/**
+ * @brief  按帧格式封装：$<body>*CS\r\n
+ * @param  buf: 输出缓冲
+ * @param  size: 缓冲大小
+ * @param  body: 帧内容（不含'$'与校验）
+ * @retval GATEWAY_OK: 成功, GATEWAY_ERROR: 缓冲不足
+ */
+uint8_t Gateway_Frame_Build(char *buf, uint16_t size, const char *body)
+{
+    int len = snprintf(buf, size, "$%s*%02X\r\n", body, Gateway_Checksum(body, strlen(body)));
+    if (len < 0 || len >= (int)size)
+    {
+        return GATEWAY_ERROR;
+    }
+    return GATEWAY_OK;
+}
+
+/**
+ * @brief  校验一行帧，成功时就地截断校验部分
+ * @param  line: 去掉行尾的帧文本（会被修改）
+ * @param  body: 返回帧内容起始指针
+ * @retval GATEWAY_OK: 校验通过, GATEWAY_ERROR: 格式或校验错误
+ */
+uint8_t Gateway_Frame_Check(char *line, char **body)
+{
+    char *star;
+    char *end;
+    unsigned long cs;
+
+    if (line[0] != '$')
+    {
+        return GATEWAY_ERROR;
+    }
+    star = strchr(line, '*');
+    if (star == NULL || star[1] == '\0')
+    {
+        return GATEWAY_ERROR;
+    }
+
+    cs = strtoul(star + 1, &end, 16);
+    if (end == star + 1 || cs != Gateway_Checksum(line + 1, star - line - 1))
+    {
+        return GATEWAY_ERROR;
+    }
+
+    *star = '\0';
+    *body = line + 1;
+    return GATEWAY_OK;
+}
+
+#if GATEWAY_ENABLE
+/**
+ * @brief  处理一条遥测帧 T,<id>,<seq>,<lux>,<light_on>
+ */
+static void Gateway_Handle_Telemetry(const char *body)
+{
+    unsigned int id, seq, lux, on;
+    gateway_node_t *node;
+
+    if (sscanf(body, "T,%u,%u,%u,%u", &id, &seq, &lux, &on) != 4 || id > 255)
+    {
+        gateway_bad_frames++;
+        return;
+    }
+
+    node = Gateway_Find_Node((uint8_t)id);
+    if (node == NULL)
+    {
+        // 自动绑定模式下节点首次上报即登记
+        if (Gateway_Add_Node((uint8_t)id, NULL) != GATEWAY_OK)
+        {
+            gateway_bad_frames++;
+            return;
+        }
+        node = Gateway_Find_Node((uint8_t)id);
+    }
+
+    taskENTER_CRITICAL();
+    if (node->rx_frames > 0)
+    {
+        uint8_t gap = (uint8_t)(seq - node->seq);
+
+        // 只有小的前跳才是丢帧；序号回退、重发或跳得太远按重新同步处理
+        if (gap > 1 && gap <= GATEWAY_SEQ_MAX_GAP)
+        {
+            node->lost_frames += gap - 1;
+        }
+    }
+    node->seq = (uint8_t)seq;
+    node->lux = (uint16_t)lux;
+    node->light_on = on ? 1 : 0;
+    node->fresh = 1;
+    node->last_seen = xTaskGetTickCount();
+    node->rx_frames++;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief  处理一整行
+ */
+static void Gateway_Handle_Line(char *line)
+{
+    char *body;
+
+    if (Gateway_Frame_Check(line, &body) != GATEWAY_OK)
+    {
+        // 非帧数据（AT回复、CONNECT等）直接忽略
+        if (line[0] == '$')
+        {
+            gateway_bad_frames++;
+            LOG_W(GATEWAY, "bad frame %s\r\n", line);
+        }
+        return;
+    }
+
+    if (body[0] == 'T')
+    {
+        Gateway_Handle_Telemetry(body);
+    }
+}
+
+/**
+ * @brief  网关输入HC-05收到的原始数据，按行拆帧
+ * @param  data: 数据
+ * @param  len: 长度
+ */
+void Gateway_Input(const uint8_t *data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++)
+    {
+        char c = (char)data[i];
+
+        if (c == '\r')
+        {
+            continue;
+        }
+        if (c == '\n')
+        {
+            gateway_line[gateway_line_len] = '\0';
+            if (gateway_line_len > 0)
+            {
+                Gateway_Handle_Line(gateway_line);
+            }
+            gateway_line_len = 0;
+            continue;
+        }
+        if (c == '$')
+        {
+            gateway_line_len = 0; // 新帧起始，丢弃残留
+        }
+        if (gateway_line_len < GATEWAY_LINE_LEN - 1)
+        {
+            gateway_line[gateway_line_len++] = c;
+        }
+        else
+        {
+            gateway_line_len = 0; // 超长帧丢弃
+            gateway_bad_frames++;
+        }
+    }
+}
+
+/**
+ * @brief  取出所有待发布的节点样本（ESP8266任务在发布周期调用）
+ * @param  topics: 输出主题
+ * @param  msgs: 输出消息（巴法云格式 #lux）
+ * @param  max: 输出数组容量
+ * @retval 取出的样本数
+ */
+uint8_t Gateway_Collect_Samples(char topics[][GATEWAY_TOPIC_LEN], char msgs[][GATEWAY_MSG_LEN], uint8_t max)
+{
+    uint8_t count = 0;
+    uint32_t now = xTaskGetTickCount();
+
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES && count < max; i++)
+    {
+        gateway_node_t *node = &gateway_nodes[i];
+        uint16_t lux;
+
+        taskENTER_CRITICAL();
+        if (node->id == 0 || !node->fresh || !node->light_on ||
+            (now - node->last_seen) > pdMS_TO_TICKS(GATEWAY_NODE_TIMEOUT_MS))
+        {
+            taskEXIT_CRITICAL();
+            continue;
+        }
+        lux = node->lux;
+        node->fresh = 0;
+        taskEXIT_CRITICAL();
+
+        strcpy(topics[count], node->topic);
+        snprintf(msgs[count], GATEWAY_MSG_LEN, "#%d", lux);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief  把云端下发到节点主题的命令暂存到对应节点
+ * @param  buffer: ESP8266收到的数据
+ * @retval 1-命中某个节点主题，0-未命中
+ */
+uint8_t Gateway_Route_Downlink(const char *buffer)
+{
+    char topic[GATEWAY_TOPIC_LEN + 8];
+    char msg_value[32];
+
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        gateway_node_t *node = &gateway_nodes[i];
+        if (node->id == 0)
+        {
+            continue;
+        }
+
+        snprintf(topic, sizeof(topic), "topic=%s", node->topic);
+        if (strstr(buffer, topic) == NULL)
+        {
+            continue;
+        }
+        if (ESP8266_Parse_Command(buffer, node->topic, msg_value) == 1)
+        {
+            taskENTER_CRITICAL();
+            strncpy(node->downlink, msg_value, GATEWAY_MSG_LEN - 1);
+            node->downlink[GATEWAY_MSG_LEN - 1] = '\0';
+            taskEXIT_CRITICAL();
+            LOG_I(GATEWAY, "downlink for node %d queued: %s\r\n", node->id, msg_value);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  云端维护：为新登记的节点订阅主题（ESP8266任务中调用）
+ * @param  uid: 巴法云私钥
+ */
+void Gateway_Service_Cloud(const char *uid)
+{
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        gateway_node_t *node = &gateway_nodes[i];
+        if (node->id != 0 && !node->subscribed)
+        {
+            if (ESP8266_TCP_Subscribe(uid, node->topic) == 1)
+            {
+                node->subscribed = 1;
+                LOG_I(GATEWAY, "subscribe %s Success\r\n", node->topic);
+            }
+            return; // 每次只订阅一个，避免长时间占用发布循环
+        }
+    }
+}
+#endif
+
+/**
+ * @brief  节点侧：本板节点号
+ * @retval GATEWAY_NODE_ID，为0时由芯片唯一ID推算（1~254，避开GATEWAY_LOCAL_ID）
+ */
+uint8_t Gateway_Node_Id(void)
+{
+#if GATEWAY_NODE_ID != 0
+    return GATEWAY_NODE_ID;
+#else
+    static uint8_t node_id = 0;
+
+    if (node_id == 0)
+    {
+        const uint32_t *uid = (const uint32_t *)GATEWAY_UID_BASE;
+        uint32_t h = uid[0] ^ uid[1] ^ uid[2];
+
+        h ^= h >> 16;
+        h ^= h >> 8;
+        node_id = (uint8_t)(h % 253 + 1); // 1~253
+        if (node_id >= GATEWAY_LOCAL_ID)
+        {
+            node_id++; // 跳过网关自身的节点号
+        }
+    }
+    return node_id;
+#endif
+}
+
+/**
+ * @brief  节点侧：回复一帧本板遥测
+ */
+static void Gateway_Node_Report(void)
+{
+    static uint8_t seq = 0;
+    char body[40];
+    char frame[GATEWAY_LINE_LEN];
+
+    snprintf(body, sizeof(body), "T,%d,%d,%d,%d", Gateway_Node_Id(), seq++,
+             SensorData.light_data.lux, Light_ON);
+    if (Gateway_Frame_Build(frame, sizeof(frame), body) == GATEWAY_OK)
+    {
+        HC05_Send_String(frame);
+    }
+}
+
+/**
+ * @brief  节点侧：处理网关发来的轮询/命令帧（在蓝牙任务中调用）
+ * @param  buffer: UART3收到的数据（以'\0'结尾）
+ * @retval GATEWAY_OK: 处理了至少一帧, GATEWAY_ERROR: 无网关帧
+ */
+uint8_t Gateway_Node_Handle(const char *buffer)
+{
+    char line[GATEWAY_LINE_LEN];
+    const char *p = buffer;
+    uint8_t handled = GATEWAY_ERROR;
+
+    while ((p = strchr(p, '$')) != NULL)
+    {
+        char *body;
+        unsigned int id;
+        uint8_t len = 0;
+
+        while (p[len] != '\0' && p[len] != '\r' && p[len] != '\n' && len < GATEWAY_LINE_LEN - 1)
+        {
+            line[len] = p[len];
+            len++;
+        }
+        line[len] = '\0';
+        p += len;
+
+        if (Gateway_Frame_Check(line, &body) != GATEWAY_OK)
+        {
+            continue;
+        }
+
+        if (body[0] == 'Q' && sscanf(body, "Q,%u", &id) == 1 &&
+            (id == 0 || id == Gateway_Node_Id()))
+        {
+            Gateway_Node_Report();
+            handled = GATEWAY_OK;
+        }
+        else if (body[0] == 'C' && sscanf(body, "C,%u,", &id) == 1 && id == Gateway_Node_Id())
+        {
+            const char *msg = strchr(body + 2, ',');
+            if (msg == NULL)
+            {
+                continue;
+            }
+            msg++;
+            // 网关转发的是节点主题上的云端消息，交给命令路由按light命令执行
+            Cmd_Execute(Cmd_Find("light"), msg, NULL, 0);
+            LOG_I(GATEWAY, "command from hub: %s\r\n", msg);
+            Gateway_Node_Report(); // 回复当前状态作为确认
+            handled = GATEWAY_OK;
+        }
+    }
+    return handled;
+}
+
+#if GATEWAY_ENABLE
+/**
+ * @brief  连接到指定槽位的节点（多节点轮询时使用）
+ */
+static uint8_t Gateway_Link_Node(gateway_node_t *node)
+{
+    char cmd[32];
+
+    HC05_Disconnect();
+    taskENTER_CRITICAL();
+    snprintf(cmd, sizeof(cmd), "AT+LINK=%s", node->addr);
+    taskEXIT_CRITICAL();
+    if (HC05_Send_AT_Cmd(cmd, "OK", 5000) != HC05_OK)
+    {
+        LOG_W(GATEWAY, "link node %d (%s) failed\r\n", node->id, cmd + 8); // cmd + 8: 地址
+        return GATEWAY_ERROR;
+    }
+    return GATEWAY_OK;
+}
+
+/**
+ * @brief  发送轮询帧，并转发该节点的待发命令
+ * @param  node: 目标节点，NULL表示广播（自动绑定模式）
+ */
+static void Gateway_Poll_Node(gateway_node_t *node)
+{
+    char body[GATEWAY_MSG_LEN + 8];
+    char frame[GATEWAY_LINE_LEN];
+
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        gateway_node_t *n = &gateway_nodes[i];
+        char msg[GATEWAY_MSG_LEN];
+
+        if (n->id == 0 || (node != NULL && n != node))
+        {
+            continue;
+        }
+
+        taskENTER_CRITICAL();
+        memcpy(msg, n->downlink, sizeof(msg));
+        n->downlink[0] = '\0';
+        taskEXIT_CRITICAL();
+        if (msg[0] == '\0')
+        {
+            continue;
+        }
+
+        snprintf(body, sizeof(body), "C,%d,%s", n->id, msg);
+        if (Gateway_Frame_Build(frame, sizeof(frame), body) == GATEWAY_OK)
+        {
+            HC05_Send_String(frame);
+        }
+    }
+
+    snprintf(body, sizeof(body), "Q,%d", node != NULL ? node->id : 0);
+    if (Gateway_Frame_Build(frame, sizeof(frame), body) == GATEWAY_OK)
+    {
+        HC05_Send_String(frame);
+    }
+}
+
+/**
+ * @brief  配置了地址、需要主动连接的节点数（控制台可能随时登记，每个时隙重新统计）
+ */
+static uint8_t Gateway_Linked_Count(void)
+{
+    uint8_t count = 0;
+
+    taskENTER_CRITICAL();
+    for (uint8_t i = 0; i < GATEWAY_MAX_NODES; i++)
+    {
+        if (gateway_nodes[i].id != 0 && gateway_nodes[i].addr[0] != '\0')
+        {
+            count++;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return count;
+}
+
+/**
+ * @brief  选出下一个配置了地址的节点
+ * @retval 节点指针，NULL表示没有需要主动连接的节点
+ */
+static gateway_node_t *Gateway_Next_Linked_Node(void)
+{
+    gateway_node_t *node = NULL;
+
+    taskENTER_CRITICAL();
+    for (uint8_t n = 0; n < GATEWAY_MAX_NODES; n++)
+    {
+        gateway_slot = (gateway_slot + 1) % GATEWAY_MAX_NODES;
+        if (gateway_nodes[gateway_slot].id != 0 && gateway_nodes[gateway_slot].addr[0] != '\0')
+        {
+            node = &gateway_nodes[gateway_slot];
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return node;
+}
+
+/**
+ * @brief  网关任务：独占UART3，汇聚节点遥测并转发下行命令
+ */
+void Gateway_Main_Task(void *pvParameters)
+{
+    uint8_t rx[UART3_BUF_SIZE];
+    uint8_t len;
+    gateway_node_t *node = NULL;
+    TickType_t slot_tick;
+    uint8_t linked_count;
+
+    LOG_I(GATEWAY, "Gateway_Main_Task start ->\r\n");
+
+    HC05_Set_Master_Mode();
+    slot_tick = xTaskGetTickCount() - pdMS_TO_TICKS(GATEWAY_SLOT_MS);
+
+    while (1)
+    {
+        if ((xTaskGetTickCount() - slot_tick) >= pdMS_TO_TICKS(GATEWAY_SLOT_MS))
+        {
+            slot_tick = xTaskGetTickCount();
+
+            linked_count = Gateway_Linked_Count();
+            if (linked_count > 1 || (linked_count == 1 && node == NULL))
+            {
+                // 多节点：断开当前链路，连接下一个节点
+                node = Gateway_Next_Linked_Node();
+                if (node != NULL && Gateway_Link_Node(node) != GATEWAY_OK)
+                {
+                    node = NULL;
+                }
+            }
+            Gateway_Poll_Node(node);
+        }
+
+        if (uart3_rx_len > 0)
+        {
+            len = uart3_rx_len;
+            if (len > UART3_BUF_SIZE)
+            {
+                len = UART3_BUF_SIZE;
+            }
+            memcpy(rx, uart3_buffer, len);
+            uart3_rx_len = 0;
+            Gateway_Input(rx, len);
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+/**
+ * @brief  按槽位取节点（控制台遍历用）
+ * @param  index: 槽位 0~GATEWAY_MAX_NODES-1
+ * @retval 节点指针，槽位空闲或越界返回NULL
+ */
+gateway_node_t *Gateway_Get_Node(uint8_t index)
+{
+    if (index >= GATEWAY_MAX_NODES || gateway_nodes[index].id == 0)
+    {
+        return NULL;
+    }
+    return &gateway_nodes[index];
+}
+#endif
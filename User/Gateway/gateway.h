@@ -0,0 +1,108 @@
+/**
+ * @file gateway.h
+ * @brief 蓝牙-云端网关：汇聚HC-05对端节点的遥测数据，统一经ESP8266发布到巴法云
+ * @version 0.1
+ * @date 2025-12-20
+ *
+ * 帧格式（ASCII，NMEA风格异或校验，校验范围为'$'与'*'之间的字符）：
+ *   遥测上行  $T,<id>,<seq>,<lux>,<light_on>*CS\r\n
+ *   轮询下行  $Q,<id>*CS\r\n
+ *   命令下行  $C,<id>,<msg>*CS\r\n
+ */
+#ifndef __GATEWAY_H
+#define __GATEWAY_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+// 网关模式开关：1-本板作为网关（HC-05主机 + ESP8266），0-普通节点
+#ifndef GATEWAY_ENABLE
+#define GATEWAY_ENABLE          0
+#endif
+
+// 网关自身的节点号，对应巴法云主题后缀（myLUX004），对端节点不能使用
+#ifndef GATEWAY_LOCAL_ID
+#define GATEWAY_LOCAL_ID        4
+#endif
+
+// 普通节点上报时使用的节点号（1~255，不能等于GATEWAY_LOCAL_ID）；
+// 为0时由芯片唯一ID推算出1~254之间、避开GATEWAY_LOCAL_ID的节点号，多块板子可烧同一固件
+#ifndef GATEWAY_NODE_ID
+#define GATEWAY_NODE_ID         0
+#endif
+#if GATEWAY_NODE_ID != 0 && GATEWAY_NODE_ID == GATEWAY_LOCAL_ID
+#error "GATEWAY_NODE_ID must differ from GATEWAY_LOCAL_ID"
+#endif
+#define GATEWAY_UID_BASE        0x1FFFF7E8 // 96位芯片唯一ID
+
+#define GATEWAY_SEQ_MAX_GAP     128  // 序号前跳超过该值（节点复位、重发）视为重新同步，不计丢帧
+
+#define GATEWAY_MAX_NODES       4    // 最多汇聚的对端节点数
+#define GATEWAY_ADDR_LEN        16   // HC-05地址 "98d3,31,fd5a21"
+#define GATEWAY_TOPIC_LEN       12
+#define GATEWAY_MSG_LEN         16   // 下行命令最大长度
+#define GATEWAY_LINE_LEN        64   // 单帧最大长度
+#define GATEWAY_TOPIC_FMT       "myLUX%03u"
+
+// 预先登记的对端节点 {节点号, "HC-05地址"}，逗号分隔，Gateway_Init时登记；
+// 有两个以上带地址的节点时网关按GATEWAY_SLOT_MS轮流AT+LINK。
+// 不定义时只登记模块自动绑定、主动上报的节点，运行中也可用控制台node命令登记
+// #define GATEWAY_PEERS           {1, "98d3,31,fd5a21"}, {2, "98d3,32,10e3c8"}
+
+#define GATEWAY_SLOT_MS         2000 // 多节点轮询时每个节点的驻留时间
+#define GATEWAY_NODE_TIMEOUT_MS 30000 // 超过该时间无数据视为离线
+
+// 网关函数返回值
+#define GATEWAY_OK              0
+#define GATEWAY_ERROR           1
+
+// 节点表由网关任务、ESP8266任务和控制台共用：
+// id在其余字段填好后最后写入（临界区内），id非0后topic不再改变，可直接读；
+// 其余会变的字段（样本、下行命令、地址）都在临界区内读写
+typedef struct
+{
+    uint8_t  id;                      // 节点号，0表示空闲槽位
+    char     addr[GATEWAY_ADDR_LEN];  // HC-05地址，为空表示由模块自动绑定
+    char     topic[GATEWAY_TOPIC_LEN];// 巴法云主题
+
+    uint16_t lux;                     // 最新照度
+    uint8_t  light_on;                // 节点传感器开关
+    uint8_t  seq;                     // 最新帧序号
+    uint8_t  fresh;                   // 有未发布的新样本
+    uint8_t  subscribed;              // 已在云端订阅该主题
+    uint32_t last_seen;               // 最近收到数据的tick
+
+    char     downlink[GATEWAY_MSG_LEN]; // 待转发的下行命令
+
+    uint16_t rx_frames;               // 收到的有效帧
+    uint16_t rx_errors;               // 校验/格式错误帧
+    uint16_t lost_frames;             // 序号跳变推算的丢帧
+} gateway_node_t;
+
+#if GATEWAY_ENABLE
+uint8_t Gateway_Init(void);
+uint8_t Gateway_Add_Node(uint8_t id, const char *addr);
+gateway_node_t *Gateway_Find_Node(uint8_t id);
+uint8_t Gateway_Node_Count(void);
+gateway_node_t *Gateway_Get_Node(uint8_t index);
+#endif
+
+// 帧编解码
+uint8_t Gateway_Frame_Build(char *buf, uint16_t size, const char *body);
+uint8_t Gateway_Frame_Check(char *line, char **body);
+
+#if GATEWAY_ENABLE
+// 网关侧：HC-05数据输入与云端接口（云端接口在ESP8266任务中调用）
+void Gateway_Input(const uint8_t *data, uint16_t len);
+uint8_t Gateway_Collect_Samples(char topics[][GATEWAY_TOPIC_LEN], char msgs[][GATEWAY_MSG_LEN], uint8_t max);
+uint8_t Gateway_Route_Downlink(const char *buffer);
+void Gateway_Service_Cloud(const char *uid);
+
+void Gateway_Main_Task(void *pvParameters);
+#endif
+
+// 节点侧：本板节点号，处理网关发来的轮询/命令帧
+uint8_t Gateway_Node_Id(void);
+uint8_t Gateway_Node_Handle(const char *buffer);
+
+#endif
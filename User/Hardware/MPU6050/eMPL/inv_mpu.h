@@ -45,7 +45,7 @@ u8 mpu_dmp_init(void);
 u8 mpu_dmp_init_pedometer(void);
 u8 mpu_pedometer_update(void);
 u8 enable_pedometer_feature(void);
-u8 enable_high_sensitivity_pedometer(void);  // µĸȼƲ
+u8 enable_high_sensitivity_pedometer(void);  // 添加新的高灵敏度计步器函数声明
 u8 process_pedometer_data(void);
 u8 safe_pedometer_update(void);
 int mpu_init_slave(void);
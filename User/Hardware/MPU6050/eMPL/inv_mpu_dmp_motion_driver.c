@@ -915,9 +915,9 @@ int dmp_get_pedometer_step_count(unsigned long *count)
     if (mpu_read_mem(D_PEDSTD_STEPCTR, 4, tmp))
         return -1;
 
-    // ȡǷЧָֹ
+    // 检查读取的数据是否有效，防止出现负数
     if ((tmp[0] & 0x80) != 0) {
-        // λΪ1˵зΪü
+        // 如果最高位为1，说明是有符号数且为负数，重置计数器
         dmp_set_pedometer_step_count(0);
         *count = 0;
         return 0;
@@ -960,9 +960,9 @@ int dmp_get_pedometer_walk_time(unsigned long *time)
     if (mpu_read_mem(D_PEDSTD_TIMECTR, 4, tmp))
         return -1;
 
-    // ȡǷЧָֹ
+    // 检查读取的数据是否有效，防止出现负数
     if ((tmp[0] & 0x80) != 0) {
-        // λΪ1˵зΪüʱ
+        // 如果最高位为1，说明是有符号数且为负数，重置计时器
         dmp_set_pedometer_walk_time(0);
         *time = 0;
         return 0;
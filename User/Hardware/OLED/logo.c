@@ -1,645 +1,244 @@
-// const unsigned char logo[1024] =
-// 	{
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA0, 0xD0,
-// 		0xE0, 0xF4, 0xF8, 0xF8, 0x78, 0x30, 0x70, 0x50, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x80, 0x40, 0xA0, 0xC0, 0xE0, 0xF8, 0xF2, 0xF9, 0xFD, 0xFE, 0xBF, 0x1F, 0xAF,
-// 		0xC7, 0xE7, 0xF3, 0xF8, 0x9C, 0x8E, 0xC7, 0xE3, 0xF1, 0x78, 0xBC, 0x5C, 0xEA, 0x80, 0x00, 0x80,
-// 		0x80, 0xC0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0xA0, 0xC0, 0xF0, 0xE0,
-// 		0xF6, 0xF9, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-// 		0x7F, 0xBF, 0xDF, 0x2F, 0x7F, 0x47, 0x8B, 0xDD, 0xF0, 0xE1, 0xF6, 0xF8, 0xFD, 0xFE, 0xFF, 0xFF,
-// 		0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF8, 0xF4, 0xE0, 0xD0, 0xB0, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-// 		0xC0, 0xE0, 0x20, 0x20, 0xE0, 0xA0, 0x20, 0x20, 0xF0, 0xF8, 0x38, 0x28, 0x20, 0xA0, 0xE0, 0x20,
-// 		0x20, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80,
-// 		0xE0, 0xF8, 0xF8, 0xB8, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0x70, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x80, 0x40, 0xA0, 0xC0, 0xD0, 0xE8, 0xF0, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-// 		0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF7, 0x33, 0xF3, 0xF3, 0xF1, 0xF1, 0xF1, 0xF3, 0xE3, 0x65, 0xFE,
-// 		0x08, 0xF0, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0x1F, 0x2F, 0x37, 0xD7, 0xF3, 0xEB, 0xE3, 0xE3, 0xE7,
-// 		0xE7, 0x77, 0x6F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFA, 0xF0,
-// 		0xE8, 0xC0, 0xA0, 0x60, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xF4, 0xFE,
-// 		0x87, 0xE0, 0xB6, 0xB6, 0xBE, 0x9F, 0x8E, 0xFD, 0x8F, 0x9F, 0x9C, 0xB4, 0xB7, 0xA5, 0x84, 0xFA,
-// 		0x7E, 0x0F, 0x01, 0x10, 0x90, 0x10, 0xFC, 0xBC, 0x1C, 0x10, 0x10, 0x90, 0xFC, 0x7C, 0x30, 0x94,
-// 		0xC0, 0x78, 0x3E, 0xDE, 0x10, 0x10, 0x10, 0x90, 0xF0, 0xF3, 0x31, 0x10, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x01, 0x04, 0x09, 0x0B, 0x17, 0x2F, 0x5F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-// 		0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xF6, 0xE9, 0xEB, 0xF7, 0xE7, 0xE7, 0xEB, 0xE9, 0xF0, 0xFB,
-// 		0xFC, 0xFF, 0xFF, 0x7F, 0xFF, 0x1F, 0x2F, 0xF0, 0x40, 0x80, 0xCB, 0xC7, 0xCF, 0xCF, 0xC7, 0xC7,
-// 		0xDB, 0xEE, 0xF4, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0x1F,
-// 		0x2F, 0x07, 0x0B, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x2D, 0x3C, 0x3C, 0x3C,
-// 		0x2C, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xA4, 0xE4, 0xE4, 0xE4, 0x04, 0x05, 0x05,
-// 		0x04, 0x04, 0xA0, 0xF4, 0x9C, 0xAF, 0x85, 0x84, 0x84, 0xEC, 0x7D, 0xC7, 0x89, 0xC1, 0xE3, 0x71,
-// 		0x38, 0x1E, 0x5F, 0x7F, 0x60, 0xE0, 0x81, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0B, 0x13, 0x17, 0x0F,
-// 		0x5F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x5F, 0x6F, 0x0F, 0x7B,
-// 		0xA3, 0xC5, 0xEE, 0xF0, 0xFA, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-// 		0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x5F, 0x0F, 0x17, 0x1B, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x03, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x01, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x01, 0x00, 0x02, 0x05, 0x03, 0x03, 0x07, 0x35, 0x12, 0xA7, 0x74, 0xF8, 0x3D, 0x1E, 0x8F,
-// 		0xC7, 0xE3, 0x73, 0x3F, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0xFB, 0xFB, 0x7F, 0xBF, 0x1F, 0x2F, 0x27,
-// 		0x03, 0x0B, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11,
-// 		0x11, 0x18, 0x3C, 0x3E, 0x1F, 0x0F, 0x0F, 0x17, 0x03, 0x05, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-// }; /*"粤嵌logo.bmp"*/
+/**
+ * @file logo.c
+ * @brief 压缩位图资源（由 Tools/asset_packer.py 从 Tools/assets/logo_src.c 生成，请勿手工修改）
+ *
+ * packed 含 8 字节描述符，delta 为动画差分帧（只能接着前一帧在同一位置画）
+ *   asset                   size    raw packed  saved
+ *   gImage_setting         32x32    128    110     18
+ *   gImage_TandH           32x32    128    102     26
+ *   gImage_sun             32x32    128     78     50
+ *   gImage_moon            32x32    128     79     49
+ *   gImage_list            32x32    128     22    106
+ *   gImage_new             32x32    128     32     96
+ *   gImage_lightQD         32x32    128     99     29
+ *   gImage_tjbg1           64x64    512    295    217
+ *   gImage_tjbg2           64x64    512    201    311  delta
+ *   gImage_tjbg3           64x64    512    139    373  delta
+ *   gImage_tjbg4           64x64    512    164    348  delta
+ *   gImage_tjbg5           64x64    512    171    341  delta
+ *   gImage_tjbg6           64x64    512    161    351  delta
+ *   gImage_tjbg7           64x64    512    200    312  delta
+ *   gImage_tjbg8           64x64    512    194    318  delta
+ *   gImage_wifi            32x32    128     91     37
+ *   gImage_bluetooth       32x32    128     99     29
+ *   total                          5248   2237   3011
+ */
+#include "logo.h"
 
+static const uint8_t gImage_setting_data[102] = {
+    0x42, 0x00, 0x16, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0x70, 0x30, 0x38, 0x38, 0x1C, 0x0C, 0x0C,
+    0x1C, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x46, 0x00, 0x00, 0xFE, 0x40, 0xFF,
+    0x40, 0x01, 0x41, 0x00, 0x09, 0xF0, 0xF8, 0x38, 0x1C, 0x0C, 0x0C, 0x1C, 0x38, 0xF8, 0xF0, 0x41,
+    0x00, 0x04, 0x01, 0x01, 0xFF, 0xFF, 0xFE, 0x44, 0x00, 0x0A, 0x1F, 0x3F, 0x7F, 0x60, 0xE0, 0xC0,
+    0xC0, 0x80, 0x81, 0x03, 0x07, 0x42, 0x0E, 0x0A, 0x07, 0x03, 0x81, 0x80, 0xC0, 0xE0, 0xE0, 0x70,
+    0x7F, 0x3F, 0x1F, 0x4A, 0x00, 0x09, 0x01, 0x01, 0x03, 0x03, 0x07, 0x06, 0x0E, 0x0E, 0x06, 0x07,
+    0x40, 0x03, 0x40, 0x01, 0x47, 0x00,
+};
+const oled_bitmap_t gImage_setting = {gImage_setting_data, 32, 32, 0};
 
-// const unsigned char gImage_1[464] = { /* 0X32,0X01,0X00,0X3A,0X00,0X3A, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,
-// 0X60,0X60,0X60,0X60,0XC0,0XC0,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X80,0XE0,0XE0,0X60,0X60,0X70,0X60,0XE0,0XE0,
-// 0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X80,0XE0,0XF0,0XFC,0X9E,0X87,0XC3,0XC0,0XE0,0X60,0X60,0X60,0X30,0X31,
-// 0X33,0X3F,0X3F,0X1C,0X38,0X30,0X38,0X38,0X38,0X30,0X30,0X38,0X38,0X7C,0X7F,0X77,
-// 0X63,0XE1,0XC0,0XC0,0XC0,0XC0,0X80,0X00,0X00,0X00,0X03,0X0F,0X7E,0XF8,0XC0,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XE0,0X70,0X3C,0X1F,0X0F,0X07,0X03,
-// 0X03,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X01,
-// 0X03,0X03,0X07,0X06,0X0C,0X38,0XF8,0XFF,0XFF,0XFC,0XC0,0X00,0X00,0X00,0X00,0X60,
-// 0XFC,0XFF,0X07,0X01,0X00,0X00,0X00,0X1E,0X7E,0X7F,0X7F,0X0E,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X30,0X60,0X60,0X70,0X70,0X70,0X60,0XE0,0XE0,0X60,0X70,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X3C,0XFF,0XFF,0XFE,0X3C,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X01,0X07,0X3F,0XFF,0XF0,0X00,0X00,0X00,0X07,0X3F,0XFF,0XF0,0XC0,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0XFF,
-// 0XFF,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0XFF,0XFE,0X80,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0F,0XFF,0XFF,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X7F,0X7F,0X3F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X20,0X3F,0X3F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
+static const uint8_t gImage_TandH_data[94] = {
+    0x42, 0x00, 0x09, 0xF8, 0xFC, 0x0E, 0x06, 0x07, 0x06, 0x06, 0xFE, 0xFC, 0xE0, 0x54, 0x00, 0x40,
+    0xFF, 0x43, 0x00, 0x41, 0xFF, 0x45, 0x00, 0x01, 0x80, 0xC0, 0x41, 0xF0, 0x01, 0xC0, 0x80, 0x42,
+    0x00, 0x14, 0x40, 0xF8, 0xFE, 0x0F, 0x43, 0xF3, 0xF8, 0xF8, 0xFC, 0xFC, 0xF8, 0xF9, 0xF3, 0x07,
+    0x1E, 0xFC, 0xF0, 0x00, 0xE0, 0xF8, 0xFE, 0x45, 0xFF, 0x18, 0xFE, 0xF8, 0xE0, 0x00, 0x00, 0x03,
+    0x0F, 0x1E, 0x18, 0x39, 0x33, 0x37, 0x77, 0x77, 0x33, 0x33, 0x39, 0x1C, 0x0F, 0x07, 0x01, 0x00,
+    0x07, 0x0F, 0x1F, 0x41, 0x3F, 0x00, 0x7F, 0x41, 0x3F, 0x03, 0x1F, 0x0F, 0x07, 0x00,
+};
+const oled_bitmap_t gImage_TandH = {gImage_TandH_data, 32, 32, 0};
 
+static const uint8_t gImage_sun_data[70] = {
+    0x4C, 0x00, 0x01, 0x70, 0x40, 0x42, 0x00, 0x00, 0x80, 0x40, 0xC0, 0x4C, 0x00, 0x07, 0x80, 0x80,
+    0x83, 0x03, 0xF2, 0x18, 0x04, 0x06, 0x40, 0x03, 0x41, 0x01, 0x05, 0x03, 0x02, 0x06, 0x0D, 0xF0,
+    0x00, 0x42, 0x10, 0x47, 0x00, 0x08, 0x01, 0x01, 0x60, 0x30, 0x33, 0x0E, 0x18, 0x10, 0x30, 0x40,
+    0xA0, 0x41, 0x20, 0x07, 0x10, 0xD8, 0xCC, 0x07, 0x00, 0x0C, 0x08, 0x18, 0x51, 0x00, 0x00, 0x03,
+    0x44, 0x00, 0x40, 0x01, 0x47, 0x00,
+};
+const oled_bitmap_t gImage_sun = {gImage_sun_data, 32, 32, 0};
 
-// const unsigned char gImage_bg[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X60,0X60,0X60,0X60,
-// 0X60,0X60,0X60,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X40,0X10,0X98,
-// 0XCC,0X60,0XB0,0XC0,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X09,0X09,0X09,0X09,
-// 0X09,0X09,0X09,0X09,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0XC0,0XB0,0X60,0XCC,
-// 0X98,0X30,0X60,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X06,0X13,0X09,
-// 0X06,0X03,0X01,0X00,0X80,0XC0,0XE0,0XF0,0XF4,0XF8,0XFA,0XFC,0XFC,0XFC,0XFC,0X7F,
-// 0X7F,0XFC,0XFC,0XFC,0XF8,0XF2,0XE0,0X04,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X06,
-// 0X0D,0X1B,0X06,0X04,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0XF0,0XF0,0X00,0X70,0X00,0X00,0XF0,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0XF9,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFC,
-// 0XFC,0XFE,0XFF,0X7F,0X7F,0X3F,0X0F,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X70,0X00,0X00,0XF0,0X00,0X70,0X70,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X0F,0X0F,0X00,0X0E,0X00,0X00,0X0F,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X9F,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0X0F,0X07,0X03,0X01,0X01,0X80,0XC0,
-// 0XC0,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X0E,0X00,0X00,0X0F,0X00,0X0E,0X0E,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X80,0X20,0X60,0XC8,0X90,
-// 0X20,0X40,0X80,0X00,0X01,0X03,0X07,0X0F,0X2F,0X1C,0X10,0X20,0X20,0X00,0X00,0X81,
-// 0X81,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,
-// 0X90,0XC8,0X60,0X20,0X80,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X02,0X08,0X18,
-// 0X32,0X06,0X0C,0X01,0X02,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X90,0X90,0X90,0X00,
-// 0X00,0X90,0X90,0X90,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X03,0X0D,0X06,0X32,
-// 0X18,0X0C,0X06,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X06,0X06,0X00,
-// 0X00,0X06,0X06,0X06,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_bgg[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X20,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,
-// 0XC0,0XE0,0XF0,0XF8,0XF8,0XFC,0XFE,0XFE,0XFE,0XFF,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,
-// 0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFE,0XFE,0XFC,0XFC,0XF8,0XF8,0XF0,0XF0,
-// 0XE0,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X70,0X7E,0X3F,
-// 0X3F,0X0F,0X0F,0X07,0X03,0X01,0X01,0X00,0X38,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-// 0XFF,0XFF,0XFF,0XCF,0X07,0X03,0X03,0X03,0X03,0X87,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,
-// 0XFF,0XFF,0XFF,0XFF,0XFE,0XF8,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XBE,0X80,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X0F,0X1F,0X1F,0X3F,0X3F,0X3F,
-// 0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-// 0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XD0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XC1,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XE0,0XE0,0XE0,0XE0,0XC0,0X00,
-// 0X00,0X00,0X00,0X01,0X01,0X03,0X07,0X0F,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-// 0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0X1F,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X0F,0X3E,
-// 0X7C,0X78,0XF8,0XF0,0XE0,0XE0,0XC0,0XC0,0X81,0X07,0X87,0X0F,0X07,0X07,0X07,0X01,
-// 0X00,0X00,0X00,0X80,0X80,0XC0,0XE0,0XF0,0XFC,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-// 0XFF,0XFF,0X3F,0X1F,0X07,0X03,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X01,0X01,0X07,0X07,0X0F,0X1F,0X1F,0X3F,0X3F,0X3F,0X7F,0X7F,0X7F,0X7F,
-// 0X7F,0X7F,0X7F,0X7F,0X7F,0X3F,0X3F,0X3F,0X1F,0X1F,0X1F,0X0F,0X0F,0X07,0X03,0X01,
-// 0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_xbg[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X20, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0XE0,0XF0,0XF0,0XF0,0XF0,0XF0,
-// 0XF0,0XF0,0XF0,0XF0,0XF0,0XE0,0XE0,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X88,0X07,0X07,0X03,0X01,0X00,0X1E,0X3F,0X7F,0X7F,
-// 0XFF,0XFF,0XF1,0XF1,0XF1,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XF8,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X18,0X70,0X60,0XC0,0X80,0X80,0X18,0X38,0X38,0X18,
-// 0X00,0X00,0X81,0XC3,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0X1F,0X07,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X07,0X07,0X07,0X07,
-// 0X0F,0X07,0X07,0X07,0X07,0X03,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_calendar[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,
-// 0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0X03,0X03,0X83,0X03,0X03,0X03,0X03,0X03,0X03,
-// 0X03,0XF3,0X73,0X73,0X03,0X73,0X73,0X73,0X03,0X03,0XFF,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0X00,0X00,0X3B,0X3B,0X3B,0X00,0X3B,0X3B,0X3B,
-// 0X00,0X3B,0X3B,0X3B,0X00,0X03,0X03,0X03,0X00,0X00,0XFF,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,
-// 0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_clock[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-// 0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X60,0X30,0X30,0X18,0X18,0X0C,0X0C,0X0C,0X0C,
-// 0X0C,0X0C,0X0C,0X08,0X18,0X18,0X30,0X30,0X60,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0XF0,0XFC,0X0F,0X03,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X0F,0XFC,0XE0,0X00,0X00,
-// 0X00,0X00,0X07,0X1F,0X78,0XE0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X01,
-// 0X01,0X01,0X01,0X01,0X01,0X01,0X00,0X00,0X00,0X80,0XE0,0X78,0X1F,0X03,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X06,0X06,0X0C,0X0C,0X18,0X18,0X18,0X18,
-// 0X18,0X18,0X18,0X18,0X0C,0X0C,0X06,0X06,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_flashlight[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X10,0X60,0X80,0X00,0X00,0X00,0X7C,
-// 0X3C,0X00,0X00,0X00,0XC0,0X60,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0E,0X1E,0X32,0XC2,0X82,0X82,0X82,0X82,
-// 0X82,0X82,0X82,0X82,0XE2,0X32,0X1E,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFD,0X05,0X05,0XE5,
-// 0XE5,0X05,0X05,0XFD,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0X10,0X10,0X10,
-// 0X10,0X10,0X10,0X1F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_stopwatch[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1E, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XBE,0X3E,0X32,0XF2,0XF2,0X02,
-// 0X02,0XF2,0XF2,0X32,0X3E,0XBE,0X00,0X00,0X00,0X80,0XD0,0X78,0X70,0X60,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0XE0,0X78,0X1C,0X0E,0X03,0X03,0X01,0X01,0X00,0X01,0X01,0XF8,
-// 0XF8,0X01,0X01,0X00,0X01,0X01,0X03,0X07,0X0E,0X3C,0XF0,0XE0,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X0F,0X7F,0XF0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X07,
-// 0X07,0X06,0X06,0X06,0X06,0X06,0X06,0X06,0X00,0XC0,0XF9,0X39,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X07,0X06,0X0C,0X0C,0X18,0X18,0X10,0X30,0X30,
-// 0X30,0X30,0X10,0X18,0X18,0X0C,0X0C,0X06,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-const unsigned char gImage_setting[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1E, */
-0X00,0X00,0X00,0X00,0X80,0X80,0XC0,0XC0,0XE0,0XE0,0X70,0X30,0X38,0X38,0X1C,0X0C,
-0X0C,0X1C,0X38,0X38,0X70,0X70,0XE0,0XE0,0XC0,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0XFE,0XFF,0XFF,0X01,0X01,0X00,0X00,0X00,0XF0,0XF8,0X38,0X1C,0X0C,
-0X0C,0X1C,0X38,0XF8,0XF0,0X00,0X00,0X00,0X01,0X01,0XFF,0XFF,0XFE,0X00,0X00,0X00,
-0X00,0X00,0X00,0X1F,0X3F,0X7F,0X60,0XE0,0XC0,0XC0,0X80,0X81,0X03,0X07,0X0E,0X0E,
-0X0E,0X0E,0X07,0X03,0X81,0X80,0XC0,0XE0,0XE0,0X70,0X7F,0X3F,0X1F,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X01,0X03,0X03,0X07,0X06,0X0E,
-0X0E,0X06,0X07,0X03,0X03,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_TandH[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-0X00,0X00,0X00,0X00,0XF8,0XFC,0X0E,0X06,0X07,0X06,0X06,0XFE,0XFC,0XE0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0XF0,0XF0,0XF0,0XC0,0X80,0X00,0X00,0X00,0X00,
-0X40,0XF8,0XFE,0X0F,0X43,0XF3,0XF8,0XF8,0XFC,0XFC,0XF8,0XF9,0XF3,0X07,0X1E,0XFC,
-0XF0,0X00,0XE0,0XF8,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XF8,0XE0,0X00,
-0X00,0X03,0X0F,0X1E,0X18,0X39,0X33,0X37,0X77,0X77,0X33,0X33,0X39,0X1C,0X0F,0X07,
-0X01,0X00,0X07,0X0F,0X1F,0X3F,0X3F,0X3F,0X7F,0X3F,0X3F,0X3F,0X1F,0X0F,0X07,0X00,
-};
-const unsigned char gImage_sun[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X70,0X40,
-0X00,0X00,0X00,0X00,0X80,0XC0,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X80,0X80,0X83,0X03,0XF2,0X18,0X04,0X06,0X03,0X03,0X01,
-0X01,0X01,0X03,0X02,0X06,0X0D,0XF0,0X00,0X10,0X10,0X10,0X10,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X01,0X01,0X60,0X30,0X33,0X0E,0X18,0X10,0X30,0XA0,0XA0,
-0X20,0X20,0X20,0X10,0XD8,0XCC,0X07,0X00,0X0C,0X08,0X18,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X00,
-0X00,0X00,0X00,0X00,0X00,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_moon[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X18,0XF0,0XF0,0X60,0XE0,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X80,0XC0,0XF0,0X3E,0X0F,0X01,0X00,0X00,0X01,0X07,0X1F,0XFC,0XE0,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X18,0X78,0XF8,0XD8,0X98,0X18,0X18,0X0C,0X0C,0X0E,0X06,0X03,
-0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0XF0,0X3C,0X1F,0X03,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X03,0X06,0X06,0X04,0X0C,0X0C,0X0C,
-0X0C,0X0C,0X0C,0X06,0X06,0X06,0X03,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-// const unsigned char gImage_bell[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0XC0,0X60,0X20,0X30,0X30,0X38,
-// 0X38,0X30,0X30,0X60,0X60,0XC0,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0XFC,0XFF,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X07,0XFE,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X80,0X80,0X80,0XFF,0XFF,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,
-// 0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0XFF,0XFF,0X80,0X80,0X80,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X07,0X07,0X0D,0X0D,0X19,
-// 0X09,0X0D,0X0D,0X07,0X03,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X00,0X00,0X00,
-// };
-const unsigned char gImage_list[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-0X00,0X00,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,
-0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X20,0X00,0X00,0X00,
-0X00,0X00,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,
-0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,
-0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X00,0X00,0X00,
-};
-const unsigned char gImage_new[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0XFF,
-0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XFF,0XFF,
-0XFF,0XFF,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,0XC0,
-0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0XFF,0XFF,
-0XFF,0XFF,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,0X01,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X7F,0X7F,
-0X7F,0X7F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-// const unsigned char gImage_add[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X60,0X30,0X30,0X18,0X18,0X18,0X08,0X08,
-// 0X08,0X08,0X18,0X18,0X18,0X30,0X30,0X60,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0XF8,0X3E,0X07,0X01,0X00,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0XFF,
-// 0XFF,0X80,0X80,0X80,0X80,0X80,0X80,0X80,0X00,0X01,0X07,0XFE,0XF0,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X0F,0X3E,0X70,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X7F,
-// 0X7F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X70,0X3F,0X07,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X06,0X06,0X0C,0X0C,0X0C,0X08,0X08,
-// 0X08,0X08,0X0C,0X0C,0X04,0X06,0X06,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_step[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X1F, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0XC0,0XC0,0XC0,0XC0,0X80,0X00,0X00,
-// 0X00,0X00,0XF0,0XF0,0XF8,0XF8,0XF8,0XF8,0XF0,0XE0,0X80,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0XFC,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0X00,0X00,
-// 0X00,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X1F,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X8F,0X8F,0X8F,0X8F,0X8F,0X8F,0X0F,0X03,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X01,0X73,0XF3,0XF3,0XF1,0XF1,0XF1,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X07,0X0F,0X0F,0X0F,0X07,0X01,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X01,0X01,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// };
-// const unsigned char gImage_test[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X20, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X30,0X30,0XF0,0XF0,0X30,0X30,0X30,
-// 0X30,0X30,0X30,0XF0,0XF0,0X30,0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XE0,0XF8,0X3F,0X0F,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X0F,0X3F,0XF8,0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0XC0,0XF0,0X3C,0X0F,0X0F,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,
-// 0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0F,0X0F,0X3C,0XF0,0XC0,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X07,0X0F,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,
-// 0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0F,0X07,0X00,0X00,0X00,0X00,0X00,
-// };
+static const uint8_t gImage_moon_data[71] = {
+    0x51, 0x00, 0x06, 0x18, 0xF0, 0xF0, 0x60, 0xE0, 0xC0, 0x80, 0x54, 0x00, 0x0C, 0x80, 0xC0, 0xF0,
+    0x3E, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x07, 0x1F, 0xFC, 0xE0, 0x45, 0x00, 0x0D, 0x18, 0x78, 0xF8,
+    0xD8, 0x98, 0x18, 0x18, 0x0C, 0x0C, 0x0E, 0x06, 0x03, 0x03, 0x01, 0x43, 0x00, 0x05, 0x80, 0xC0,
+    0xF0, 0x3C, 0x1F, 0x03, 0x48, 0x00, 0x05, 0x01, 0x03, 0x03, 0x06, 0x06, 0x04, 0x44, 0x0C, 0x41,
+    0x06, 0x00, 0x03, 0x40, 0x01, 0x45, 0x00,
+};
+const oled_bitmap_t gImage_moon = {gImage_moon_data, 32, 32, 0};
 
-const unsigned char gImage_lightQD[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X20, */
-0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XC0,0X80,0X00,0X00,0X00,0X00,0X80,0X98,0XBC,
-0XBC,0X80,0X80,0X00,0X00,0X00,0X00,0XC0,0XC0,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X80,0XC0,0XC0,0X80,0X01,0XE1,0XF9,0XFC,0X1E,0X0F,0X07,0X03,0X03,0X03,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFC,0XF9,0XC1,0X00,0X80,0XC0,0XC0,0X00,0X00,0X00,
-0X00,0X00,0X01,0X01,0X01,0X01,0X80,0X87,0X9F,0X3F,0X78,0XF0,0XE0,0XE0,0XC0,0XC0,
-0XFF,0XFF,0XFF,0XFF,0X7F,0X7F,0X3F,0X8F,0X83,0X80,0X01,0X01,0X01,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X19,0X3D,
-0X1D,0X01,0X00,0X00,0X00,0X00,0X00,0X03,0X03,0X03,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_tjbg1[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X93,0X93,0X93,0X93,0X00,
-0X00,0X93,0X93,0X93,0X93,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X30,0X98,0XCC,0X66,0X63,0X01,0X8C,0X06,0X23,
-0X32,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X80,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X80,0X80,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X32,
-0X67,0XCE,0X8C,0X01,0X63,0XE0,0XC8,0X98,0X30,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X06,0X03,0X01,0X00,0X00,
-0X00,0X00,0X28,0X04,0X00,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XC0,
-0XC0,0XC0,0X00,0X00,0X00,0X01,0X03,0X0E,0XFE,0XFD,0XFC,0XF8,0XF0,0XE0,0X80,0X40,
-0X00,0X00,0X01,0X03,0X06,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X78,0X78,0X00,0XF8,0XF8,0X00,0X00,0X78,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X08,
-0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X01,
-0X01,0X01,0X00,0X80,0X80,0XC0,0XE0,0XF8,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XF8,0X00,0X00,0X78,0X00,0X00,0XF8,0XF8,
-0X1E,0X1E,0X00,0X1F,0X1F,0X00,0X00,0X1E,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X00,
-0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XF0,0XF8,0XFC,0XFE,0XFE,0XFF,0X7F,0X7F,
-0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,
-0X1F,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0X00,0X00,0X1E,0X00,0X00,0X1F,0X1F,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X00,0X08,0X10,0X20,0X00,0X00,0X00,0X07,0X9F,0X3F,0X7F,0XFF,0XFF,0XFF,0XFC,0XFC,
-0XFC,0XFC,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0X3F,0X3F,0X1F,0X2F,0X17,0X01,0X00,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X0C,0X1C,0X39,0X73,0XE6,0XCC,0X98,0X31,0X60,0XC4,
-0X0C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X00,0X01,0X01,0X01,0X01,
-0X01,0X01,0X01,0X01,0X01,0X02,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X4C,
-0XE6,0X73,0X39,0X9C,0XCE,0X07,0X13,0X19,0X0C,0X04,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XD9,0XD9,0XD9,0XD9,0XD9,
-0XD9,0XD9,0XD9,0XD9,0XD9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_tjbg2[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9B,0X9B,0X9B,0X9B,0X03,
-0X03,0X9B,0X9B,0X9B,0X9B,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X30,0X38,0X9C,0XC8,0X61,0X33,0X19,0X8C,0X06,0X23,
-0X30,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X80,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X32,
-0X27,0X8E,0X8C,0X21,0X73,0XE0,0XCC,0X98,0X30,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X03,0X01,0X00,0X00,
-0X00,0X10,0X08,0X04,0X02,0X00,0X00,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X00,0X04,0X00,0X10,0X20,0X80,0X40,
-0X00,0X00,0X01,0X03,0X06,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0XF8,0XF8,0X00,0XF8,0XF8,0X00,0X00,0X78,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X00,
-0X01,0X00,0X00,0X00,0X80,0XC0,0XC0,0XC0,0XE0,0XE0,0XE0,0XE0,0XC0,0XC0,0X80,0X80,
-0X00,0X00,0X00,0X00,0X06,0X0F,0X0F,0X06,0X00,0X00,0X00,0X00,0X80,0XC0,0XFF,0XFE,
-0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0XF8,0XF8,0X00,0X00,0X78,0X00,0X00,0X78,0X78,
-0X1F,0X1F,0X00,0X1F,0X1F,0X00,0X00,0X1E,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X10,
-0X80,0XF0,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0X0F,0X0F,0X9F,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFE,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFE,0XFF,0XFF,0XFF,0XFF,0X7F,
-0X8F,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0X1F,0X00,0X00,0X1E,0X00,0X00,0X1E,0X1E,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X00,0X00,0X07,0X0F,0X1F,0X3F,0XBF,0X7F,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0X7F,0XBF,0X1F,0X1F,0X0F,0X03,0X01,0X02,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X0C,0X19,0X33,0X67,0XCE,0X9C,0X39,0X73,0XE6,
-0X4C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X81,0X81,0X81,0X81,0X81,
-0X81,0X81,0X81,0X81,0X80,0X00,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X4C,
-0XE6,0X73,0X31,0X80,0XC6,0X67,0X33,0X19,0X0C,0X04,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC9,0XC9,0XC9,0XC9,0X09,
-0X09,0XC9,0XC9,0XC9,0XC9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_tjbg3[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9B,0X9B,0X9B,0X9B,0X18,
-0X18,0X9B,0X9B,0X9B,0X9B,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X30,0X38,0X9C,0XCE,0X67,0X33,0X19,0X8C,0X06,0X23,
-0X30,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X80,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X32,
-0X27,0X0E,0X8C,0X01,0X23,0X66,0XCC,0X98,0X30,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X03,0X01,0X00,0X00,
-0X00,0X00,0X08,0X04,0X02,0X80,0X80,0X80,0X81,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X00,0X04,0X00,0X04,0X28,0X00,0X00,
-0X00,0X00,0X01,0X03,0X06,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0XF8,0XF8,0X00,0XF8,0XF8,0X00,0X00,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0XF0,
-0XF9,0XFC,0XFE,0XFF,0XFF,0XFF,0X3F,0X3F,0X3F,0XFF,0XFF,0XFF,0XFE,0XFC,0XF8,0XE0,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XC0,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,
-0X08,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X78,0X00,0X00,0X78,0X00,0X00,0X78,0X78,
-0X1F,0X1F,0X00,0X1F,0X1F,0X00,0X00,0X1F,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X1F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0XFC,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF8,0XE0,0XC0,0X80,0X80,0X00,0X00,0X03,0X03,0X03,0X00,0X00,0X80,0X80,0XC0,0X60,
-0X18,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X1E,0X00,0X00,0X1E,0X00,0X00,0X1E,0X1E,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X00,0X01,0X17,0X2F,0X1F,0X3F,0X3F,0X7F,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0X7F,0XBF,0X3F,0X1F,0X0F,0X07,0X01,0X02,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X0C,0X19,0X13,0X07,0XCE,0X9C,0X39,0X73,0XE6,
-0X4C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X01,0X01,0X01,0X01,0X01,
-0X01,0X01,0X01,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X4C,
-0XE6,0X73,0X31,0X80,0XC6,0X07,0X13,0X19,0X0C,0X04,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC9,0XC9,0XC9,0XC9,0XC1,
-0XC1,0XC9,0XC9,0XC9,0XC9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_tjbg4[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9B,0X9B,0X9B,0X9B,0X1B,
-0X1B,0X9B,0X9B,0X9B,0X9B,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X30,0X98,0XCC,0X66,0X33,0X19,0X8C,0XC6,0X63,
-0X32,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X80,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X80,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X30,
-0X23,0X06,0X8C,0X19,0X73,0XE0,0XC8,0X98,0X30,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X03,0X01,0X00,0X00,
-0X00,0X80,0XE8,0XF4,0XF8,0XFC,0XFC,0XFC,0XFF,0XFE,0XFE,0XFE,0XFC,0XFC,0XFC,0XF8,
-0XF0,0XC0,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X00,0X04,0X00,0X04,0X28,0X00,0X00,
-0X00,0X00,0X01,0X03,0X06,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X78,0X78,0X00,0X00,0XF8,0X00,0X00,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0XF8,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0XF0,0XF0,0XF9,0XFF,0XFF,0XFF,0XFF,
-0XFF,0X3F,0X07,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,
-0X08,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X78,0X00,0X00,0X78,0X00,0X00,0XF8,0XF8,
-0X1E,0X1E,0X00,0X00,0X1F,0X00,0X00,0X1F,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X1F,
-0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X03,0X01,
-0X00,0X00,0X00,0X00,0X60,0XF0,0XF0,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X10,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X1E,0X00,0X00,0X1E,0X00,0X00,0X1F,0X1F,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X02,0X01,0X07,0X0F,0X1F,0X3F,0XBF,0X7F,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0XF8,
-0XF0,0XE0,0XC0,0XC0,0XC0,0XC0,0XC0,0X40,0X40,0X80,0X20,0X10,0X08,0X04,0X00,0X02,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X0C,0X19,0X33,0X67,0XC6,0X90,0X39,0X73,0XE6,
-0X4C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X00,0X80,0X81,0X81,0X81,0X81,
-0X81,0X81,0X81,0X81,0X80,0X00,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X4C,
-0XE4,0X70,0X31,0X80,0XC6,0X07,0X13,0X19,0X0C,0X04,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC9,0XC9,0XC9,0XC9,0X01,
-0X01,0XC9,0XC9,0XC9,0XC9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_tjbg5[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9B,0X9B,0X9B,0X9B,0X9B,
-0X9B,0X9B,0X9B,0X9B,0X9B,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X30,0X98,0XC8,0XE0,0X73,0X39,0X9C,0XCE,0X67,
-0X32,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X80,0X80,0X80,0X80,0X80,
-0X80,0X80,0X80,0X80,0X00,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X30,
-0X23,0X06,0X8C,0X19,0X33,0X67,0XCE,0X9C,0X38,0X30,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X06,0X03,0X01,0X00,0X00,
-0X00,0X80,0XE8,0XF4,0XF8,0XFC,0XFC,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X3F,0X3F,
-0X3F,0X3F,0XFF,0XFF,0XFF,0XFE,0XFC,0XF9,0XE0,0X00,0X00,0X00,0X04,0X08,0X10,0X00,
-0X00,0X00,0X01,0X03,0X06,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0XF8,0XF8,0X00,0X00,0X78,0X00,0X00,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0XF8,
-0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,
-0XFE,0XFE,0XFF,0X7F,0X7F,0X3F,0X1F,0X0F,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X01,
-0X00,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X78,0X00,0X00,0XF8,0XF8,0X00,0X78,0X78,
-0X1F,0X1F,0X00,0X00,0X1E,0X00,0X00,0X1F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,
-0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X1F,0X07,0X03,0X01,0X01,0X00,0X80,0X80,
-0X80,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,
-0X10,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X1E,0X00,0X00,0X1F,0X1F,0X00,0X1E,0X1E,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X02,0X01,0X07,0X0F,0X1F,0X3F,0XBF,0X7F,0X70,0XC0,0X80,0X00,0X00,0X00,0X03,0X03,
-0X03,0X03,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X20,0X14,0X00,0X00,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X0C,0X19,0X13,0X07,0XC6,0X80,0X31,0X73,0XE6,
-0X4C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X01,0X01,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X01,0X02,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X4C,
-0XC4,0X60,0X31,0X80,0XC6,0X66,0X33,0X19,0X0C,0X04,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC9,0XC9,0XC9,0XC9,0X00,
-0X00,0XC9,0XC9,0XC9,0XC9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_tjbg6[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9B,0X9B,0X9B,0X9B,0X98,
-0X98,0X9B,0X9B,0X9B,0X9B,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X30,0X98,0XCC,0X66,0X23,0X01,0X8C,0XC6,0X63,
-0X30,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X80,0X80,0X80,0X80,0X80,
-0X80,0X80,0X80,0X80,0X80,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X30,
-0X63,0XC6,0X8C,0X19,0X33,0X66,0XCC,0X98,0X30,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X03,0X01,0X00,0X00,
-0X00,0X80,0XE8,0XF4,0XF8,0XFC,0XFC,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFC,0XFC,0XF8,0XF4,0XE8,0X00,0X00,
-0X00,0X00,0X01,0X03,0X06,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X78,0X78,0X00,0X00,0X78,0X00,0X00,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0XF8,
-0XFF,0XFF,0XFF,0XFF,0X7F,0X7F,0X3F,0X3F,0X3F,0X3F,0X3F,0X3F,0X3F,0X3F,0X7F,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XF9,0XF0,0XF0,0XF9,0XFF,0XFF,0XFF,0XFF,0XFF,0X3F,0X0F,0X01,
-0X08,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X78,0X00,0X00,0XF8,0X00,0X00,0XF8,0XF8,
-0X1E,0X1E,0X00,0X00,0X1E,0X00,0X00,0X1F,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X1F,
-0X7F,0XFF,0X03,0X00,0X00,0X00,0X00,0X00,0X60,0XF0,0XF0,0X60,0X00,0X00,0X00,0X00,
-0X01,0X01,0X03,0X03,0X03,0X03,0X03,0X03,0X03,0X03,0X01,0X01,0X00,0X00,0X00,0X00,
-0X10,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X1E,0X00,0X00,0X1F,0X00,0X00,0X1F,0X1F,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X02,0X01,0X04,0X08,0X10,0X20,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X20,0X10,0X08,0X04,0X00,0X02,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X0C,0X19,0X13,0X07,0XC6,0X80,0X31,0X70,0XE4,
-0X4C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X00,0X80,0X80,0X80,0X80,0X00,
-0X00,0X80,0X80,0X80,0X80,0X00,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X4C,
-0XE4,0X70,0X39,0X9C,0XCE,0X07,0X13,0X19,0X0C,0X04,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC9,0XC9,0XC9,0XC9,0XC0,
-0XC0,0XC9,0XC9,0XC9,0XC9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-const unsigned char gImage_tjbg7[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X93,0X93,0X93,0X93,0X83,
-0X83,0X93,0X93,0X93,0X93,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X30,0X98,0XC8,0XE0,0X63,0X01,0X8C,0XCE,0X67,
-0X32,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X80,0X80,0X80,0X80,
-0X80,0X80,0X80,0X80,0X80,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X32,
-0X67,0XCE,0X9C,0X39,0X73,0XE0,0XC8,0X98,0X30,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X06,0X03,0X01,0X00,0X00,
-0X40,0X80,0XE0,0XF0,0XF8,0XFC,0XFD,0XFE,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFE,0XFC,0XFC,0XF8,0XF4,0XE8,0X80,0X00,
-0X00,0X00,0X01,0X03,0X06,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X78,0X78,0X00,0X00,0X78,0X00,0X00,0X78,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X18,
-0X06,0X03,0X01,0X01,0X00,0X00,0XC0,0XC0,0XC0,0X00,0X00,0X01,0X01,0X03,0X07,0X1F,
-0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0X3F,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF8,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0XF8,0X00,0X00,0XF8,0XF8,0X00,0XF8,0XF8,
-0X1E,0X1E,0X00,0X00,0X1E,0X00,0X00,0X1E,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X10,
-0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X03,0X03,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X07,0X1F,0X3F,0X7F,0XFF,0XFF,0XFF,0XFC,0XFC,0XFC,0XFF,0XFF,0XFF,0X7F,0X3F,0X9F,
-0X0F,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0X00,0X00,0X1F,0X1F,0X00,0X1F,0X1F,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X00,0X00,0X14,0X20,0X00,0X20,0X00,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X81,0X01,0X01,0X01,0X40,0X20,0X10,0X00,0X00,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X0C,0X19,0X33,0X66,0XC4,0X80,0X31,0X70,0XE4,
-0X4C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X01,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X02,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X0C,
-0XC4,0X60,0X31,0X98,0XCC,0XE6,0X73,0X39,0X1C,0X0C,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XD9,0XD9,0XD9,0XD9,0X18,
-0X18,0XD9,0XD9,0XD9,0XD9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+static const uint8_t gImage_list_data[14] = {
+    0x40, 0x00, 0x59, 0x20, 0x43, 0x00, 0x59, 0x80, 0x63, 0x00, 0x59, 0x02, 0x41, 0x00,
 };
+const oled_bitmap_t gImage_list = {gImage_list_data, 32, 32, 0};
 
-const unsigned char gImage_tjbg8[512] = { /* 0X32,0X01,0X00,0X40,0X00,0X40, */
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X9B,0X9B,0X9B,0X9B,0X80,
-0X80,0X9B,0X9B,0X9B,0X9B,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X30,0X98,0XC8,0X60,0X23,0X01,0X8C,0X06,0X23,
-0X30,0X18,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X80,0X80,0X80,0X80,0X80,
-0X80,0X80,0X80,0X80,0X80,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X08,0X18,0X30,
-0X63,0XC6,0X8C,0X01,0X23,0X66,0XCC,0X98,0X30,0X20,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X03,0X01,0X00,0X00,
-0X00,0X00,0X28,0X04,0X00,0X04,0X00,0X02,0X03,0X01,0X01,0X03,0X03,0X03,0X07,0X07,
-0X1F,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFC,0XFC,0XF8,0XF4,0XE8,0X80,0X00,
-0X00,0X00,0X01,0X03,0X06,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0XF8,0XF8,0X00,0X00,0X78,0X00,0X00,0X78,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X08,
-0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X0F,0X0F,0X06,0X00,0X00,0X00,0X00,
-0X80,0XC0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-0XF8,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0XF8,0X00,0X00,0XF8,0X00,0X00,0X78,0X78,
-0X1F,0X1F,0X00,0X00,0X1E,0X00,0X00,0X1E,0X00,0X00,0X00,0X00,0X00,0X00,0X20,0X10,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X60,0XFC,0XFF,
-0XFF,0XFF,0XFF,0XFF,0X9F,0X0F,0X0F,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,
-0X1F,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X1F,0X00,0X00,0X1F,0X00,0X00,0X1E,0X1E,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X60,0XC0,0X80,0X00,0X00,
-0X02,0X00,0X04,0X08,0X10,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X03,0X0F,
-0X1F,0X1F,0X3F,0X3F,0X3F,0X7F,0X7F,0X3F,0X3F,0XBF,0X3F,0X1F,0X0F,0X07,0X01,0X02,
-0X00,0X00,0X80,0XC0,0X60,0X00,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X0C,0X19,0X13,0X07,0XCE,0X9C,0X39,0X70,0XE4,
-0X4C,0X18,0X10,0X00,0X00,0X00,0X00,0X00,0X01,0X00,0X00,0X80,0X80,0X80,0X80,0X00,
-0X00,0X80,0X80,0X80,0X80,0X00,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X10,0X18,0X4C,
-0XE6,0X73,0X39,0X9C,0XCE,0X67,0X33,0X19,0X0C,0X04,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC9,0XC9,0XC9,0XC9,0XC8,
-0XC8,0XC9,0XC9,0XC9,0XC9,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-extern const unsigned char *tjbg[]=
-{
-gImage_tjbg1,
-gImage_tjbg2,
-gImage_tjbg3,
-gImage_tjbg4,
-gImage_tjbg5,
-gImage_tjbg6,
-gImage_tjbg7,
-gImage_tjbg8
+static const uint8_t gImage_new_data[24] = {
+    0x4C, 0x00, 0x42, 0xFF, 0x4C, 0x00, 0x4C, 0xC0, 0x42, 0xFF, 0x4C, 0xC0, 0x4C, 0x01, 0x42, 0xFF,
+    0x4C, 0x01, 0x4C, 0x00, 0x42, 0x7F, 0x4C, 0x00,
 };
-const unsigned char gImage_wifi[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X20, */
-0X00,0X00,0X00,0X00,0X80,0X80,0XC0,0XC0,0XE0,0XE0,0XE0,0XF0,0XF0,0XF0,0XF0,0XF0,
-0XF0,0XF0,0XF0,0XF0,0XF0,0XE0,0XE0,0XE0,0XC0,0XC0,0X80,0X80,0X00,0X00,0X00,0X00,
-0X08,0X1C,0X3E,0X3F,0X1F,0X0F,0X07,0X07,0X83,0XC3,0XC1,0XC1,0XE1,0XE1,0XE0,0XE0,
-0XE0,0XE0,0XE1,0XE1,0XE1,0XC1,0XC3,0X83,0X07,0X07,0X0F,0X1F,0X3F,0X3E,0X1C,0X08,
-0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X07,0X0F,0X0F,0X07,0X03,0X83,0XC1,0XC1,0XE1,
-0XE1,0XC1,0XC1,0X83,0X03,0X07,0X0F,0X0F,0X07,0X02,0X00,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X07,
-0X07,0X03,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-};
-// const unsigned char gImage_pm25[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X20, */
-// 0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0XE0,0XC0,0XC0,0X80,0X00,0X00,0X00,0X60,0X20,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X00,0X18,0X18,0X18,0X18,0X18,0X18,0X18,0X18,0X18,0X18,0X18,
-// 0X18,0X1C,0X0F,0X07,0X00,0X00,0X0C,0X8C,0XFC,0XF8,0X00,0X00,0X00,0X18,0X18,0X00,
-// 0X00,0X03,0X03,0X03,0XC3,0XC3,0X43,0XC3,0X00,0XC0,0X80,0X00,0XC3,0XC3,0X03,0X03,
-// 0X03,0X43,0XC3,0X83,0X03,0X03,0X03,0X03,0XC1,0XC0,0X40,0X08,0X18,0X00,0X00,0X00,
-// 0X00,0X00,0X00,0X00,0X07,0X07,0X01,0X01,0X00,0X07,0X03,0X07,0X07,0X07,0X00,0X00,
-// 0X04,0X06,0X07,0X05,0X00,0X04,0X04,0X00,0X05,0X05,0X07,0X00,0X00,0X00,0X00,0X00,
-// };
-const unsigned char gImage_bluetooth[128] = { /* 0X32,0X01,0X00,0X20,0X00,0X20, */
-0X00,0X00,0X00,0X00,0X80,0X80,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,
-0XFF,0X02,0X06,0X0C,0X08,0X18,0X30,0X20,0X60,0XC0,0X80,0X80,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X01,0X03,0X02,0X06,0X0C,0X18,0X10,0X30,0X60,0XC0,0XFF,
-0XFF,0XC0,0X60,0X30,0X10,0X18,0X0C,0X06,0X02,0X03,0X01,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X00,0X80,0XC0,0X40,0X60,0X30,0X18,0X08,0X0C,0X06,0X03,0XFF,
-0XFF,0X03,0X06,0X0C,0X08,0X18,0X30,0X60,0X40,0XC0,0X80,0X00,0X00,0X00,0X00,0X00,
-0X00,0X00,0X00,0X00,0X01,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,
-0XFF,0X40,0X60,0X30,0X10,0X18,0X0C,0X04,0X06,0X03,0X01,0X00,0X00,0X00,0X00,0X00,
+const oled_bitmap_t gImage_new = {gImage_new_data, 32, 32, 0};
+
+static const uint8_t gImage_lightQD_data[91] = {
+    0x44, 0x00, 0x02, 0xC0, 0xC0, 0x80, 0x42, 0x00, 0x01, 0x80, 0x98, 0x40, 0xBC, 0x40, 0x80, 0x42,
+    0x00, 0x41, 0xC0, 0x46, 0x00, 0x0A, 0x80, 0xC0, 0xC0, 0x80, 0x01, 0xE1, 0xF9, 0xFC, 0x1E, 0x0F,
+    0x07, 0x41, 0x03, 0x43, 0xFF, 0x05, 0xFE, 0xFC, 0xF9, 0xC1, 0x00, 0x80, 0x40, 0xC0, 0x43, 0x00,
+    0x42, 0x01, 0x05, 0x80, 0x87, 0x9F, 0x3F, 0x78, 0xF0, 0x40, 0xE0, 0x40, 0xC0, 0x42, 0xFF, 0x05,
+    0x7F, 0x7F, 0x3F, 0x8F, 0x83, 0x80, 0x41, 0x01, 0x47, 0x00, 0x02, 0x03, 0x03, 0x01, 0x43, 0x00,
+    0x03, 0x19, 0x3D, 0x1D, 0x01, 0x43, 0x00, 0x41, 0x03, 0x44, 0x00,
+};
+const oled_bitmap_t gImage_lightQD = {gImage_lightQD_data, 32, 32, 0};
+
+static const uint8_t gImage_tjbg1_data[287] = {
+    0x4A, 0x00, 0x01, 0x80, 0xC0, 0x4B, 0x00, 0x42, 0x93, 0x40, 0x00, 0x42, 0x93, 0x4B, 0x00, 0x01,
+    0xC0, 0x80, 0x50, 0x00, 0x0C, 0x20, 0x30, 0x98, 0xCC, 0x66, 0x63, 0x01, 0x8C, 0x06, 0x23, 0x32,
+    0x18, 0x08, 0x45, 0x00, 0x01, 0x40, 0x80, 0x45, 0x00, 0x02, 0x80, 0x80, 0x40, 0x45, 0x00, 0x0C,
+    0x08, 0x18, 0x32, 0x67, 0xCE, 0x8C, 0x01, 0x63, 0xE0, 0xC8, 0x98, 0x30, 0x20, 0x4D, 0x00, 0x04,
+    0x01, 0x00, 0x06, 0x03, 0x01, 0x42, 0x00, 0x03, 0x28, 0x04, 0x00, 0x04, 0x46, 0x00, 0x42, 0xC0,
+    0x41, 0x00, 0x11, 0x01, 0x03, 0x0E, 0xFE, 0xFD, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x40, 0x00, 0x00,
+    0x01, 0x03, 0x06, 0x00, 0x01, 0x47, 0x00, 0x07, 0x78, 0x78, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x78,
+    0x44, 0x00, 0x02, 0x04, 0x08, 0x01, 0x4B, 0x00, 0x42, 0x01, 0x05, 0x00, 0x80, 0x80, 0xC0, 0xE0,
+    0xF8, 0x45, 0xFF, 0x01, 0xFE, 0xF8, 0x45, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF8,
+    0xF8, 0x1E, 0x1E, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x1E, 0x44, 0x00, 0x02, 0x20, 0x00, 0x80, 0x44,
+    0x00, 0x06, 0x80, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0x41, 0x7F, 0x4C, 0xFF, 0x02, 0x7F, 0x1F,
+    0x20, 0x44, 0x00, 0x03, 0x1F, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x40, 0x1F, 0x49, 0x00, 0x02, 0x60,
+    0xC0, 0x80, 0x41, 0x00, 0x02, 0x08, 0x10, 0x20, 0x41, 0x00, 0x03, 0x07, 0x9F, 0x3F, 0x7F, 0x41,
+    0xFF, 0x42, 0xFC, 0x44, 0xFF, 0x06, 0x7F, 0x3F, 0x3F, 0x1F, 0x2F, 0x17, 0x01, 0x41, 0x00, 0x04,
+    0x80, 0xC0, 0x60, 0x00, 0x80, 0x4D, 0x00, 0x0C, 0x0C, 0x1C, 0x39, 0x73, 0xE6, 0xCC, 0x98, 0x31,
+    0x60, 0xC4, 0x0C, 0x18, 0x10, 0x45, 0x00, 0x01, 0x02, 0x00, 0x47, 0x01, 0x00, 0x02, 0x45, 0x00,
+    0x0C, 0x10, 0x18, 0x4C, 0xE6, 0x73, 0x39, 0x9C, 0xCE, 0x07, 0x13, 0x19, 0x0C, 0x04, 0x4F, 0x00,
+    0x00, 0x01, 0x40, 0x03, 0x4B, 0x00, 0x48, 0xD9, 0x4B, 0x00, 0x01, 0x03, 0x01, 0x4A, 0x00,
+};
+const oled_bitmap_t gImage_tjbg1 = {gImage_tjbg1_data, 64, 64, 0};
+
+static const uint8_t gImage_tjbg2_data[193] = {
+    0x8A, 0x01, 0x80, 0xC0, 0x8D, 0x42, 0x9B, 0x40, 0x03, 0x42, 0x9B, 0xA0, 0x06, 0x30, 0x38, 0x9C,
+    0xC8, 0x61, 0x33, 0x19, 0x82, 0x00, 0x30, 0x89, 0x47, 0x00, 0x8B, 0x06, 0x27, 0x8E, 0x8C, 0x21,
+    0x73, 0xE0, 0xCC, 0x82, 0x4E, 0x00, 0x86, 0x03, 0x10, 0x08, 0x04, 0x02, 0x41, 0x00, 0x00, 0x01,
+    0x4C, 0x00, 0x06, 0x01, 0x00, 0x00, 0x04, 0x00, 0x10, 0x20, 0x91, 0x40, 0xF8, 0x8C, 0x00, 0x00,
+    0x83, 0x00, 0x80, 0x41, 0xC0, 0x42, 0xE0, 0x40, 0xC0, 0x40, 0x80, 0x42, 0x00, 0x03, 0x06, 0x0F,
+    0x0F, 0x06, 0x42, 0x00, 0x01, 0x80, 0xC0, 0x88, 0x00, 0xF8, 0x85, 0x40, 0x78, 0x40, 0x1F, 0x8C,
+    0x03, 0x10, 0x80, 0xF0, 0xFE, 0x43, 0xFF, 0x03, 0x9F, 0x0F, 0x0F, 0x9F, 0x43, 0xFF, 0x00, 0xFE,
+    0x46, 0xFC, 0x00, 0xFE, 0x84, 0x00, 0x8F, 0x44, 0x00, 0x00, 0x1F, 0x85, 0x40, 0x1E, 0x88, 0x00,
+    0x80, 0x86, 0x05, 0x00, 0x07, 0x0F, 0x1F, 0x3F, 0xBF, 0x40, 0x7F, 0x4C, 0xFF, 0x08, 0x7F, 0x7F,
+    0xBF, 0x1F, 0x1F, 0x0F, 0x03, 0x01, 0x02, 0x95, 0x0A, 0x04, 0x0C, 0x19, 0x33, 0x67, 0xCE, 0x9C,
+    0x39, 0x73, 0xE6, 0x4C, 0x81, 0x46, 0x00, 0x47, 0x81, 0x03, 0x80, 0x00, 0x00, 0x01, 0x89, 0x04,
+    0x31, 0x80, 0xC6, 0x67, 0x33, 0x93, 0x01, 0x00, 0x01, 0x8D, 0x42, 0xC9, 0x40, 0x09, 0x42, 0xC9,
+    0x9A,
+};
+const oled_bitmap_t gImage_tjbg2 = {gImage_tjbg2_data, 64, 64, OLED_BMP_DELTA};
+
+static const uint8_t gImage_tjbg3_data[131] = {
+    0x9E, 0x40, 0x18, 0xA7, 0x01, 0xCE, 0x67, 0xA5, 0x04, 0x0E, 0x8C, 0x01, 0x23, 0x66, 0x97, 0x42,
+    0x00, 0x82, 0x41, 0x80, 0x00, 0x81, 0x92, 0x01, 0x04, 0x28, 0x40, 0x00, 0x96, 0x00, 0xF8, 0x86,
+    0x03, 0xF0, 0xF9, 0xFC, 0xFE, 0x41, 0xFF, 0x41, 0x3F, 0x41, 0xFF, 0x03, 0xFE, 0xFC, 0xF8, 0xE0,
+    0x45, 0x00, 0x41, 0xC0, 0x44, 0x00, 0x01, 0x08, 0x04, 0x44, 0x00, 0x00, 0x78, 0x8D, 0x00, 0x1F,
+    0x86, 0x00, 0x1F, 0x44, 0xFF, 0x02, 0xFC, 0xFC, 0xFE, 0x45, 0xFF, 0x02, 0xF8, 0xE0, 0xC0, 0x40,
+    0x80, 0x40, 0x00, 0x41, 0x03, 0x07, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x60, 0x18, 0x20, 0x44, 0x00,
+    0x00, 0x1E, 0x97, 0x02, 0x01, 0x17, 0x2F, 0x80, 0x40, 0x3F, 0x92, 0x00, 0x3F, 0x81, 0x00, 0x07,
+    0x9A, 0x01, 0x13, 0x07, 0x8E, 0x00, 0x02, 0x48, 0x01, 0x41, 0x00, 0x8C, 0x01, 0x07, 0x13, 0xA7,
+    0x40, 0xC1, 0x9E,
+};
+const oled_bitmap_t gImage_tjbg3 = {gImage_tjbg3_data, 64, 64, OLED_BMP_DELTA};
+
+static const uint8_t gImage_tjbg4_data[156] = {
+    0x4A, 0x00, 0x00, 0x80, 0x91, 0x40, 0x1B, 0xA4, 0x04, 0x20, 0x30, 0x98, 0xCC, 0x66, 0x82, 0x02,
+    0xC6, 0x63, 0x32, 0x89, 0x00, 0x80, 0x92, 0x07, 0x30, 0x23, 0x06, 0x8C, 0x19, 0x73, 0xE0, 0xC8,
+    0x99, 0x03, 0x80, 0xE8, 0xF4, 0xF8, 0x41, 0xFC, 0x00, 0xFF, 0x41, 0xFE, 0x41, 0xFC, 0x02, 0xF8,
+    0xF0, 0xC0, 0x9D, 0x40, 0x78, 0x40, 0x00, 0x8A, 0x00, 0xF8, 0x46, 0xFF, 0x03, 0xF9, 0xF0, 0xF0,
+    0xF9, 0x43, 0xFF, 0x01, 0x3F, 0x07, 0x4A, 0x00, 0x00, 0x01, 0x8D, 0x40, 0xF8, 0x40, 0x1E, 0x40,
+    0x00, 0x8B, 0x00, 0x7F, 0x4B, 0xFF, 0x01, 0x03, 0x01, 0x42, 0x00, 0x03, 0x60, 0xF0, 0xF0, 0x60,
+    0x46, 0x00, 0x00, 0x10, 0x8C, 0x40, 0x1F, 0x8F, 0x03, 0x02, 0x01, 0x07, 0x0F, 0x81, 0x00, 0xBF,
+    0x86, 0x03, 0xFC, 0xF8, 0xF0, 0xE0, 0x43, 0xC0, 0x07, 0x40, 0x40, 0x80, 0x20, 0x10, 0x08, 0x04,
+    0x00, 0x99, 0x03, 0x33, 0x67, 0xC6, 0x90, 0x8A, 0x03, 0x01, 0x00, 0x00, 0x80, 0x46, 0x81, 0x00,
+    0x80, 0x81, 0x00, 0x01, 0x87, 0x01, 0xE4, 0x70, 0xAC, 0x40, 0x01, 0x9E,
+};
+const oled_bitmap_t gImage_tjbg4 = {gImage_tjbg4_data, 64, 64, OLED_BMP_DELTA};
+
+static const uint8_t gImage_tjbg5_data[163] = {
+    0x9A, 0x44, 0x9B, 0x91, 0x01, 0xC0, 0x80, 0x93, 0x06, 0xC8, 0xE0, 0x73, 0x39, 0x9C, 0xCE, 0x67,
+    0x8A, 0x47, 0x80, 0x00, 0x00, 0x8E, 0x05, 0x33, 0x67, 0xCE, 0x9C, 0x38, 0x30, 0x8E, 0x00, 0x01,
+    0x8C, 0x00, 0xFE, 0x44, 0xFF, 0x42, 0x3F, 0x41, 0xFF, 0x03, 0xFE, 0xFC, 0xF9, 0xE0, 0x40, 0x00,
+    0x81, 0x01, 0x08, 0x10, 0x85, 0x49, 0x00, 0x40, 0xF8, 0x81, 0x00, 0x78, 0x8A, 0x00, 0xFE, 0x4C,
+    0xFF, 0x41, 0xFE, 0x06, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x01, 0x86, 0x00, 0x00, 0x89, 0x40,
+    0xF8, 0x80, 0x40, 0x78, 0x40, 0x1F, 0x81, 0x00, 0x1E, 0x82, 0x45, 0x00, 0x88, 0x05, 0x1F, 0x07,
+    0x03, 0x01, 0x01, 0x00, 0x42, 0x80, 0x4B, 0x00, 0x00, 0x80, 0x8A, 0x40, 0x1F, 0x80, 0x40, 0x1E,
+    0x97, 0x02, 0x70, 0xC0, 0x80, 0x41, 0x00, 0x42, 0x03, 0x46, 0x00, 0x03, 0x20, 0x00, 0x20, 0x14,
+    0x40, 0x00, 0x98, 0x04, 0x13, 0x07, 0xC6, 0x80, 0x31, 0x84, 0x45, 0x00, 0x00, 0x02, 0x40, 0x01,
+    0x45, 0x00, 0x01, 0x01, 0x02, 0x40, 0x00, 0x87, 0x01, 0xC4, 0x60, 0x82, 0x01, 0x66, 0x33, 0xA7,
+    0x40, 0x00, 0x9E,
+};
+const oled_bitmap_t gImage_tjbg5 = {gImage_tjbg5_data, 64, 64, OLED_BMP_DELTA};
+
+static const uint8_t gImage_tjbg6_data[153] = {
+    0x9E, 0x40, 0x98, 0x91, 0x01, 0x80, 0x00, 0x93, 0x07, 0xCC, 0x66, 0x23, 0x01, 0x8C, 0xC6, 0x63,
+    0x30, 0x89, 0x48, 0x80, 0x8A, 0x01, 0x63, 0xC6, 0x82, 0x04, 0x66, 0xCC, 0x98, 0x30, 0x20, 0x4E,
+    0x00, 0x8D, 0x4E, 0xFF, 0x06, 0xFE, 0xFC, 0xFC, 0xF8, 0xF4, 0xE8, 0x00, 0x90, 0x40, 0x78, 0x8D,
+    0x42, 0xFF, 0x40, 0x7F, 0x46, 0x3F, 0x00, 0x7F, 0x43, 0xFF, 0x03, 0xF9, 0xF0, 0xF0, 0xF9, 0x43,
+    0xFF, 0x03, 0x3F, 0x0F, 0x01, 0x08, 0x8A, 0x40, 0x00, 0x40, 0xF8, 0x40, 0x1E, 0x8B, 0x00, 0x20,
+    0x82, 0x00, 0x03, 0x43, 0x00, 0x03, 0x60, 0xF0, 0xF0, 0x60, 0x42, 0x00, 0x40, 0x01, 0x46, 0x03,
+    0x40, 0x01, 0x42, 0x00, 0x8B, 0x40, 0x00, 0x40, 0x1F, 0x91, 0x04, 0x04, 0x08, 0x10, 0x20, 0x80,
+    0x50, 0x00, 0x06, 0x80, 0x20, 0x10, 0x08, 0x04, 0x00, 0x02, 0x9D, 0x01, 0x70, 0xE4, 0x87, 0x00,
+    0x01, 0x40, 0x00, 0x42, 0x80, 0x81, 0x42, 0x80, 0x02, 0x00, 0x00, 0x01, 0x87, 0x06, 0xE4, 0x70,
+    0x39, 0x9C, 0xCE, 0x07, 0x13, 0xA7, 0x40, 0xC0, 0x9E,
+};
+const oled_bitmap_t gImage_tjbg6 = {gImage_tjbg6_data, 64, 64, OLED_BMP_DELTA};
+
+static const uint8_t gImage_tjbg7_data[192] = {
+    0x9A, 0x42, 0x93, 0x40, 0x83, 0x42, 0x93, 0xA3, 0x02, 0xC8, 0xE0, 0x63, 0x81, 0x02, 0xCE, 0x67,
+    0x32, 0x81, 0x46, 0x00, 0x93, 0x07, 0x32, 0x67, 0xCE, 0x9C, 0x39, 0x73, 0xE0, 0xC8, 0x91, 0x00,
+    0x01, 0x85, 0x03, 0x40, 0x80, 0xE0, 0xF0, 0x81, 0x00, 0xFD, 0x40, 0xFE, 0x8D, 0x00, 0xFE, 0x85,
+    0x00, 0x80, 0x86, 0x00, 0x01, 0x8F, 0x00, 0x78, 0x86, 0x02, 0x18, 0x06, 0x03, 0x40, 0x01, 0x40,
+    0x00, 0x41, 0xC0, 0x06, 0x00, 0x00, 0x01, 0x01, 0x03, 0x07, 0x1F, 0x45, 0xFF, 0x00, 0x7F, 0x40,
+    0x3F, 0x44, 0xFF, 0x00, 0xF8, 0x86, 0x00, 0xF8, 0x81, 0x40, 0xF8, 0x89, 0x00, 0x1E, 0x86, 0x00,
+    0x10, 0x44, 0x00, 0x41, 0x03, 0x45, 0x00, 0x03, 0x07, 0x1F, 0x3F, 0x7F, 0x41, 0xFF, 0x41, 0xFC,
+    0x41, 0xFF, 0x03, 0x7F, 0x3F, 0x9F, 0x0F, 0x86, 0x00, 0x1F, 0x81, 0x40, 0x1F, 0x90, 0x42, 0x00,
+    0x06, 0x14, 0x20, 0x00, 0x20, 0x00, 0x00, 0x80, 0x8D, 0x00, 0x81, 0x41, 0x01, 0x02, 0x40, 0x20,
+    0x10, 0x40, 0x00, 0x84, 0x40, 0x00, 0x91, 0x02, 0x33, 0x66, 0xC4, 0x86, 0x45, 0x00, 0x01, 0x02,
+    0x01, 0x47, 0x00, 0x00, 0x02, 0x40, 0x00, 0x86, 0x0A, 0x0C, 0xC4, 0x60, 0x31, 0x98, 0xCC, 0xE6,
+    0x73, 0x39, 0x1C, 0x0C, 0xA0, 0x42, 0xD9, 0x40, 0x18, 0x42, 0xD9, 0x8D, 0x01, 0x03, 0x01, 0x8A,
+};
+const oled_bitmap_t gImage_tjbg7 = {gImage_tjbg7_data, 64, 64, OLED_BMP_DELTA};
+
+static const uint8_t gImage_tjbg8_data[186] = {
+    0x9A, 0x42, 0x9B, 0x40, 0x80, 0x42, 0x9B, 0xA4, 0x01, 0x60, 0x23, 0x81, 0x02, 0x06, 0x23, 0x30,
+    0x88, 0x00, 0x40, 0x93, 0x07, 0x30, 0x63, 0xC6, 0x8C, 0x01, 0x23, 0x66, 0xCC, 0x82, 0x4E, 0x00,
+    0x83, 0x42, 0x00, 0x06, 0x28, 0x04, 0x00, 0x04, 0x00, 0x02, 0x03, 0x40, 0x01, 0x41, 0x03, 0x03,
+    0x07, 0x07, 0x1F, 0x3F, 0x44, 0xFF, 0x8C, 0x49, 0x00, 0x40, 0xF8, 0x8C, 0x01, 0x08, 0x01, 0x45,
+    0x00, 0x03, 0x06, 0x0F, 0x0F, 0x06, 0x42, 0x00, 0x01, 0x80, 0xC0, 0x46, 0xFF, 0x91, 0x40, 0x00,
+    0x40, 0x78, 0x40, 0x1F, 0x8D, 0x4B, 0x00, 0x01, 0x60, 0xFC, 0x43, 0xFF, 0x03, 0x9F, 0x0F, 0x0F,
+    0x9F, 0x45, 0xFF, 0x01, 0x7F, 0x1F, 0x8A, 0x40, 0x00, 0x40, 0x1E, 0x8F, 0x06, 0x02, 0x00, 0x04,
+    0x08, 0x10, 0x00, 0x80, 0x45, 0x00, 0x01, 0x03, 0x0F, 0x40, 0x1F, 0x41, 0x3F, 0x0A, 0x7F, 0x7F,
+    0x3F, 0x3F, 0xBF, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x02, 0x85, 0x00, 0x80, 0x91, 0x04, 0x13, 0x07,
+    0xCE, 0x9C, 0x39, 0x89, 0x00, 0x01, 0x40, 0x00, 0x42, 0x80, 0x81, 0x42, 0x80, 0x02, 0x00, 0x00,
+    0x01, 0x86, 0x0A, 0x4C, 0xE6, 0x73, 0x39, 0x9C, 0xCE, 0x67, 0x33, 0x19, 0x0C, 0x04, 0xA0, 0x42,
+    0xC9, 0x40, 0xC8, 0x42, 0xC9, 0x8D, 0x00, 0x01, 0x4A, 0x00,
+};
+const oled_bitmap_t gImage_tjbg8 = {gImage_tjbg8_data, 64, 64, OLED_BMP_DELTA};
+
+static const uint8_t gImage_wifi_data[83] = {
+    0x42, 0x00, 0x40, 0x80, 0x40, 0xC0, 0x41, 0xE0, 0x48, 0xF0, 0x41, 0xE0, 0x40, 0xC0, 0x40, 0x80,
+    0x42, 0x00, 0x09, 0x08, 0x1C, 0x3E, 0x3F, 0x1F, 0x0F, 0x07, 0x07, 0x83, 0xC3, 0x40, 0xC1, 0x40,
+    0xE1, 0x42, 0xE0, 0x41, 0xE1, 0x0A, 0xC1, 0xC3, 0x83, 0x07, 0x07, 0x0F, 0x1F, 0x3F, 0x3E, 0x1C,
+    0x08, 0x44, 0x00, 0x13, 0x02, 0x07, 0x0F, 0x0F, 0x07, 0x03, 0x83, 0xC1, 0xC1, 0xE1, 0xE1, 0xC1,
+    0xC1, 0x83, 0x03, 0x07, 0x0F, 0x0F, 0x07, 0x02, 0x51, 0x00, 0x05, 0x01, 0x03, 0x07, 0x07, 0x03,
+    0x01, 0x4B, 0x00,
+};
+const oled_bitmap_t gImage_wifi = {gImage_wifi_data, 32, 32, 0};
+
+static const uint8_t gImage_bluetooth_data[91] = {
+    0x42, 0x00, 0x40, 0x80, 0x47, 0x00, 0x0A, 0xFF, 0xFF, 0x02, 0x06, 0x0C, 0x08, 0x18, 0x30, 0x20,
+    0x60, 0xC0, 0x40, 0x80, 0x47, 0x00, 0x15, 0x01, 0x03, 0x02, 0x06, 0x0C, 0x18, 0x10, 0x30, 0x60,
+    0xC0, 0xFF, 0xFF, 0xC0, 0x60, 0x30, 0x10, 0x18, 0x0C, 0x06, 0x02, 0x03, 0x01, 0x48, 0x00, 0x15,
+    0x80, 0xC0, 0x40, 0x60, 0x30, 0x18, 0x08, 0x0C, 0x06, 0x03, 0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x08,
+    0x18, 0x30, 0x60, 0x40, 0xC0, 0x80, 0x47, 0x00, 0x40, 0x01, 0x47, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
+    0x60, 0x30, 0x10, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x43, 0x00,
+};
+const oled_bitmap_t gImage_bluetooth = {gImage_bluetooth_data, 32, 32, 0};
+
+const oled_bitmap_t *const tjbg[8] = {
+    &gImage_tjbg1,
+    &gImage_tjbg2,
+    &gImage_tjbg3,
+    &gImage_tjbg4,
+    &gImage_tjbg5,
+    &gImage_tjbg6,
+    &gImage_tjbg7,
+    &gImage_tjbg8,
 };
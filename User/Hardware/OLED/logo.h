@@ -1,38 +1,29 @@
+/**
+ * @file logo.h
+ * @brief 压缩位图资源声明（由 Tools/asset_packer.py 生成，请勿手工修改），用 OLED_ShowBitmap 显示
+ */
 #ifndef __LOGO_H
 #define __LOGO_H
 
-// 外部变量声明
-// extern const unsigned char gImage_1[1024];
-// extern const unsigned char logo[1024];
-// extern const unsigned char gImage_bg[512];
-// extern const unsigned char gImage_bgg[512] ;
-// extern const unsigned char gImage_xbg[128];
-// extern const unsigned char gImage_calendar[128] ;
-// extern const unsigned char gImage_clock[128] ;
-// extern const unsigned char gImage_flashlight[128];
-extern const unsigned char gImage_setting[128];
-// extern const unsigned char gImage_stopwatch[128];
-extern const unsigned char gImage_TandH[128];
-extern const unsigned char gImage_sun[128] ;
-extern const unsigned char gImage_moon[128];
-// extern const unsigned char gImage_bell[128];
-extern const unsigned char gImage_list[128];
-// extern const unsigned char gImage_new[128];
-// extern const unsigned char gImage_add[128];
-// extern const unsigned char gImage_step[128];
-// extern const unsigned char gImage_test[128];
-extern const unsigned char gImage_lightQD[128] ;
-extern const unsigned char gImage_tjbg1[512];
-extern const unsigned char gImage_tjbg2[512];
-extern const unsigned char gImage_tjbg3[512];
-extern const unsigned char gImage_tjbg4[512];
-extern const unsigned char gImage_tjbg5[512];
-extern const unsigned char gImage_tjbg6[512];
-extern const unsigned char gImage_tjbg7[512] ;
-extern const unsigned char gImage_tjbg8[512];
-extern const unsigned char *tjbg[];
-extern const unsigned char gImage_wifi[128];
-// extern const unsigned char gImage_pm25[128] ;
-extern const unsigned char gImage_bluetooth[128];
+#include "oled.h"
+
+extern const oled_bitmap_t gImage_setting;
+extern const oled_bitmap_t gImage_TandH;
+extern const oled_bitmap_t gImage_sun;
+extern const oled_bitmap_t gImage_moon;
+extern const oled_bitmap_t gImage_list;
+extern const oled_bitmap_t gImage_new;
+extern const oled_bitmap_t gImage_lightQD;
+extern const oled_bitmap_t gImage_tjbg1;
+extern const oled_bitmap_t gImage_tjbg2;
+extern const oled_bitmap_t gImage_tjbg3;
+extern const oled_bitmap_t gImage_tjbg4;
+extern const oled_bitmap_t gImage_tjbg5;
+extern const oled_bitmap_t gImage_tjbg6;
+extern const oled_bitmap_t gImage_tjbg7;
+extern const oled_bitmap_t gImage_tjbg8;
+extern const oled_bitmap_t gImage_wifi;
+extern const oled_bitmap_t gImage_bluetooth;
+extern const oled_bitmap_t *const tjbg[8];
 
 #endif
@@ -1,26 +1,98 @@
 #include "oled.h"
 #include "stdlib.h"
+#include <string.h>
 #include "oledfont.h"
+#include "oled_anim.h"
+#define LOG_FILE_ID 6
+#include "log.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
 
-static uint8_t OLED_GRAM[144][8];
-static uint8_t dirty_flag = 0;
-static uint8_t dirty_x1 = 127, dirty_y1 = 63, dirty_x2 = 0, dirty_y2 = 0;
+static uint8_t OLED_GRAM[8][128]; // 显存按页存放：每页128列连续，整页/区间可直接交给I2C发送
+
+// 影子显存：屏幕当前实际显示的内容，刷新时与OLED_GRAM比较，只发送变化的字节
+static uint8_t oled_shadow[8][128];
+static uint8_t oled_shadow_valid = 0; // 0-影子内容未知（上电/初始化），下次刷新整屏发送
+
+// 脏区：每页(8行)记录若干列区间，刷新时只发送这些区间
+typedef struct
+{
+	uint8_t x1;
+	uint8_t x2;
+} oled_span_t;
+
+static oled_span_t oled_dirty[8][OLED_DIRTY_SPANS];
+static uint8_t oled_dirty_count[8];
+
+// 待发送区间：OLED_Capture把变化的字节拷进影子显存后登记，OLED_Transmit从影子显存发送。
+// 影子显存即前台缓冲，OLED_GRAM即后台缓冲，发送期间UI可以继续在OLED_GRAM上画下一帧
+static oled_span_t oled_tx[8][OLED_DIRTY_SPANS];
+static uint8_t oled_tx_count[8];
+
+// 切换动画：oled_slide由绘制方在帧内设置，OLED_Capture取帧时转给oled_slide_play，由OLED_Transmit播放
+static uint8_t oled_slide = OLED_SLIDE_NONE;
+static uint8_t oled_slide_play = OLED_SLIDE_NONE;
+
+// 显示起始行：oled_start_line由绘制方在帧内设置，取帧时锁存到oled_start_tx，发送时与已生效的值不同才发命令
+static uint8_t oled_start_line = 0;
+static uint8_t oled_start_tx = 0;
+static uint8_t oled_start_sent = 0;
+
+// 显示任务（OLED_Display_CreateTask创建后，刷新由它在后台完成）
+static TaskHandle_t oled_display_handle = NULL;
+static SemaphoreHandle_t oled_frame_mutex = NULL; // 保护OLED_GRAM和脏区：UI画一帧期间持有
+static SemaphoreHandle_t oled_bus_mutex = NULL;   // I2C总线：显示任务发送与零散命令互斥
+static TaskHandle_t oled_frame_owner = NULL;      // 当前持有帧锁的任务（画帧的任务，或取帧的显示任务）
+static uint8_t oled_frame_depth = 0;              // OLED_Begin_Frame嵌套层数，最外层结束时才提交
+static volatile uint8_t oled_clear_pending = 0;   // 帧外的清屏，推迟到下一帧开始时执行
+static void (*oled_frame_hook)(void) = NULL;      // 显示任务取帧前（持有帧锁）调用，执行投递的绘制命令
+static void (*oled_damage_hooks[OLED_DAMAGE_HOOKS])(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2); // 显存被改写时通知（文字缓存、控件层用）
+
+// 显示任务是否在后台负责刷新
+uint8_t OLED_Display_Running(void)
+{
+	return oled_display_handle != NULL && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+}
+
+static void OLED_Bus_Lock(void)
+{
+	if (OLED_Display_Running())
+	{
+		xSemaphoreTake(oled_bus_mutex, portMAX_DELAY);
+	}
+}
+
+static void OLED_Bus_Unlock(void)
+{
+	if (OLED_Display_Running())
+	{
+		xSemaphoreGive(oled_bus_mutex);
+	}
+}
 
 // 发送一个字节
 // mode:数据/命令标志 0,表示命令;1,表示数据;
 void OLED_WR_Byte(uint8_t dat, uint8_t mode)
 {
-	
+	OLED_Bus_Lock();
 	if (mode)
 	{
-		printf("OLED_Send_Byte satrt ->\n");
 		OLED_Send_Byte(0x3c, 0x40, dat); 
-		printf("<- OLED_Send_Byte end\n");
 	}
 	else
 	{
 		OLED_Send_Byte(0x3c, 0x00, dat); 
 	}
+	OLED_Bus_Unlock();
+}
+
+// 发送一串命令：控制字节0x00后连续跟全部命令字节，一次传输完成
+void OLED_WR_Cmds(const uint8_t *cmd, uint8_t len)
+{
+	OLED_Bus_Lock();
+	OLED_Send_Window(0x3c, 0x00, len, 1, len, cmd);
+	OLED_Bus_Unlock();
 }
 
 // 反显函数,0正常显示，1 反色显示
@@ -39,15 +111,16 @@ void OLED_ColorTurn(uint8_t i)
 // 屏幕旋转180度,0正常显示 1 屏幕翻转显示
 void OLED_DisplayTurn(uint8_t i)
 {
+	static const uint8_t normal[] = {0xC8, 0xA1};  // 正常显示
+	static const uint8_t turned[] = {0xC0, 0xA0};  // 反转显示
+
 	if (i == 0)
 	{
-		OLED_WR_Byte(0xC8, OLED_CMD); // 正常显示
-		OLED_WR_Byte(0xA1, OLED_CMD);
+		OLED_WR_Cmds(normal, sizeof(normal));
 	}
 	if (i == 1)
 	{
-		OLED_WR_Byte(0xC0, OLED_CMD); // 反转显示
-		OLED_WR_Byte(0xA0, OLED_CMD);
+		OLED_WR_Cmds(turned, sizeof(turned));
 	}
 }
 
@@ -55,129 +128,556 @@ void OLED_DisplayTurn(uint8_t i)
 // 开启OLED显示
 void OLED_DisPlay_On(void)
 {
-	OLED_WR_Byte(0x8D, OLED_CMD); // 电荷泵使能
-	OLED_WR_Byte(0x14, OLED_CMD); // 开启电荷泵
-	OLED_WR_Byte(0xAF, OLED_CMD); // 点亮屏幕
+	static const uint8_t cmd[] = {
+		0x8D, 0x14, // 电荷泵使能，开启电荷泵
+		0xAF,       // 点亮屏幕
+	};
+	OLED_WR_Cmds(cmd, sizeof(cmd));
 }
 
 // 关闭OLED显示
 void OLED_DisPlay_Off(void)
 {
-	OLED_WR_Byte(0x8D, OLED_CMD); // 电荷泵使能
-	OLED_WR_Byte(0x10, OLED_CMD); // 关闭电荷泵
-	OLED_WR_Byte(0xAE, OLED_CMD); // 关闭屏幕
+	static const uint8_t cmd[] = {
+		0x8D, 0x10, // 电荷泵使能，关闭电荷泵
+		0xAE,       // 关闭屏幕
+	};
+	OLED_WR_Cmds(cmd, sizeof(cmd));
 }
 
-// 更新显存到OLED,更新后显示的才是你配置后的内容
-void OLED_Refresh(void)
+// 发送一个矩形窗口：水平寻址模式下先用0x21/0x22设列/页窗口（一次命令传输），
+// 数据在窗口内逐页自动换行，整块数据一次传输连续发完，跨页不再重新寻址。
+// 数据直接从影子显存（跨距128）发送，不拷贝
+static void OLED_Send_Area(uint8_t x1, uint8_t x2, uint8_t p1, uint8_t p2)
 {
-	uint8_t i, n;
-	uint8_t data[128];
+	uint8_t cmd[6];
+
+	cmd[0] = 0x21;	// 设置列地址窗口
+	cmd[1] = x1;
+	cmd[2] = x2;
+	cmd[3] = 0x22;	// 设置页地址窗口
+	cmd[4] = p1;
+	cmd[5] = p2;
+	OLED_Send_Window(0x3c, 0x00, sizeof(cmd), 1, sizeof(cmd), cmd);
+	OLED_Send_Window(0x3c, 0x40, x2 - x1 + 1, p2 - p1 + 1, 128, &oled_shadow[p1][x1]);
+}
+
+static void OLED_Dirty_Reset(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		oled_dirty_count[i] = 0;
+	}
+}
+
+// 把列区间并入区间表：相交或间隔不超过OLED_DIRTY_MERGE_GAP的区间合并，
+// 表满时并入距离最近的区间
+static void OLED_Span_Add(oled_span_t *span, uint8_t *count, uint8_t x1, uint8_t x2)
+{
+	uint8_t i, best, gap, best_gap;
+
+	for (;;)
+	{
+		for (i = 0; i < *count; i++)
+		{
+			if (x1 <= span[i].x2 + OLED_DIRTY_MERGE_GAP && span[i].x1 <= x2 + OLED_DIRTY_MERGE_GAP)
+			{
+				break;
+			}
+		}
+
+		if (i == *count && *count < OLED_DIRTY_SPANS)
+		{
+			span[i].x1 = x1;
+			span[i].x2 = x2;
+			(*count)++;
+			return;
+		}
+
+		if (i == *count)
+		{
+			// 表满：找间隔最小的区间
+			best = 0;
+			best_gap = 0xFF;
+			for (i = 0; i < *count; i++)
+			{
+				gap = (x1 > span[i].x2) ? x1 - span[i].x2 : span[i].x1 - x2;
+				if (gap < best_gap)
+				{
+					best_gap = gap;
+					best = i;
+				}
+			}
+			i = best;
+		}
+
+		// 取出该区间与新区间合并，再重新插入（合并后可能又与别的区间相邻）
+		if (span[i].x1 < x1) x1 = span[i].x1;
+		if (span[i].x2 > x2) x2 = span[i].x2;
+		span[i] = span[--(*count)];
+	}
+}
+
+// 比较某页 [x1,x2] 列与影子显存，把变化的字节段拷进影子显存并登记到待发送表。
+// 两段之间未变的字节不超过OLED_DIRTY_MERGE_GAP时合成一段（重发几个字节比多一次寻址便宜）。
+static void OLED_Capture_Span(uint8_t page, uint8_t x1, uint8_t x2)
+{
+	uint8_t n = x1;
+	uint8_t start, end, gap;
+
+	while (n <= x2)
+	{
+		// 跳过未变化的字节
+		while (n <= x2 && OLED_GRAM[page][n] == oled_shadow[page][n])
+		{
+			n++;
+		}
+		if (n > x2)
+		{
+			break;
+		}
+
+		// 向后延伸变化段
+		start = end = n;
+		gap = 0;
+		for (n++; n <= x2 && gap <= OLED_DIRTY_MERGE_GAP; n++)
+		{
+			if (OLED_GRAM[page][n] != oled_shadow[page][n])
+			{
+				end = n;
+				gap = 0;
+			}
+			else
+			{
+				gap++;
+			}
+		}
+		n = end + 1;
+
+		memcpy(&oled_shadow[page][start], &OLED_GRAM[page][start], end - start + 1);
+		OLED_Span_Add(oled_tx[page], &oled_tx_count[page], start, end);
+	}
+}
+
+// 取一帧：只做内存比较和拷贝，不碰总线。调用者需持有帧锁（或调度器未运行）
+static void OLED_Capture(void)
+{
+	uint8_t i, j;
+
+	if (oled_slide != OLED_SLIDE_NONE && oled_shadow_valid)
+	{
+		// 整帧交给切换动画逐页写入，不做比较
+		memcpy(oled_shadow, OLED_GRAM, sizeof(oled_shadow));
+		oled_slide_play = oled_slide;
+		oled_slide = OLED_SLIDE_NONE;
+		oled_start_line = 0;
+		OLED_Dirty_Reset();
+		return;
+	}
+	oled_slide = OLED_SLIDE_NONE;
+	oled_start_tx = oled_start_line;
+
+	if (!oled_shadow_valid)
+	{
+		// 屏幕内容未知：整屏发送
+		memcpy(oled_shadow, OLED_GRAM, sizeof(oled_shadow));
+		for (i = 0; i < 8; i++)
+		{
+			oled_tx[i][0].x1 = 0;
+			oled_tx[i][0].x2 = 127;
+			oled_tx_count[i] = 1;
+		}
+		oled_shadow_valid = 1;
+		OLED_Dirty_Reset();
+		return;
+	}
+
+	for (i = 0; i < 8; i++)
+	{
+		for (j = 0; j < oled_dirty_count[i]; j++)
+		{
+			OLED_Capture_Span(i, oled_dirty[i][j].x1, oled_dirty[i][j].x2);
+		}
+		oled_dirty_count[i] = 0;
+	}
+}
+
+// 播放切换动画。屏幕显示从起始行寄存器指定的RAM行开始，超出64行回绕到RAM顶部，
+// 所以起始行每移动8行，整屏内容就平移一页，旧画面只是换个位置显示，不用重发；
+// 每卷一页先移动起始行，再把卷到另一边的那一页RAM写成新画面的同一页。8页后起始行回到0，RAM正好是新画面。
+// 64行复用时RAM每一页都在屏上，没有能藏起来写的页：先写后移会让新内容在离开的一边提前露出一页，
+// 先移后写则是新进入边缘的那一页在写完前（约一次128字节传输）还显示旧画面，看上去只是晚到一拍，取后者。
+// 卷过的页数按经过的时间缓动取值（OLED_SLIDE_MS内走完），每帧间隔不少于OLED_ANIM_FRAME_MS；
+// 总线慢时一帧补写多页（逐页先移后写），动画时长不变。整个动画共写1KB
+static void OLED_Transmit_Slide(uint8_t dir)
+{
+	uint8_t cmd[6];
+	uint8_t done = 0, target, page, line;
+	uint32_t elapsed;
+	TickType_t start = xTaskGetTickCount();
+	TickType_t wake = start;
+
+	while (done < 8)
+	{
+		if (OLED_Display_Running())
+		{
+			elapsed = (xTaskGetTickCount() - start) * portTICK_PERIOD_MS;
+			target = (elapsed >= OLED_SLIDE_MS) ? 8 :
+					 (uint8_t)((OLED_Anim_Ease(OLED_EASE_IN_OUT, (uint16_t)(elapsed * OLED_ANIM_ONE / OLED_SLIDE_MS)) * 8 + OLED_ANIM_ONE / 2) / OLED_ANIM_ONE);
+		}
+		else
+		{
+			target = 8; // 调度器未运行：直接切换
+		}
+
+		if (target > done)
+		{
+			OLED_Bus_Lock();
+			for (; done < target; done++)
+			{
+				page = (dir == OLED_SLIDE_UP) ? done : 7 - done;
+				line = (dir == OLED_SLIDE_UP) ? (done + 1) * 8 : (7 - done) * 8;
+				OLED_Send_Byte(0x3c, 0x00, 0x40 | (line & 0x3F)); // 起始行
+				cmd[0] = 0x21;	// 列窗口 0~127
+				cmd[1] = 0;
+				cmd[2] = 127;
+				cmd[3] = 0x22;	// 页窗口：将要卷过去的那一页
+				cmd[4] = page;
+				cmd[5] = page;
+				OLED_Send_Window(0x3c, 0x00, sizeof(cmd), 1, sizeof(cmd), cmd);
+				OLED_Send_Window(0x3c, 0x40, 128, 1, 128, oled_shadow[page]);
+			}
+			OLED_Bus_Unlock();
+		}
+
+		if (done < 8)
+		{
+			vTaskDelayUntil(&wake, pdMS_TO_TICKS(OLED_ANIM_FRAME_MS));
+		}
+	}
+	oled_start_tx = oled_start_sent = 0;
+}
+
+// 发送待发送表。变化区间的外接矩形比逐个区间发送（每个区间多一次寻址开销）更省时，
+// 整个外接矩形一个窗口发完（整屏刷新就是一次1024字节的传输）；
+// 否则逐区间开窗口，相邻页列范围相同的区间（如16像素高的字符）合成一个窗口
+static void OLED_Transmit(void)
+{
+	uint8_t i, j, x1, x2;
+	uint8_t bx1 = 127, bx2 = 0, bp1 = 7, bp2 = 0; // 外接矩形
+	uint8_t wx1 = 0, wx2 = 0, wp1 = 0, wp2 = 0;   // 正在合并的窗口
+	uint8_t open = 0;
+	uint16_t bytes = 0, spans = 0;
+
+	if (oled_slide_play != OLED_SLIDE_NONE)
+	{
+		OLED_Transmit_Slide(oled_slide_play);
+		oled_slide_play = OLED_SLIDE_NONE;
+		return;
+	}
+
 	for (i = 0; i < 8; i++)
 	{
-		for (n = 0; n < 128; n++)
+		for (j = 0; j < oled_tx_count[i]; j++)
+		{
+			x1 = oled_tx[i][j].x1;
+			x2 = oled_tx[i][j].x2;
+			bytes += x2 - x1 + 1;
+			spans++;
+			if (x1 < bx1) bx1 = x1;
+			if (x2 > bx2) bx2 = x2;
+			if (i < bp1) bp1 = i;
+			if (i > bp2) bp2 = i;
+		}
+	}
+	if (spans == 0 && oled_start_tx == oled_start_sent)
+	{
+		return;
+	}
+
+	OLED_Bus_Lock();
+	if (oled_start_tx != oled_start_sent)
+	{
+		// 先移动起始行再写数据：滚动时新内容写进刚卷到另一边的那一页
+		OLED_Send_Byte(0x3c, 0x00, 0x40 | oled_start_tx);
+		oled_start_sent = oled_start_tx;
+	}
+	if (spans > 0 && (uint16_t)(bx2 - bx1 + 1) * (bp2 - bp1 + 1) <= bytes + (spans - 1) * OLED_WINDOW_COST)
+	{
+		OLED_Send_Area(bx1, bx2, bp1, bp2);
+	}
+	else if (spans > 0)
+	{
+		for (i = 0; i < 8; i++)
 		{
-			data[n] = OLED_GRAM[n][i];
+			for (j = 0; j < oled_tx_count[i]; j++)
+			{
+				x1 = oled_tx[i][j].x1;
+				x2 = oled_tx[i][j].x2;
+				if (open && x1 == wx1 && x2 == wx2 && i == wp2 + 1)
+				{
+					wp2 = i; // 与上一页的窗口同列，向下延伸
+					continue;
+				}
+				if (open)
+				{
+					OLED_Send_Area(wx1, wx2, wp1, wp2);
+				}
+				wx1 = x1;
+				wx2 = x2;
+				wp1 = wp2 = i;
+				open = 1;
+			}
 		}
+		OLED_Send_Area(wx1, wx2, wp1, wp2);
+	}
 
-		OLED_WR_Byte(0xb0 + i, OLED_CMD); // 设置行起始地址
-		OLED_WR_Byte(0x00, OLED_CMD);	  // 设置低列起始地址
-		OLED_WR_Byte(0x10, OLED_CMD);	  // 设置高列起始地址
-		OLED_Send_Bytes(0x3c, 0x40, 128, data);
+	for (i = 0; i < 8; i++)
+	{
+		oled_tx_count[i] = 0;
 	}
+	OLED_Bus_Unlock();
+}
+
+// 把显存推到屏幕：显示任务运行时交给它在后台完成（帧内调用推迟到OLED_End_Frame），
+// 否则当场比较并发送
+static void OLED_Push(void)
+{
+	if (OLED_Display_Running())
+	{
+		if (oled_frame_owner != xTaskGetCurrentTaskHandle())
+		{
+			xTaskNotifyGive(oled_display_handle);
+		}
+		return;
+	}
+	OLED_Capture();
+	OLED_Transmit();
+}
+
+// 更新显存到OLED,更新后显示的才是你配置后的内容
+// 整屏与影子显存比较，只发送不同的字节，内容没变化时总线上没有数据
+void OLED_Refresh(void)
+{
+	OLED_Set_Dirty_Area(0, 0, 127, 63);
+	OLED_Push();
 }
 
 // 局部刷新函数，只刷新指定区域 (x1,y1) 到 (x2,y2)
 void OLED_Refresh_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 {
-	uint8_t i, n, start_page, end_page, start_col, end_col;
-	uint8_t data[128];
-	
+	OLED_Set_Dirty_Area(x1, y1, x2, y2);
+	OLED_Push();
+}
+
+// 标记脏区域，用于自动局部刷新
+void OLED_Set_Dirty_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+{
+	uint8_t i;
+
 	// 参数检查和修正
 	if (x1 > x2) { uint8_t temp = x1; x1 = x2; x2 = temp; }
 	if (y1 > y2) { uint8_t temp = y1; y1 = y2; y2 = temp; }
 	
+	// 完全在屏幕外的区域不记录
+	if (x1 >= 128 || y1 >= 64) return;
+
 	// 边界限制
-	if (x1 >= 128) x1 = 127;
 	if (x2 >= 128) x2 = 127;
-	if (y1 >= 64) y1 = 63;
 	if (y2 >= 64) y2 = 63;
 	
-	// 计算页面范围（每页8行）
-	start_page = y1 / 8;
-	end_page = y2 / 8;
-	
-	// 计算列范围
-	start_col = x1;
-	end_col = x2;
-	
-	// 刷新指定区域
-	for (i = start_page; i <= end_page; i++)
+	for (i = y1 / 8; i <= y2 / 8; i++)
 	{
-		// 设置页面地址
-		OLED_WR_Byte(0xb0 + i, OLED_CMD);
-		
-		// 只刷新指定的列范围
-		for (n = start_col; n <= end_col; n++)
-		{
-			data[n - start_col] = OLED_GRAM[n][i];
-		}
-		
-		// 设置列地址
-		OLED_WR_Byte(start_col & 0x0f, OLED_CMD);        // 低列地址
-		OLED_WR_Byte(0x10 | (start_col >> 4), OLED_CMD); // 高列地址
-		
-		// 发送数据
-		OLED_Send_Bytes(0x3c, 0x40, end_col - start_col + 1, data);
+		OLED_Span_Add(oled_dirty[i], &oled_dirty_count[i], x1, x2);
 	}
 }
 
-// 标记脏区域，用于自动局部刷新
-void OLED_Set_Dirty_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+// 绘制函数改写了显存 (x1,y1)~(x2,y2)：通知改写钩子并标记脏区
+// （OLED_Set_Dirty_Area只表示要发送，刷新时整屏标脏不算改写）
+static void OLED_Draw_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 {
-	// 参数检查和修正
+	uint8_t i;
+
 	if (x1 > x2) { uint8_t temp = x1; x1 = x2; x2 = temp; }
 	if (y1 > y2) { uint8_t temp = y1; y1 = y2; y2 = temp; }
-	
-	// 边界限制
-	if (x1 >= 128) x1 = 127;
+	if (x1 >= 128 || y1 >= 64)
+		return;
 	if (x2 >= 128) x2 = 127;
-	if (y1 >= 64) y1 = 63;
 	if (y2 >= 64) y2 = 63;
-	
-	// 更新脏区域
-	if (!dirty_flag) {
-		dirty_x1 = x1; dirty_y1 = y1; dirty_x2 = x2; dirty_y2 = y2;
-		dirty_flag = 1;
-	} else {
-		if (x1 < dirty_x1) dirty_x1 = x1;
-		if (y1 < dirty_y1) dirty_y1 = y1;
-		if (x2 > dirty_x2) dirty_x2 = x2;
-		if (y2 > dirty_y2) dirty_y2 = y2;
+
+	for (i = 0; i < OLED_DAMAGE_HOOKS && oled_damage_hooks[i] != NULL; i++)
+	{
+		oled_damage_hooks[i](x1, y1, x2, y2);
 	}
+	OLED_Set_Dirty_Area(x1, y1, x2, y2);
+}
+
+// 按左上角和宽高标记脏区；负坐标按uint8回绕传进来时，只有回绕到左侧/顶部的部分可见
+static void OLED_Mark_Dirty(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+	uint8_t xe = x + w - 1;
+	uint8_t ye = y + h - 1;
+
+	if (xe < x) x = 0;
+	if (ye < y) y = 0;
+	OLED_Draw_Area(x, y, xe, ye);
 }
 
-// 刷新脏区域
+// 刷新脏区域：逐页只在脏列区间内与影子显存比较，发送变化的字节段
 void OLED_Refresh_Dirty(void)
 {
-	if (dirty_flag) {
-		OLED_Refresh_Area(dirty_x1, dirty_y1, dirty_x2, dirty_y2);
-		dirty_flag = 0;
-		dirty_x1 = 127; dirty_y1 = 63; dirty_x2 = 0; dirty_y2 = 0;
-	}
+	OLED_Push();
 }
-// 清屏函数
+
+// 清屏函数：只清显存并标记整屏脏区，随本帧一起发送（重画相同内容时不产生传输）
+// 显示任务运行时在帧外调用（页面on_enter/on_exit等）不能直接改显存，推迟到下一帧开始时清
 void OLED_Clear(void)
 {
-	uint8_t i, n;
-	for (i = 0; i < 8; i++)
+	if (OLED_Display_Running() && oled_frame_owner != xTaskGetCurrentTaskHandle())
+	{
+		oled_clear_pending = 1;
+		return;
+	}
+	memset(OLED_GRAM, 0, sizeof(OLED_GRAM)); // 清除所有数据
+	OLED_Draw_Area(0, 0, 127, 63);
+}
+
+/**
+ * @brief  开始一帧：显示任务运行时取得帧锁，之后的绘制不会被显示任务取走半帧
+ * @note   帧内的OLED_Refresh/OLED_Refresh_Dirty/OLED_Refresh_Area不发送，统一在OLED_End_Frame提交；
+ *         同一任务可以嵌套调用，最外层OLED_End_Frame才提交
+ */
+void OLED_Begin_Frame(void)
+{
+	if (OLED_Display_Running())
+	{
+		if (oled_frame_owner == xTaskGetCurrentTaskHandle())
+		{
+			oled_frame_depth++;
+			return;
+		}
+		xSemaphoreTake(oled_frame_mutex, portMAX_DELAY);
+		oled_frame_owner = xTaskGetCurrentTaskHandle();
+		oled_frame_depth = 1;
+		if (oled_clear_pending)
+		{
+			oled_clear_pending = 0;
+			OLED_Clear();
+		}
+	}
+}
+
+/**
+ * @brief  结束一帧并提交：显示任务在后台比较、发送，调用者立即返回继续处理按键/画下一帧
+ * @note   没有显示任务（或调度器未启动）时当场发送
+ */
+void OLED_End_Frame(void)
+{
+	if (OLED_Display_Running() && oled_frame_owner == xTaskGetCurrentTaskHandle())
+	{
+		if (--oled_frame_depth > 0)
+		{
+			return;
+		}
+		oled_frame_owner = NULL;
+		xSemaphoreGive(oled_frame_mutex);
+		xTaskNotifyGive(oled_display_handle);
+		return;
+	}
+	OLED_Push();
+}
+
+/**
+ * @brief  本帧提交时用整屏滚动切换到新画面，代替直接刷新
+ * @param  dir: OLED_SLIDE_UP / OLED_SLIDE_DOWN
+ * @note   在OLED_Begin_Frame/OLED_End_Frame之间画完新画面后调用；
+ *         屏幕内容未知（初始化后首帧）时按普通刷新处理
+ */
+void OLED_Slide(uint8_t dir)
+{
+	oled_slide = dir;
+}
+
+/**
+ * @brief  设置显示起始行，随本帧一起发送（0x40|line）
+ * @param  line: 0~63，屏幕第0行显示RAM的第line行，超出64行回绕
+ * @note   起始行不为0时屏幕与显存按行错位，只给按物理页绘制的视图（如日志终端）使用，
+ *         离开时要设回0
+ */
+void OLED_Set_Start_Line(uint8_t line)
+{
+	oled_start_line = line & 0x3F;
+}
+
+// 显示任务：收到提交后短暂持有帧锁取帧（只做内存比较），释放后再慢慢发送。
+// 发送期间有新的提交会累积在通知里，发完后一次取最新内容，中间帧自然合并
+static void OLED_Display_Task(void *pvParameters)
+{
+	for (;;)
 	{
-		for (n = 0; n < 128; n++)
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		xSemaphoreTake(oled_frame_mutex, portMAX_DELAY);
+		oled_frame_owner = xTaskGetCurrentTaskHandle(); // 投递的绘制命令在这里画，清屏不能推迟
+		if (oled_frame_hook != NULL)
 		{
-			OLED_GRAM[n][i] = 0; // 清除所有数据
+			oled_frame_hook();
 		}
+		OLED_Capture();
+		oled_frame_owner = NULL;
+		xSemaphoreGive(oled_frame_mutex);
+
+		OLED_Transmit();
+	}
+}
+
+// 注册取帧前的回调（绘制命令队列用），只有显示任务会调用它
+void OLED_Set_Frame_Hook(void (*hook)(void))
+{
+	oled_frame_hook = hook;
+}
+
+// 注册显存改写回调：绘制函数每改写一块区域调用一次（坐标已裁剪到屏幕内，含边界），
+// 在绘制者的上下文里执行，必须很短。初始化阶段调用，返回0表示回调已满
+uint8_t OLED_Add_Damage_Hook(void (*hook)(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2))
+{
+	uint8_t i;
+
+	for (i = 0; i < OLED_DAMAGE_HOOKS; i++)
+	{
+		if (oled_damage_hooks[i] == NULL || oled_damage_hooks[i] == hook)
+		{
+			oled_damage_hooks[i] = hook;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// 返回0成功，1堆不足（创建失败时保持调用者当场刷新）
+uint8_t OLED_Display_CreateTask(void)
+{
+	oled_frame_mutex = xSemaphoreCreateMutex();
+	oled_bus_mutex = xSemaphoreCreateMutex();
+	if (oled_frame_mutex == NULL || oled_bus_mutex == NULL)
+	{
+		LOG_E(OLED, "display mutex create failed\n");
+		return 1;
+	}
+
+	if (xTaskCreate((TaskFunction_t)OLED_Display_Task,     /* 任务函数 */
+					(const char *)"OLED_Display",          /* 任务名称 */
+					(uint16_t)OLED_DISPLAY_TASK_STACK,     /* 任务堆栈大小 */
+					(void *)NULL,                          /* 任务函数参数 */
+					(UBaseType_t)OLED_DISPLAY_TASK_PRIO,   /* 任务优先级 */
+					(TaskHandle_t *)&oled_display_handle) != pdPASS) /* 任务控制句柄 */
+	{
+		oled_display_handle = NULL;
+		return 1;
 	}
-	OLED_Refresh(); // 更新显示
+	return 0;
 }
 
 // 画点
@@ -187,19 +687,182 @@ void OLED_Clear(void)
 void OLED_DrawPoint(uint8_t x, uint8_t y, uint8_t t)
 {
 	uint8_t i, m, n;
+	if (x >= 128 || y >= 64)
+		return; // 越界（含负坐标回绕）不写显存
 	i = y / 8;
 	m = y % 8;
 	n = 1 << m;
 	if (t)
 	{
-		OLED_GRAM[x][i] |= n;
+		OLED_GRAM[i][x] |= n;
 	}
 	else
 	{
-		OLED_GRAM[x][i] = ~OLED_GRAM[x][i];
-		OLED_GRAM[x][i] |= n;
-		OLED_GRAM[x][i] = ~OLED_GRAM[x][i];
+		OLED_GRAM[i][x] = ~OLED_GRAM[i][x];
+		OLED_GRAM[i][x] |= n;
+		OLED_GRAM[i][x] = ~OLED_GRAM[i][x];
+	}
+}
+
+// 把一列8个像素写入显存，y不必按页对齐：拆成上下两页各一次移位/掩码合并
+// 负坐标按uint8回绕传入时，x>=128的列丢弃，y回绕到顶部的部分仍然可见
+static void OLED_Blit_Byte(uint8_t x, uint8_t y, uint8_t data, uint8_t mode)
+{
+	uint8_t page = y >> 3;
+	uint8_t shift = y & 7;
+	uint8_t mask;
+	uint8_t *p;
+
+	if (x >= 128)
+		return;
+	if (mode == OLED_MODE_INVERSE)
+		data = ~data;
+
+	if (page < 8)
+	{
+		p = &OLED_GRAM[page][x];
+		mask = 0xFF << shift;
+		if (mode == OLED_MODE_TRANSPARENT)
+			*p |= (uint8_t)(data << shift);
+		else
+			*p = (*p & ~mask) | (uint8_t)(data << shift);
+	}
+	if (shift)
+	{
+		page = (page + 1) & 31; // y在249~255（回绕的负坐标）时下半部分落在第0页
+		if (page < 8)
+		{
+			p = &OLED_GRAM[page][x];
+			mask = 0xFF >> (8 - shift);
+			if (mode == OLED_MODE_TRANSPARENT)
+				*p |= data >> (8 - shift);
+			else
+				*p = (*p & ~mask) | (data >> (8 - shift));
+		}
+	}
+}
+
+// 按列字节写入点阵（字模/图片通用格式：每8行一组，每组w个字节，低位在上）
+// x,y:左上角坐标
+// w:宽度（列数）
+// pages:高度（8行一组的组数）
+// mode:OLED_MODE_INVERSE/OLED_MODE_NORMAL/OLED_MODE_TRANSPARENT
+void OLED_Blit(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *src, uint8_t mode)
+{
+	uint8_t i, n;
+
+	for (n = 0; n < pages; n++)
+	{
+		for (i = 0; i < w; i++)
+		{
+			OLED_Blit_Byte(x + i, y + n * 8, *src++, mode);
+		}
+	}
+	OLED_Mark_Dirty(x, y, w, pages * 8);
+}
+
+// 按操作码流写入点阵（格式见oled_bitmap_t），逐字节解码直接写入显存，不需要解压缓冲
+// 只画第c0列起的cn列（从x开始），超出点阵宽度w的列画成空白
+static void OLED_Blit_Packed(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *src,
+							 uint8_t c0, uint8_t cn, uint8_t mode)
+{
+	uint8_t col = 0, page = 0;
+	uint8_t op, n, data = 0;
+
+	while (page < pages)
+	{
+		op = *src++;
+		if (op & 0x80)
+		{
+			// 跳过：与前一帧相同，只移动位置
+			n = (op & 0x7F) + 1;
+			while (n--)
+			{
+				if (++col == w)
+				{
+					col = 0;
+					page++;
+				}
+			}
+			continue;
+		}
+
+		if (op & 0x40)
+		{
+			n = (op & 0x3F) + 2;
+			data = *src++;
+		}
+		else
+		{
+			n = op + 1;
+		}
+		while (n--)
+		{
+			if (!(op & 0x40))
+				data = *src++;
+			if ((uint8_t)(col - c0) < cn)
+				OLED_Blit_Byte(x + col - c0, y + page * 8, data, mode);
+			if (++col == w)
+			{
+				col = 0;
+				page++;
+			}
+		}
+	}
+	for (col = w; (uint8_t)(col - c0) < cn; col++)
+	{
+		for (page = 0; page < pages; page++)
+			OLED_Blit_Byte(x + col - c0, y + page * 8, 0, mode);
+	}
+	OLED_Mark_Dirty(x, y, cn, pages * 8);
+}
+
+// 同OLED_Blit，只画第c0列起的cn列（从x开始），超出点阵宽度w的列画成空白
+static void OLED_Blit_Cols(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *src,
+						   uint8_t c0, uint8_t cn, uint8_t mode)
+{
+	uint8_t i, n, col;
+
+	for (n = 0; n < pages; n++)
+	{
+		for (i = 0; i < cn; i++)
+		{
+			col = c0 + i;
+			OLED_Blit_Byte(x + i, y + n * 8, (col < w) ? src[n * w + col] : 0, mode);
+		}
 	}
+	OLED_Mark_Dirty(x, y, cn, pages * 8);
+}
+
+// 填充矩形 (x1,y1)~(x2,y2)（含边界），每页一个字节掩码，t:1 点亮 0 清除
+void OLED_Fill_Rect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t t)
+{
+	uint8_t page, mask, x;
+
+	if (x1 > x2) { uint8_t temp = x1; x1 = x2; x2 = temp; }
+	if (y1 > y2) { uint8_t temp = y1; y1 = y2; y2 = temp; }
+	if (x1 >= 128 || y1 >= 64)
+		return;
+	if (x2 >= 128) x2 = 127;
+	if (y2 >= 64) y2 = 63;
+
+	for (page = y1 >> 3; page <= (y2 >> 3); page++)
+	{
+		mask = 0xFF;
+		if (page == (y1 >> 3))
+			mask &= 0xFF << (y1 & 7);
+		if (page == (y2 >> 3))
+			mask &= 0xFF >> (7 - (y2 & 7));
+
+		for (x = x1; x <= x2; x++)
+		{
+			if (t)
+				OLED_GRAM[page][x] |= mask;
+			else
+				OLED_GRAM[page][x] &= ~mask;
+		}
+	}
+	OLED_Draw_Area(x1, y1, x2, y2);
 }
 
 // 画线
@@ -210,6 +873,7 @@ void OLED_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode)
 	uint16_t t;
 	int xerr = 0, yerr = 0, delta_x, delta_y, distance;
 	int incx, incy, uRow, uCol;
+	OLED_Draw_Area(x1, y1, x2, y2);
 	delta_x = x2 - x1; // 计算坐标增量
 	delta_y = y2 - y1;
 	uRow = x1; // 画线起点坐标
@@ -260,6 +924,7 @@ void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r)
 	int a, b, num;
 	a = 0;
 	b = r;
+	OLED_Draw_Area((x > r) ? x - r : 0, (y > r) ? y - r : 0, x + r, y + r);
 	while (2 * b * b >= r * r)
 	{
 		OLED_DrawPoint(x + a, y - b, 1);
@@ -282,75 +947,164 @@ void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r)
 	}
 }
 
-// 在指定位置显示一个字符,包括部分字符
-// x:0~127
-// y:0~63
-// size1:选择字体 6x8/6x12/8x16/12x24
-// mode:0,反色显示;1,正常显示
-void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode)
+// 查找字模：ASCII只在同字号字库里找；汉字等非ASCII字符找不小于该字号、含这个字的最小字库
+// （字库按字号从小到大排列，规则与Tools/font_packer.py分配字模时一致）
+// size1:字号 8/12/16/24
+// code:字符的Unicode编码
+// 返回：1-找到，0-字库里没有这个字（没被固件引用，打包时已去掉）
+uint8_t OLED_Font_Glyph(uint8_t size1, uint16_t code, oled_glyph_t *glyph)
 {
-	uint8_t i, m, temp, size2, chr1;
-	uint8_t x0 = x, y0 = y;
-	if (size1 == 8)
-		size2 = 6;
-	else
-		size2 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * (size1 / 2); // 得到字体一个字符对应点阵集所占的字节数
-	chr1 = chr - ' ';											   // 计算偏移后的值
-	for (i = 0; i < size2; i++)
+	const oled_font_t *font;
+	uint16_t lo, hi, mid, idx;
+	uint8_t i;
+
+	for (i = 0; i < OLED_FONT_COUNT; i++)
 	{
-		if (size1 == 8)
-		{
-			temp = asc2_0806[chr1][i];
-		} // 调用0806字体
-		else if (size1 == 12)
+		font = &oled_fonts[i];
+		if (font->height != size1 && (code < 0x80 || font->height < size1))
+			continue;
+
+		if (font->codes == NULL)
 		{
-			temp = asc2_1206[chr1][i];
-		} // 调用1206字体
-		else if (size1 == 16)
+			if (code < font->first || code - font->first >= font->count)
+				continue;
+			idx = code - font->first;
+		}
+		else
 		{
-			temp = asc2_1608[chr1][i];
-		} // 调用1608字体
-		else if (size1 == 24)
+			// 字符表升序，二分查找
+			lo = 0;
+			hi = font->count;
+			while (lo < hi)
+			{
+				mid = (lo + hi) / 2;
+				if (font->codes[mid] < code)
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			if (lo >= font->count || font->codes[lo] != code)
+				continue;
+			idx = lo;
+		}
+
+		glyph->width = font->width;
+		glyph->height = font->height;
+		if (font->metrics != NULL)
 		{
-			temp = asc2_2412[chr1][i];
-		} // 调用2412字体
+			glyph->col = font->metrics[idx] >> 4;
+			glyph->advance = font->metrics[idx] & 0x0F;
+		}
 		else
-			return;
-		for (m = 0; m < 8; m++)
 		{
-			if (temp & 0x01)
-				OLED_DrawPoint(x, y, mode);
-			else
-				OLED_DrawPoint(x, y, !mode);
-			temp >>= 1;
-			y++;
+			glyph->col = 0;
+			glyph->advance = font->width;
+		}
+		if (font->offset != NULL)
+		{
+			glyph->data = font->data + font->offset[idx];
+			glyph->packed = 1;
 		}
-		x++;
-		if ((size1 != 8) && ((x - x0) == size1 / 2))
+		else
 		{
-			x = x0;
-			y0 = y0 + 8;
+			glyph->data = font->data + (uint16_t)idx * font->width * ((font->height + 7) / 8);
+			glyph->packed = 0;
 		}
-		y = y0;
+		return 1;
+	}
+	return 0;
+}
+
+// 显示一个字符（ASCII或汉字）
+// x,y:起点坐标
+// code:字符的Unicode编码
+// size1:字号 8/12/16/24
+// mode:OLED_MODE_xxx
+// 返回：字宽（下一个字符的x偏移，比例字体每个字不同）；字库里没有的字符不显示，按ASCII字宽留空
+uint8_t OLED_ShowGlyph(uint8_t x, uint8_t y, uint16_t code, uint8_t size1, uint8_t mode)
+{
+	oled_glyph_t glyph;
+	uint8_t pages;
+
+	if (!OLED_Font_Glyph(size1, code, &glyph))
+		return (size1 == 8) ? 6 : size1 / 2;
+
+	// 字模按列存放：每8行一组，每组width个字节；比例字体只画col起的advance列
+	pages = (glyph.height + 7) / 8;
+	if (glyph.packed)
+		OLED_Blit_Packed(x, y, glyph.width, pages, glyph.data, glyph.col, glyph.advance, mode);
+	else if (glyph.col == 0 && glyph.advance == glyph.width)
+		OLED_Blit(x, y, glyph.width, pages, glyph.data, mode);
+	else
+		OLED_Blit_Cols(x, y, glyph.width, pages, glyph.data, glyph.col, glyph.advance, mode);
+	return glyph.advance;
+}
+
+// 在指定位置显示一个字符,包括部分字符
+// x:0~127
+// y:0~63
+// size1:选择字体 6x8/6x12/8x16/12x24
+// mode:0,反色显示;1,正常显示
+void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode)
+{
+	OLED_ShowGlyph(x, y, chr, size1, mode);
+}
+
+// 取下一个字符：按UTF-8解码（最多3字节，即基本多文种平面），非法字节原样返回
+static uint16_t OLED_Next_Char(const uint8_t **s)
+{
+	const uint8_t *p = *s;
+	uint16_t code = *p++;
+
+	if (code >= 0xE0 && (p[0] & 0xC0) == 0x80 && (p[1] & 0xC0) == 0x80)
+	{
+		code = ((code & 0x0F) << 12) | ((p[0] & 0x3F) << 6) | (p[1] & 0x3F);
+		p += 2;
+	}
+	else if (code >= 0xC0 && code < 0xE0 && (p[0] & 0xC0) == 0x80)
+	{
+		code = ((code & 0x1F) << 6) | (p[0] & 0x3F);
+		p++;
 	}
+	*s = p;
+	return code;
 }
 
-// 显示字符串
+// 显示字符串（UTF-8，可以夹杂汉字），遇到控制字符（含结尾'\0'）停止
 // x,y:起点坐标
-// size1:字体大小,8 / 16 / 24
+// size1:字体大小,8 / 12 / 16 / 24，汉字用不小于该字号的汉字字库
 //*chr:字符串起始地址
 // mode:0,反色显示;1,正常显示
-void OLED_ShowString(uint8_t x, uint8_t y, uint8_t *chr, uint8_t size1, uint8_t mode)
+// 返回：排版宽度（与OLED_Text_Width相同，超出屏幕的部分不画但计入），超过255按255
+uint8_t OLED_ShowString(uint8_t x, uint8_t y, uint8_t *chr, uint8_t size1, uint8_t mode)
+{
+	const uint8_t *p = chr;
+	uint16_t code;
+	uint16_t width = 0;
+
+	while ((code = OLED_Next_Char(&p)) >= ' ')
+	{
+		width += OLED_ShowGlyph(x + width, y, code, size1, mode);
+	}
+	return (width > 255) ? 255 : width;
+}
+
+// 测量字符串宽度（像素），与OLED_ShowString的排版一致，用于对齐和精确的清除/脏区范围
+uint16_t OLED_Text_Width(const uint8_t *chr, uint8_t size1)
 {
-	while ((*chr >= ' ') && (*chr <= '~')) // 判断是不是非法字符!
+	const uint8_t *p = chr;
+	oled_glyph_t glyph;
+	uint16_t code;
+	uint16_t width = 0;
+
+	while ((code = OLED_Next_Char(&p)) >= ' ')
 	{
-		OLED_ShowChar(x, y, *chr, size1, mode);
-		if (size1 == 8)
-			x += 6;
+		if (OLED_Font_Glyph(size1, code, &glyph))
+			width += glyph.advance;
 		else
-			x += size1 / 2;
-		chr++;
+			width += (size1 == 8) ? 6 : size1 / 2;
 	}
+	return width;
 }
 
 // m^n
@@ -389,54 +1143,6 @@ void OLED_ShowNum(uint8_t x, uint8_t y, u32 num, uint8_t len, uint8_t size1, uin
 	}
 }
 
-// 显示汉字
-// x,y:起点坐标
-// num:汉字对应的序号
-// mode:0,反色显示;1,正常显示
-//void OLED_ShowChinese(uint8_t x, uint8_t y, uint8_t num, uint8_t size1, uint8_t mode)
-//{
-//	uint8_t m, temp;
-//	uint8_t x0 = x, y0 = y;
-//	uint16_t i, size3 = (size1 / 8 + ((size1 % 8) ? 1 : 0)) * size1; // 得到字体一个字符对应点阵集所占的字节数
-//	for (i = 0; i < size3; i++)
-//	{
-//		if (size1 == 16)
-//		{
-//			temp = Hzk1[num][i];
-//		} // 调用16*16字体
-//		else if (size1 == 24)
-//		{
-//			temp = Hzk2[num][i];
-//		} // 调用24*24字体
-//		else if (size1 == 32)
-//		{
-//			temp = Hzk3[num][i];
-//		} // 调用32*32字体
-//		else if (size1 == 64)
-//		{
-//			temp = Hzk4[num][i];
-//		} // 调用64*64字体
-//		else
-//			return;
-//		for (m = 0; m < 8; m++)
-//		{
-//			if (temp & 0x01)
-//				OLED_DrawPoint(x, y, mode);
-//			else
-//				OLED_DrawPoint(x, y, !mode);
-//			temp >>= 1;
-//			y++;
-//		}
-//		x++;
-//		if ((x - x0) == size1)
-//		{
-//			x = x0;
-//			y0 = y0 + 8;
-//		}
-//		y = y0;
-//	}
-//}
-
 // num 显示汉字的个数
 // space 每一遍显示的间隔
 // mode:0,反色显示;1,正常显示
@@ -487,115 +1193,55 @@ void OLED_ShowNum(uint8_t x, uint8_t y, u32 num, uint8_t len, uint8_t size1, uin
 // mode:0,反色显示;1,正常显示
 void OLED_ShowPicture(uint8_t x, uint8_t y, uint8_t sizex, uint8_t sizey, const uint8_t BMP[], uint8_t mode)
 {
-	uint16_t j = 0;
-	uint8_t i, n, temp, m;
-	uint8_t x0 = x, y0 = y;
-	sizey = sizey / 8 + ((sizey % 8) ? 1 : 0);
-	for (n = 0; n < sizey; n++)
-	{
-		for (i = 0; i < sizex; i++)
-		{
-			temp = BMP[j];
-			j++;
-			for (m = 0; m < 8; m++)
-			{
-				if (temp & 0x01)
-					OLED_DrawPoint(x, y, mode);
-				else
-					OLED_DrawPoint(x, y, !mode);
-				temp >>= 1;
-				y++;
-			}
-			x++;
-			if ((x - x0) == sizex)
-			{
-				x = x0;
-				y0 = y0 + 8;
-			}
-			y = y0;
-		}
-	}
-	OLED_Set_Dirty_Area(x,y,x+sizex,y+sizey);
+	OLED_Blit(x, y, sizex, sizey / 8 + ((sizey % 8) ? 1 : 0), BMP, mode);
+}
+
+// 显示压缩位图
+// x,y：起点坐标
+// bmp：位图描述符（logo.h）
+// mode：同OLED_ShowPicture；差分帧里被跳过的字节保持显存原样
+void OLED_ShowBitmap(uint8_t x, uint8_t y, const oled_bitmap_t *bmp, uint8_t mode)
+{
+	OLED_Blit_Packed(x, y, bmp->w, bmp->h / 8, bmp->data, 0, bmp->w, mode);
 }
+// 初始化命令序列，作为一串命令一次发送
+static const uint8_t oled_init_cmds[] = {
+	0xAE,       // 关闭显示
+	0x40,       // 显示起始行0 (0x40~0x7F)
+	0x81, 0xCF, // 对比度
+	0xA1,       // 列映射 0xa0左右反置 0xa1正常
+	0xC8,       // COM扫描方向 0xc0上下反置 0xc8正常
+	0xA6,       // 正常显示（非反色）
+	0xA8, 0x3F, // 复用率 1/64
+	0xD3, 0x00, // 显示偏移 0
+	0xD5, 0x80, // 时钟分频/振荡频率，约100帧/秒
+	0xD9, 0xF1, // 预充电15个时钟、放电1个时钟
+	0xDA, 0x12, // COM引脚硬件配置
+	0xDB, 0x30, // VCOMH反选电平
+	0x20, 0x00, // 水平寻址模式：刷新用0x21/0x22设窗口，数据跨页自动换行
+	0x21, 0x00, 0x7F, // 列窗口 0~127
+	0x22, 0x00, 0x07, // 页窗口 0~7
+	0x8D, 0x14, // 开启电荷泵
+};
+
 // OLED initialization
 void OLED_Init(void)
 {
 	OLED_I2C_Init();
-  printf("OLED start initialization\n");
-	
-	// printf("Step 1: Turn off OLED panel\n");
-	OLED_WR_Byte(0xAE, OLED_CMD); //--turn off oled panel
-	
-	// printf("Step 2: Set low column address\n");
-	OLED_WR_Byte(0x00, OLED_CMD); //---set low column address
-	
-	// printf("Step 3: Set high column address\n");
-	OLED_WR_Byte(0x10, OLED_CMD); //---set high column address
-	
-	// printf("Step 4: Set start line address\n");
-	OLED_WR_Byte(0x40, OLED_CMD); //--set start line address  Set Mapping RAM Display Start Line (0x00~0x3F)
-	
-	// printf("Step 5: Set contrast control register\n");
-	OLED_WR_Byte(0x81, OLED_CMD); //--set contrast control register
-	// printf("Step 6: Set SEG output current brightness\n");
-	OLED_WR_Byte(0xCF, OLED_CMD); // Set SEG Output Current Brightness
-	
-	// printf("Step 7: Set SEG/Column mapping (0xa1 normal)\n");
-	OLED_WR_Byte(0xA1, OLED_CMD); //--Set SEG/Column Mapping     0xa0左右反置 0xa1正常
-	
-	// printf("Step 8: Set COM/Row scan direction (0xc8 normal)\n");
-	OLED_WR_Byte(0xC8, OLED_CMD); // Set COM/Row Scan Direction   0xc0上下反置 0xc8正常
-	
-	// printf("Step 9: Set normal display mode\n");
-	OLED_WR_Byte(0xA6, OLED_CMD); //--set normal display
-	
-	// printf("Step 10: Set multiplex ratio (1 to 64)\n");
-	OLED_WR_Byte(0xA8, OLED_CMD); //--set multiplex ratio(1 to 64)
-	// printf("Step 11: Set 1/64 duty\n");
-	OLED_WR_Byte(0x3f, OLED_CMD); //--1/64 duty
-	
-	// printf("Step 12: Set display offset\n");
-	OLED_WR_Byte(0xD3, OLED_CMD); //-set display offset	Shift Mapping RAM Counter (0x00~0x3F)
-	// printf("Step 13: No offset\n");
-	OLED_WR_Byte(0x00, OLED_CMD); //-not offset
-	
-	// printf("Step 14: Set display clock divide ratio/oscillator frequency\n");
-	OLED_WR_Byte(0xd5, OLED_CMD); //--set display clock divide ratio/oscillator frequency
-	// printf("Step 15: Set divide ratio, clock as 100 frames/sec\n");
-	OLED_WR_Byte(0x80, OLED_CMD); //--set divide ratio, Set Clock as 100 Frames/Sec
-	
-	// printf("Step 16: Set pre-charge period\n");
-	OLED_WR_Byte(0xD9, OLED_CMD); //--set pre-charge period
-	// printf("Step 17: Set pre-charge as 15 clocks & discharge as 1 clock\n");
-	OLED_WR_Byte(0xF1, OLED_CMD); // Set Pre-Charge as 15 Clocks & Discharge as 1 Clock
-	
-	// printf("Step 18: Set COM pins hardware configuration\n");
-	OLED_WR_Byte(0xDA, OLED_CMD); //--set com pins hardware configuration
-	// printf("Step 19: COM pins configuration value 0x12\n");
-	OLED_WR_Byte(0x12, OLED_CMD);
-	
-	// printf("Step 20: Set VCOMH\n");
-	OLED_WR_Byte(0xDB, OLED_CMD); //--set vcomh
-	// printf("Step 21: Set VCOM deselect level\n");
-	OLED_WR_Byte(0x30, OLED_CMD); // Set VCOM Deselect Level
-	
-	// printf("Step 22: Set page addressing mode\n");
-	OLED_WR_Byte(0x20, OLED_CMD); //-Set Page Addressing Mode (0x00/0x01/0x02)
-	// printf("Step 23: Page addressing mode value 0x02\n");
-	OLED_WR_Byte(0x02, OLED_CMD); //
-	
-	// printf("Step 24: Set charge pump enable/disable\n");
-	OLED_WR_Byte(0x8D, OLED_CMD); //--set Charge Pump enable/disable
-	// printf("Step 25: Enable charge pump\n");
-	OLED_WR_Byte(0x14, OLED_CMD); //--set(0x10) disable
-	
-	// printf("Step 26: Clear screen\n");
+	LOG_I(OLED, "OLED start initialization\n");
+
+	LOG_D(OLED, "Send init sequence, %u bytes\n", (unsigned)sizeof(oled_init_cmds));
+	OLED_WR_Cmds(oled_init_cmds, sizeof(oled_init_cmds));
+
+	LOG_D(OLED, "Clear screen\n");
+	oled_shadow_valid = 0; // 屏幕RAM内容未知，清屏后整屏发送
 	OLED_Clear();
-	
-	// printf("Step 27: Turn on OLED display\n");
+	OLED_Refresh();
+
+	LOG_D(OLED, "Turn on OLED display\n");
 	OLED_WR_Byte(0xAF, OLED_CMD);
-	
-	printf("OLED initialization complete\n");
+
+	LOG_I(OLED, "OLED initialization complete\n");
 }
 
 
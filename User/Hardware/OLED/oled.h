@@ -3,18 +3,85 @@
 
 #include "stm32f10x.h"
 
-/************************************ЩҪ㲹ȫ************************************** */
+/************************************这些宏需要你补全************************************** */
+// OLED传输方式：1-硬件I2C1（重映射到PB8/PB9，中断发送，传输期间任务阻塞），0-软件I2C
+#define OLED_USE_HW_I2C 1
+
+#if OLED_USE_HW_I2C
+#include "oled_i2c.h"
+#define OLED_I2C_Init()									OLED_HW_I2C_Init()
+#define OLED_Send_Byte(dev_addr, reg_addr, data) 		OLED_HW_I2C_Write_Byte(dev_addr, reg_addr, data)
+#define OLED_Send_Bytes(dev_addr, reg_addr, len, pdata) OLED_HW_I2C_Write_Bytes(dev_addr, reg_addr, len, pdata)
+#define OLED_Send_Window(dev_addr, reg_addr, width, rows, stride, pdata) \
+	OLED_HW_I2C_Write_Window(dev_addr, reg_addr, width, rows, stride, pdata)
+#else
 #include "soft_i2c.h"
 #define OLED_I2C_Init()									Soft_I2C_Init()
 #define OLED_Send_Byte(dev_addr, reg_addr, data) 		Soft_I2C_Write_Byte(dev_addr, reg_addr, data)
-#define OLED_Send_Bytes(dev_addr, reg_addr, len, pdata) Soft_I2C_Write_Bytes(dev_addr, reg_addr, len, pdata)
+#define OLED_Send_Bytes(dev_addr, reg_addr, len, pdata) Soft_I2C_Write_Bytes_NoAck(dev_addr, reg_addr, len, pdata)
+#define OLED_Send_Window(dev_addr, reg_addr, width, rows, stride, pdata) \
+	Soft_I2C_Write_Window_NoAck(dev_addr, reg_addr, width, rows, stride, pdata)
+#endif
 /****************************************end********************************************** */
-#define OLED_CMD 0  // д
-#define OLED_DATA 1 // д
+#define OLED_DIRTY_SPANS     4 // 每页最多记录的脏列区间数，超出时并入最近的区间
+#define OLED_DIRTY_MERGE_GAP 6 // 间隔不超过该列数的区间直接合并（比多发一次地址命令更省）
+#define OLED_WINDOW_COST     12 // 多开一个地址窗口的总线开销（字节）：窗口命令8字节+数据传输地址/控制2字节+起停
+#define OLED_DISPLAY_TASK_PRIO  3   // 显示任务优先级（低于菜单/按键，发送不耽误输入处理）
+#define OLED_DISPLAY_TASK_STACK 160 // 显示任务堆栈（字），绘制命令也在该任务里执行
+#define OLED_DAMAGE_HOOKS    2  // 显存改写回调个数（文字缓存、控件层）
+
+// 页面切换动画（OLED_Slide）：用显示起始行寄存器整屏上下滚动，每步只写入卷进来的一页
+#define OLED_SLIDE_NONE       0
+#define OLED_SLIDE_UP         1 // 旧画面上移，新画面从底部推入
+#define OLED_SLIDE_DOWN       2 // 旧画面下移，新画面从顶部推入
+#define OLED_SLIDE_MS         130 // 整个切换动画的时长（按时间缓动，与总线快慢无关）
+
+// 点阵绘制模式（OLED_ShowChar/OLED_ShowPicture/OLED_Blit的mode参数）
+#define OLED_MODE_INVERSE     0 // 反色：1位熄灭、0位点亮
+#define OLED_MODE_NORMAL      1 // 正常：1位点亮、0位熄灭
+#define OLED_MODE_TRANSPARENT 2 // 透明：只点亮1位，0位保留原内容
+
+// 压缩位图（Tools/asset_packer.py 生成，见 logo.c），用 OLED_ShowBitmap 边解码边写入显存
+// 操作码：0x00~0x3F 字面量n+1字节；0x40~0x7F 下一字节重复(n&0x3F)+2次；0x80~0xFF 跳过(n&0x7F)+1字节
+#define OLED_BMP_DELTA        0x01 // 差分帧：只含与前一帧不同的字节，须在同一位置紧接前一帧画，且不能用透明模式
+typedef struct
+{
+	const uint8_t *data; // 操作码流
+	uint8_t w;           // 宽度（列数）
+	uint8_t h;           // 高度（行数，8的倍数）
+	uint8_t flags;       // OLED_BMP_xxx
+} oled_bitmap_t;
+
+// 字库（Tools/font_packer.py 生成，见 oledfont.c），只含固件里用到的字符，用 OLED_Font_Glyph 查找
+typedef struct
+{
+	const uint8_t *data;    // 字模：定长时每个(height+7)/8*width字节，压缩时为操作码流（同oled_bitmap_t）
+	const uint16_t *offset; // 压缩时每个字模在data中的起点，定长时为NULL
+	const uint16_t *codes;  // 字符不连续时的升序字符表（Unicode），连续时为NULL，从first开始
+	const uint8_t *metrics; // 比例字体每字模一字节：高4位起始列，低4位字宽（含字距）；等宽字体为NULL
+	uint16_t first;         // 连续字符集的首字符
+	uint16_t count;         // 字模个数
+	uint8_t height;         // 字号（行数）
+	uint8_t width;          // 字宽（列数）
+} oled_font_t;
+
+typedef struct
+{
+	const uint8_t *data; // 字模数据
+	uint8_t width;       // 字模列数
+	uint8_t height;      // 行数
+	uint8_t packed;      // 1-data为压缩操作码流
+	uint8_t col;         // 从字模第col列开始画（比例字体跳过左侧空白）
+	uint8_t advance;     // 画advance列后接下一个字，超出字模的列画成空白
+} oled_glyph_t;
+
+#define OLED_CMD 0  // 写命令
+#define OLED_DATA 1 // 写数据
 void OLED_ClearPoint(uint8_t x, uint8_t y);
 void OLED_ColorTurn(uint8_t i);
 void OLED_DisplayTurn(uint8_t i);
 void OLED_WR_Byte(uint8_t dat, uint8_t mode);
+void OLED_WR_Cmds(const uint8_t *cmd, uint8_t len);
 void OLED_DisPlay_On(void);
 void OLED_DisPlay_Off(void);
 void OLED_Refresh(void);
@@ -22,14 +89,27 @@ void OLED_Refresh_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
 void OLED_Set_Dirty_Area(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
 void OLED_Refresh_Dirty(void);
 void OLED_Clear(void);
+void OLED_Begin_Frame(void);
+void OLED_End_Frame(void);
+uint8_t OLED_Display_CreateTask(void);
+uint8_t OLED_Display_Running(void);
+void OLED_Set_Frame_Hook(void (*hook)(void));
+void OLED_Slide(uint8_t dir);
+void OLED_Set_Start_Line(uint8_t line);
 void OLED_DrawPoint(uint8_t x, uint8_t y, uint8_t t);
+void OLED_Blit(uint8_t x, uint8_t y, uint8_t w, uint8_t pages, const uint8_t *src, uint8_t mode);
+void OLED_Fill_Rect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t t);
 void OLED_DrawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t mode);
 void OLED_DrawCircle(uint8_t x, uint8_t y, uint8_t r);
+uint8_t OLED_Font_Glyph(uint8_t size1, uint16_t code, oled_glyph_t *glyph);
+uint8_t OLED_ShowGlyph(uint8_t x, uint8_t y, uint16_t code, uint8_t size1, uint8_t mode);
 void OLED_ShowChar(uint8_t x, uint8_t y, uint8_t chr, uint8_t size1, uint8_t mode);
-void OLED_ShowString(uint8_t x, uint8_t y, uint8_t *chr, uint8_t size1, uint8_t mode);
+uint8_t OLED_ShowString(uint8_t x, uint8_t y, uint8_t *chr, uint8_t size1, uint8_t mode);
+uint16_t OLED_Text_Width(const uint8_t *chr, uint8_t size1);
+uint8_t OLED_Add_Damage_Hook(void (*hook)(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2));
 void OLED_ShowNum(uint8_t x, uint8_t y, u32 num, uint8_t len, uint8_t size1, uint8_t mode);
-// void OLED_ShowChinese(uint8_t x, uint8_t y, uint8_t num, uint8_t size1, uint8_t mode);
 // void OLED_ScrollDisplay(uint8_t num, uint8_t space, uint8_t mode);
 void OLED_ShowPicture(uint8_t x, uint8_t y, uint8_t sizex, uint8_t sizey, const uint8_t BMP[], uint8_t mode);
+void OLED_ShowBitmap(uint8_t x, uint8_t y, const oled_bitmap_t *bmp, uint8_t mode);
 void OLED_Init(void);
 #endif
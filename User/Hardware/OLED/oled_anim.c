@@ -0,0 +1,137 @@
+/**
+ * @file oled_anim.c
+ * @brief UI动画实现
+ */
+#include "oled_anim.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define OLED_ANIM_SHIFT 10 // OLED_ANIM_ONE = 1 << 10
+
+static uint32_t oled_anim_frame_start = 0; // 本帧开始时刻（ms）
+static uint8_t oled_anim_running = 0;      // 本帧取过值的动画里有没结束的
+
+static uint32_t OLED_Anim_Now(void)
+{
+    return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
+
+/**
+ * @brief 缓动曲线
+ * @param ease: OLED_EASE_xxx
+ * @param t: 时间进度 0~OLED_ANIM_ONE
+ * @return 位置进度 0~OLED_ANIM_ONE
+ */
+uint16_t OLED_Anim_Ease(uint8_t ease, uint16_t t)
+{
+    uint32_t u;
+
+    if (t >= OLED_ANIM_ONE)
+        return OLED_ANIM_ONE;
+
+    switch (ease)
+    {
+    case OLED_EASE_OUT:
+        // 1 - (1-t)^2
+        u = OLED_ANIM_ONE - t;
+        return (uint16_t)(OLED_ANIM_ONE - ((u * u) >> OLED_ANIM_SHIFT));
+    case OLED_EASE_IN_OUT:
+        // 3t^2 - 2t^3，t取最大值时乘积也不超过2^30
+        return (uint16_t)(((uint32_t)t * t * (3 * OLED_ANIM_ONE - 2 * (uint32_t)t)) >> (2 * OLED_ANIM_SHIFT));
+    default:
+        return t;
+    }
+}
+
+/**
+ * @brief 直接设为某个值（停止动画）
+ */
+void OLED_Anim_Set(oled_anim_t *anim, int32_t value)
+{
+    anim->from = value;
+    anim->to = value;
+    anim->active = 0;
+}
+
+/**
+ * @brief 从from开始，duration_ms内按缓动曲线变化到to
+ */
+void OLED_Anim_Start(oled_anim_t *anim, int32_t from, int32_t to, uint16_t duration_ms, uint8_t ease)
+{
+    anim->from = from;
+    anim->to = to;
+    anim->start = OLED_Anim_Now();
+    anim->duration = duration_ms;
+    anim->ease = ease;
+    anim->active = (from != to && duration_ms > 0);
+}
+
+/**
+ * @brief 换终点：从当前值重新开始，终点没变时不打断正在进行的动画
+ */
+void OLED_Anim_Retarget(oled_anim_t *anim, int32_t to, uint16_t duration_ms, uint8_t ease)
+{
+    if (to == anim->to)
+        return;
+    OLED_Anim_Start(anim, OLED_Anim_Value(anim), to, duration_ms, ease);
+}
+
+/**
+ * @brief 时间进度（0~OLED_ANIM_ONE），到时间后动画结束
+ * @note  未结束时本帧需要下一帧（见OLED_Anim_Frame_End），只在菜单任务的绘制里调用
+ */
+uint16_t OLED_Anim_Progress(oled_anim_t *anim)
+{
+    uint32_t elapsed;
+
+    if (!anim->active)
+        return OLED_ANIM_ONE;
+
+    elapsed = OLED_Anim_Now() - anim->start;
+    if (elapsed >= anim->duration)
+    {
+        anim->active = 0;
+        return OLED_ANIM_ONE;
+    }
+    oled_anim_running = 1;
+    return (uint16_t)((elapsed << OLED_ANIM_SHIFT) / anim->duration);
+}
+
+/**
+ * @brief 当前值
+ */
+int32_t OLED_Anim_Value(oled_anim_t *anim)
+{
+    int32_t e = OLED_Anim_Ease(anim->ease, OLED_Anim_Progress(anim));
+
+    return anim->from + (anim->to - anim->from) * e / OLED_ANIM_ONE;
+}
+
+/**
+ * @brief 开始画一帧（菜单刷新时调用）
+ */
+void OLED_Anim_Frame_Begin(void)
+{
+    oled_anim_frame_start = OLED_Anim_Now();
+    oled_anim_running = 0;
+}
+
+/**
+ * @brief 一帧画完
+ * @param delay_ms: 返回到下一帧的等待时间
+ * @return 1-有进行中的动画，需要在delay_ms后再画一帧；0-没有
+ */
+uint8_t OLED_Anim_Frame_End(uint32_t *delay_ms)
+{
+    uint32_t spent;
+
+    if (!oled_anim_running)
+        return 0;
+
+    spent = OLED_Anim_Now() - oled_anim_frame_start;
+    if (spent + OLED_ANIM_MIN_GAP_MS <= OLED_ANIM_FRAME_MS)
+        *delay_ms = OLED_ANIM_FRAME_MS - spent;
+    else
+        *delay_ms = OLED_ANIM_MIN_GAP_MS; // 超出预算：掉帧，动画按时间取值不会变慢
+    return 1;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file oled_anim.h
+ * @brief UI动画：定点缓动曲线 + 按时间插值 + 帧率上限
+ * @version 0.1
+ * @date 2026-01-10
+ *
+ * 动画的值只由经过的时间决定（tick计时，Q10定点缓动），与页面多久重画一次无关：
+ * 系统忙、帧画得慢时只是掉帧，动画总时长和终点不变。
+ *
+ * 帧调度：菜单刷新一帧前调用OLED_Anim_Frame_Begin，画完后调用OLED_Anim_Frame_End，
+ * 本帧里取过值且还没结束的动画会让它返回下一帧的等待时间。下一帧从本帧开始时刻起算，
+ * 不超过OLED_ANIM_FRAME_MS一帧；本帧超出预算时至少留OLED_ANIM_MIN_GAP_MS给低优先级任务。
+ * 没有进行中的动画就不安排动画帧。
+ */
+#ifndef __OLED_ANIM_H
+#define __OLED_ANIM_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+#define OLED_ANIM_ONE         1024 // 进度1.0（Q10）
+#define OLED_ANIM_FRAME_MS    20   // 动画帧率上限：每帧至少间隔20ms（50fps）
+#define OLED_ANIM_MIN_GAP_MS  5    // 帧超出预算时，到下一帧之间至少让出的时间
+
+// 缓动曲线
+#define OLED_EASE_LINEAR      0 // 匀速
+#define OLED_EASE_OUT         1 // 先快后慢（二次），适合追数值
+#define OLED_EASE_IN_OUT      2 // 慢-快-慢（smoothstep），适合整屏切换
+
+typedef struct
+{
+    int32_t from;      // 起点
+    int32_t to;        // 终点
+    uint32_t start;    // 开始时刻（tick）
+    uint16_t duration; // 时长（ms）
+    uint8_t ease;      // OLED_EASE_xxx
+    uint8_t active;    // 1-进行中
+} oled_anim_t;
+
+uint16_t OLED_Anim_Ease(uint8_t ease, uint16_t t);
+void OLED_Anim_Set(oled_anim_t *anim, int32_t value);
+void OLED_Anim_Start(oled_anim_t *anim, int32_t from, int32_t to, uint16_t duration_ms, uint8_t ease);
+void OLED_Anim_Retarget(oled_anim_t *anim, int32_t to, uint16_t duration_ms, uint8_t ease);
+uint16_t OLED_Anim_Progress(oled_anim_t *anim);
+int32_t OLED_Anim_Value(oled_anim_t *anim);
+
+void OLED_Anim_Frame_Begin(void);
+uint8_t OLED_Anim_Frame_End(uint32_t *delay_ms);
+
+#endif
@@ -0,0 +1,326 @@
+/**
+ * @file oled_draw.c
+ * @brief OLED绘制命令队列实现
+ */
+#include "oled_draw.h"
+#include "oled.h"
+#include "oled_print.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+volatile uint16_t oled_draw_dropped = 0;
+
+// 环形队列，投递/取出都在临界区内完成
+static oled_draw_cmd_t oled_draw_queue[OLED_DRAW_QUEUE_LEN];
+static uint8_t oled_draw_head = 0;
+static uint8_t oled_draw_count = 0;
+
+// 算出命令影响的屏幕区域（含边界），投递时在临界区外调用一次：
+// 文字要解码UTF-8、逐字量宽，不能放进关中断的入队比较里
+static void OLED_Draw_Bounds(oled_draw_cmd_t *cmd)
+{
+    uint16_t x1 = cmd->x, y1 = cmd->y, x2, y2; // 放宽到16位避免回绕
+
+    switch (cmd->type)
+    {
+    case OLED_DRAW_TEXT:
+        x2 = x1 + OLED_Text_Width((const uint8_t *)cmd->u.text, cmd->h);
+        y2 = y1 + (cmd->h + 7) / 8 * 8;
+        break;
+    case OLED_DRAW_LINE:
+        x1 = 0;
+        y1 = cmd->x * OLED_LINE_HEIGHT;
+        x2 = 128;
+        y2 = y1 + OLED_LINE_HEIGHT;
+        break;
+    case OLED_DRAW_BITMAP:
+        x2 = x1 + cmd->w;
+        y2 = y1 + (cmd->h + 7) / 8 * 8;
+        break;
+    case OLED_DRAW_CLEAR:
+        x1 = 0;
+        y1 = 0;
+        x2 = 128;
+        y2 = 64;
+        break;
+    default:
+        x2 = x1 + cmd->w;
+        y2 = y1 + cmd->h;
+        break;
+    }
+    // 上面算出的是开区间终点，转成含边界；超出255的部分早已在屏幕外，截断不影响比较
+    if (x2 > x1) x2--;
+    if (y2 > y1) y2--;
+    cmd->x1 = (uint8_t)x1;
+    cmd->y1 = (uint8_t)y1;
+    cmd->x2 = (uint8_t)(x2 > 255 ? 255 : x2);
+    cmd->y2 = (uint8_t)(y2 > 255 ? 255 : y2);
+}
+
+static uint8_t OLED_Draw_Overlap(const oled_draw_cmd_t *a, const oled_draw_cmd_t *b)
+{
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+// 新命令能否直接替换队列里的旧命令：同类、同位置，且新命令覆盖旧命令的全部区域
+static uint8_t OLED_Draw_Supersedes(const oled_draw_cmd_t *new_cmd, const oled_draw_cmd_t *old)
+{
+    if (new_cmd->type != old->type || new_cmd->x != old->x || new_cmd->y != old->y)
+    {
+        return 0;
+    }
+    switch (new_cmd->type)
+    {
+    case OLED_DRAW_TEXT:
+        return new_cmd->h == old->h && new_cmd->x2 >= old->x2; // 新文字至少一样宽
+    case OLED_DRAW_LINE:
+        return 1;
+    default:
+        return new_cmd->w == old->w && new_cmd->h == old->h;
+    }
+}
+
+// 入队（临界区内调用）：从新到旧找可替换的同位置命令，遇到与之重叠的其他命令就停止，
+// 否则追加到队尾
+static uint8_t OLED_Draw_Enqueue(const oled_draw_cmd_t *cmd)
+{
+    uint8_t i, idx;
+
+    if (cmd->type == OLED_DRAW_CLEAR)
+    {
+        // 清屏覆盖之前所有未执行的命令
+        oled_draw_head = 0;
+        oled_draw_count = 0;
+    }
+
+    for (i = oled_draw_count; i > 0; i--)
+    {
+        idx = (oled_draw_head + i - 1) % OLED_DRAW_QUEUE_LEN;
+        if (OLED_Draw_Supersedes(cmd, &oled_draw_queue[idx]))
+        {
+            oled_draw_queue[idx] = *cmd;
+            return OLED_DRAW_OK;
+        }
+        if (OLED_Draw_Overlap(cmd, &oled_draw_queue[idx]))
+        {
+            break;
+        }
+    }
+
+    if (oled_draw_count >= OLED_DRAW_QUEUE_LEN)
+    {
+        return OLED_DRAW_FULL;
+    }
+    oled_draw_queue[(oled_draw_head + oled_draw_count) % OLED_DRAW_QUEUE_LEN] = *cmd;
+    oled_draw_count++;
+    return OLED_DRAW_OK;
+}
+
+static void OLED_Draw_Run(const oled_draw_cmd_t *cmd)
+{
+    switch (cmd->type)
+    {
+    case OLED_DRAW_TEXT:
+        OLED_ShowString(cmd->x, cmd->y, (uint8_t *)cmd->u.text, cmd->h, cmd->mode);
+        break;
+    case OLED_DRAW_LINE:
+        OLED_Text_Put(0, cmd->x * OLED_LINE_HEIGHT, 12, 128, OLED_LINE_HEIGHT, cmd->u.text);
+        break;
+    case OLED_DRAW_RECT:
+        OLED_Fill_Rect(cmd->x, cmd->y, cmd->x + cmd->w - 1, cmd->y + cmd->h - 1, cmd->mode);
+        break;
+    case OLED_DRAW_BITMAP:
+        OLED_ShowPicture(cmd->x, cmd->y, cmd->w, cmd->h, cmd->u.bmp, cmd->mode);
+        break;
+    case OLED_DRAW_PROGRESS:
+        OLED_DrawProgressBar(cmd->x, cmd->y, cmd->w, cmd->h,
+                             cmd->u.bar.value, cmd->u.bar.min, cmd->u.bar.max,
+                             (cmd->u.bar.flags & OLED_BAR_BORDER) ? 1 : 0,
+                             (cmd->u.bar.flags & OLED_BAR_FILL) ? 1 : 0,
+                             (cmd->u.bar.flags & OLED_BAR_INVERT) ? 0 : 1);
+        break;
+    case OLED_DRAW_CLEAR:
+        OLED_Clear();
+        break;
+    default:
+        break;
+    }
+}
+
+// 显示任务取帧前（持有帧锁）调用：按投递顺序执行全部命令
+static void OLED_Draw_Execute(void)
+{
+    oled_draw_cmd_t cmd;
+
+    for (;;)
+    {
+        taskENTER_CRITICAL();
+        if (oled_draw_count == 0)
+        {
+            taskEXIT_CRITICAL();
+            return;
+        }
+        cmd = oled_draw_queue[oled_draw_head];
+        oled_draw_head = (oled_draw_head + 1) % OLED_DRAW_QUEUE_LEN;
+        oled_draw_count--;
+        taskEXIT_CRITICAL();
+
+        OLED_Draw_Run(&cmd);
+    }
+}
+
+static uint8_t OLED_Draw_Post(oled_draw_cmd_t *cmd)
+{
+    uint8_t ret;
+
+    if (!OLED_Display_Running())
+    {
+        // 调度器启动前/没有显示任务：当场绘制
+        OLED_Draw_Run(cmd);
+        OLED_Refresh_Dirty();
+        return OLED_DRAW_OK;
+    }
+
+    OLED_Draw_Bounds(cmd);
+    taskENTER_CRITICAL();
+    ret = OLED_Draw_Enqueue(cmd);
+    taskEXIT_CRITICAL();
+
+    if (ret != OLED_DRAW_OK)
+    {
+        oled_draw_dropped++;
+    }
+    OLED_Refresh_Dirty(); // 通知显示任务（帧内投递时随OLED_End_Frame提交）
+    return ret;
+}
+
+/**
+ * @brief  注册到显示任务，显示任务每次取帧前执行队列里的命令
+ */
+void OLED_Draw_Init(void)
+{
+    OLED_Set_Frame_Hook(OLED_Draw_Execute);
+}
+
+/**
+ * @brief  投递字符串显示命令（格式化在调用者的栈上完成，不共用缓冲）
+ * @param  x,y: 起点坐标
+ * @param  size: 字号 8/12/16/24
+ * @param  mode: OLED_MODE_xxx
+ * @retval OLED_DRAW_OK / OLED_DRAW_FULL
+ */
+uint8_t OLED_Post_Text(uint8_t x, uint8_t y, uint8_t size, uint8_t mode, const char *format, ...)
+{
+    oled_draw_cmd_t cmd;
+    va_list args;
+
+    cmd.type = OLED_DRAW_TEXT;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = 0;
+    cmd.h = size;
+    cmd.mode = mode;
+    va_start(args, format);
+    vsnprintf(cmd.u.text, sizeof(cmd.u.text), format, args);
+    va_end(args);
+    return OLED_Draw_Post(&cmd);
+}
+
+/**
+ * @brief  投递整行显示命令，效果同OLED_Printf_Line
+ * @param  line: 行号（0-3）
+ * @retval OLED_DRAW_OK / OLED_DRAW_FULL
+ */
+uint8_t OLED_Post_Line(uint8_t line, const char *format, ...)
+{
+    oled_draw_cmd_t cmd;
+    va_list args;
+
+    if (line >= OLED_MAX_LINES)
+        return OLED_DRAW_OK;
+
+    cmd.type = OLED_DRAW_LINE;
+    cmd.x = line;
+    cmd.y = 0;
+    cmd.w = 0;
+    cmd.h = 0;
+    cmd.mode = OLED_MODE_NORMAL;
+    va_start(args, format);
+    vsnprintf(cmd.u.text, sizeof(cmd.u.text), format, args);
+    va_end(args);
+    return OLED_Draw_Post(&cmd);
+}
+
+/**
+ * @brief  投递矩形填充命令
+ * @param  fill: 1填充 0清除
+ */
+uint8_t OLED_Post_Rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t fill)
+{
+    oled_draw_cmd_t cmd;
+
+    if (w == 0 || h == 0)
+        return OLED_DRAW_OK;
+
+    cmd.type = OLED_DRAW_RECT;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.mode = fill;
+    return OLED_Draw_Post(&cmd);
+}
+
+/**
+ * @brief  投递图片显示命令（图片数据必须常驻，执行时才读取）
+ */
+uint8_t OLED_Post_Bitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *bmp, uint8_t mode)
+{
+    oled_draw_cmd_t cmd;
+
+    cmd.type = OLED_DRAW_BITMAP;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.mode = mode;
+    cmd.u.bmp = bmp;
+    return OLED_Draw_Post(&cmd);
+}
+
+/**
+ * @brief  投递进度条命令
+ * @param  flags: OLED_BAR_BORDER | OLED_BAR_FILL | OLED_BAR_INVERT
+ */
+uint8_t OLED_Post_Progress(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                           int16_t value, int16_t min, int16_t max, uint8_t flags)
+{
+    oled_draw_cmd_t cmd;
+
+    cmd.type = OLED_DRAW_PROGRESS;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.mode = 0;
+    cmd.u.bar.value = value;
+    cmd.u.bar.min = min;
+    cmd.u.bar.max = max;
+    cmd.u.bar.flags = flags;
+    return OLED_Draw_Post(&cmd);
+}
+
+/**
+ * @brief  投递清屏命令（队列里尚未执行的命令一并作废）
+ */
+uint8_t OLED_Post_Clear(void)
+{
+    oled_draw_cmd_t cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = OLED_DRAW_CLEAR;
+    return OLED_Draw_Post(&cmd);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file oled_draw.h
+ * @brief OLED绘制命令队列：任何任务都可以非阻塞地投递绘制命令，由显示任务统一执行
+ * @version 0.1
+ * @date 2025-12-29
+ *
+ * 菜单任务以外的任务（ESP8266联网、时间同步等）不要直接调用OLED_Printf/OLED_ShowString，
+ * 而是投递命令：显示任务在帧锁内按顺序执行，与菜单的绘制串行，不会画出半帧或互相覆盖格式化缓冲。
+ * 同一位置的同类命令在执行前被新命令覆盖（中间没有重叠的其他命令时），队列满时丢弃并计数。
+ * 显示任务未运行（调度器启动前）时投递即当场绘制并刷新。
+ */
+#ifndef __OLED_DRAW_H
+#define __OLED_DRAW_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+#define OLED_DRAW_QUEUE_LEN     8   // 队列深度
+#define OLED_DRAW_TEXT_LEN      22  // 文本命令最多字符数（含结束符，6像素字宽时一整行21个字符）
+
+// 返回值
+#define OLED_DRAW_OK            0
+#define OLED_DRAW_FULL          1   // 队列满，命令被丢弃
+
+// 命令类型
+#define OLED_DRAW_TEXT          1   // 在(x,y)显示字符串，字号h，模式mode
+#define OLED_DRAW_LINE          2   // 清除第x行(16像素一行)后显示12号字符串，同OLED_Printf_Line
+#define OLED_DRAW_RECT          3   // 填充/清除矩形 (x,y)-(x+w-1,y+h-1)，mode:1填充 0清除
+#define OLED_DRAW_BITMAP        4   // 显示w×h图片，同OLED_ShowPicture
+#define OLED_DRAW_PROGRESS      5   // 进度条，同OLED_DrawProgressBar
+#define OLED_DRAW_CLEAR         6   // 清屏
+
+// 进度条选项（flags）
+#define OLED_BAR_BORDER         0x01
+#define OLED_BAR_FILL           0x02
+#define OLED_BAR_INVERT         0x04
+
+typedef struct
+{
+    uint8_t type;
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+    uint8_t mode;
+    uint8_t x1, y1, x2, y2; // 影响的屏幕区域（含边界），投递时在临界区外算好，入队比较只用它
+    union
+    {
+        char text[OLED_DRAW_TEXT_LEN];
+        const uint8_t *bmp;
+        struct
+        {
+            int16_t value;
+            int16_t min;
+            int16_t max;
+            uint8_t flags;
+        } bar;
+    } u;
+} oled_draw_cmd_t;
+
+void OLED_Draw_Init(void);
+uint8_t OLED_Post_Text(uint8_t x, uint8_t y, uint8_t size, uint8_t mode, const char *format, ...);
+uint8_t OLED_Post_Line(uint8_t line, const char *format, ...);
+uint8_t OLED_Post_Rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t fill);
+uint8_t OLED_Post_Bitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *bmp, uint8_t mode);
+uint8_t OLED_Post_Progress(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                           int16_t value, int16_t min, int16_t max, uint8_t flags);
+uint8_t OLED_Post_Clear(void);
+
+extern volatile uint16_t oled_draw_dropped; // 队列满丢弃的命令数
+
+#endif
@@ -0,0 +1,374 @@
+/**
+ * @file oled_i2c.c
+ * @brief OLED硬件I2C传输：中断驱动的主机发送状态机，可选DMA搬运数据
+ * @version 0.1
+ * @date 2025-12-26
+ *
+ * 一次传输：START -> 地址 -> 控制字节(reg_addr) -> 数据 -> STOP
+ *   SB    写地址
+ *   ADDR  清标志，写控制字节，打开TXE中断（或启动DMA）
+ *   TXE   写下一个数据字节（窗口传输在行尾跳到下一行起点），写完最后一个关TXE中断
+ *   BTF   数据全部移出，发STOP并唤醒等待的任务
+ * 调度器启动前（OLED_Init阶段）没有任务可阻塞，而且FreeRTOS的API调用会把BASEPRI留在屏蔽状态，
+ * 中断进不来，因此那时不开中断，直接轮询同一个状态机。
+ */
+#include "oled_i2c.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#if OLED_I2C_IRQ_PRIO < configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#error "OLED_I2C_IRQ_PRIO must not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY"
+#endif
+
+volatile uint16_t oled_i2c_error_count = 0;
+
+static volatile uint8_t oled_i2c_busy = 0;
+static volatile uint8_t oled_i2c_result = OLED_I2C_OK;
+static const uint8_t *volatile oled_i2c_data = NULL;
+static volatile uint32_t oled_i2c_len = 0;
+static uint32_t oled_i2c_row_len = 0;   // 窗口传输：每行字节数
+static uint32_t oled_i2c_row_left = 0;  // 当前行剩余字节数
+static uint32_t oled_i2c_row_skip = 0;  // 行尾跳过的字节数（跨距-行宽），0表示数据连续
+static uint8_t oled_i2c_addr = 0;
+static uint8_t oled_i2c_reg = 0;
+static uint8_t oled_i2c_byte = 0; // 单字节写的数据暂存
+static SemaphoreHandle_t oled_i2c_done = NULL;
+
+/**
+ * @brief  配置I2C1外设（初始化和超时恢复共用）
+ */
+static void OLED_HW_I2C_Config(void)
+{
+    I2C_InitTypeDef I2C_InitStruct;
+
+    // 软件复位，清掉可能卡住的BUSY状态
+    I2C_SoftwareResetCmd(I2C1, ENABLE);
+    I2C_SoftwareResetCmd(I2C1, DISABLE);
+
+    I2C_InitStruct.I2C_Mode = I2C_Mode_I2C;
+    I2C_InitStruct.I2C_DutyCycle = I2C_DutyCycle_2;
+    I2C_InitStruct.I2C_OwnAddress1 = 0x00;
+    I2C_InitStruct.I2C_Ack = I2C_Ack_Enable;
+    I2C_InitStruct.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
+    I2C_InitStruct.I2C_ClockSpeed = OLED_I2C_SPEED;
+    I2C_Init(I2C1, &I2C_InitStruct);
+    I2C_Cmd(I2C1, ENABLE);
+}
+
+/**
+ * @brief  初始化I2C1（重映射到PB8/PB9）、中断和完成信号量
+ */
+void OLED_HW_I2C_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct;
+    NVIC_InitTypeDef NVIC_InitStruct;
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_I2C1, ENABLE);
+    GPIO_PinRemapConfig(GPIO_Remap_I2C1, ENABLE);
+
+    // PB8-SCL, PB9-SDA 复用开漏
+    GPIO_InitStruct.GPIO_Pin = GPIO_Pin_8 | GPIO_Pin_9;
+    GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF_OD;
+    GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+    OLED_HW_I2C_Config();
+
+#if OLED_I2C_USE_DMA
+    {
+        DMA_InitTypeDef DMA_InitStruct;
+
+        // I2C1_TX 对应 DMA1_Channel6
+        RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+        DMA_DeInit(DMA1_Channel6);
+        DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&I2C1->DR;
+        DMA_InitStruct.DMA_MemoryBaseAddr = 0;                         // 每次传输时设置
+        DMA_InitStruct.DMA_DIR = DMA_DIR_PeripheralDST;
+        DMA_InitStruct.DMA_BufferSize = 0;
+        DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+        DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;
+        DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+        DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+        DMA_InitStruct.DMA_Mode = DMA_Mode_Normal;
+        DMA_InitStruct.DMA_Priority = DMA_Priority_Medium;
+        DMA_InitStruct.DMA_M2M = DMA_M2M_Disable;
+        DMA_Init(DMA1_Channel6, &DMA_InitStruct);
+    }
+#endif
+
+    NVIC_InitStruct.NVIC_IRQChannel = I2C1_EV_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = OLED_I2C_IRQ_PRIO;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+
+    NVIC_InitStruct.NVIC_IRQChannel = I2C1_ER_IRQn;
+    NVIC_Init(&NVIC_InitStruct);
+
+    if (oled_i2c_done == NULL)
+    {
+        oled_i2c_done = xSemaphoreCreateBinary();
+    }
+}
+
+/**
+ * @brief  结束一次传输（中断中调用）
+ */
+static void OLED_HW_I2C_Finish(uint8_t result)
+{
+    BaseType_t woken = pdFALSE;
+
+    I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
+    I2C_GenerateSTOP(I2C1, ENABLE);
+#if OLED_I2C_USE_DMA
+    I2C_DMACmd(I2C1, DISABLE);
+    DMA_Cmd(DMA1_Channel6, DISABLE);
+#endif
+    oled_i2c_result = result;
+    oled_i2c_busy = 0;
+
+    if (oled_i2c_done != NULL && xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+    {
+        xSemaphoreGiveFromISR(oled_i2c_done, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief  事件状态机（中断或轮询调用）
+ */
+static void OLED_HW_I2C_Event(void)
+{
+    uint16_t sr1 = I2C1->SR1;
+
+    if (sr1 & I2C_SR1_SB)
+    {
+        I2C1->DR = oled_i2c_addr; // 读SR1后写DR清除SB
+        return;
+    }
+
+    if (sr1 & I2C_SR1_ADDR)
+    {
+        (void)I2C1->SR2;          // 读SR2清除ADDR
+        I2C1->DR = oled_i2c_reg;  // 控制字节：0x00命令 / 0x40数据
+        if (oled_i2c_len > 0)
+        {
+#if OLED_I2C_USE_DMA
+            if (oled_i2c_row_skip == 0)
+            {
+                DMA1_Channel6->CMAR = (uint32_t)oled_i2c_data;
+                DMA1_Channel6->CNDTR = oled_i2c_len;
+                oled_i2c_len = 0;
+                DMA_Cmd(DMA1_Channel6, ENABLE);
+                I2C_DMACmd(I2C1, ENABLE);
+                return;
+            }
+#endif
+            I2C_ITConfig(I2C1, I2C_IT_BUF, ENABLE); // 不连续的窗口数据由TXE中断逐行送出
+        }
+        return;
+    }
+
+    if ((sr1 & I2C_SR1_TXE) && oled_i2c_len > 0)
+    {
+        I2C1->DR = *oled_i2c_data++;
+        oled_i2c_len--;
+        if (--oled_i2c_row_left == 0)
+        {
+            oled_i2c_data += oled_i2c_row_skip; // 跳到下一行起点
+            oled_i2c_row_left = oled_i2c_row_len;
+        }
+        if (oled_i2c_len == 0)
+        {
+            I2C_ITConfig(I2C1, I2C_IT_BUF, DISABLE); // 等BTF确认最后一字节移出
+        }
+        return;
+    }
+
+    if (sr1 & I2C_SR1_BTF)
+    {
+#if OLED_I2C_USE_DMA
+        if (DMA_GetCurrDataCounter(DMA1_Channel6) != 0)
+        {
+            return; // DMA还在搬运，下一次TXE请求会清掉BTF
+        }
+#endif
+        OLED_HW_I2C_Finish(OLED_I2C_OK);
+    }
+}
+
+/**
+ * @brief  错误处理：应答失败/仲裁丢失/总线错误，清标志后结束本次传输
+ */
+static void OLED_HW_I2C_Error(void)
+{
+    I2C1->SR1 &= (uint16_t)~(I2C_SR1_AF | I2C_SR1_ARLO | I2C_SR1_BERR | I2C_SR1_OVR);
+    oled_i2c_error_count++;
+    OLED_HW_I2C_Finish(OLED_I2C_ERROR);
+}
+
+void I2C1_EV_IRQHandler(void)
+{
+    OLED_HW_I2C_Event();
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+    OLED_HW_I2C_Error();
+}
+
+/**
+ * @brief  等待当前传输结束
+ * @retval OLED_I2C_OK: 成功；OLED_I2C_ERROR: 从机无应答、总线错误或超时
+ */
+uint8_t OLED_HW_I2C_Wait(void)
+{
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+    {
+        // 任务阻塞在信号量上，传输期间不占CPU；上一次残留的信号只会多转一圈
+        TickType_t start = xTaskGetTickCount();
+        TickType_t limit = pdMS_TO_TICKS(OLED_I2C_TIMEOUT_MS);
+        while (oled_i2c_busy && (xTaskGetTickCount() - start) < limit)
+        {
+            xSemaphoreTake(oled_i2c_done, limit - (xTaskGetTickCount() - start));
+        }
+    }
+    else
+    {
+        // 调度器未启动：轮询状态机，超时按最慢每次循环约10个周期估算
+        uint32_t guard = SystemCoreClock / 10000 * OLED_I2C_TIMEOUT_MS / 10;
+        while (oled_i2c_busy && guard-- > 0)
+        {
+            if (I2C1->SR1 & (I2C_SR1_AF | I2C_SR1_ARLO | I2C_SR1_BERR | I2C_SR1_OVR))
+            {
+                OLED_HW_I2C_Error();
+            }
+            else
+            {
+                OLED_HW_I2C_Event();
+            }
+        }
+    }
+
+    if (oled_i2c_busy)
+    {
+        // 超时：复位外设，下一次传输重新开始
+        I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
+#if OLED_I2C_USE_DMA
+        I2C_DMACmd(I2C1, DISABLE);
+        DMA_Cmd(DMA1_Channel6, DISABLE);
+#endif
+        OLED_HW_I2C_Config();
+        oled_i2c_error_count++;
+        oled_i2c_busy = 0;
+        return OLED_I2C_ERROR;
+    }
+    return oled_i2c_result;
+}
+
+uint8_t OLED_HW_I2C_Busy(void)
+{
+    return oled_i2c_busy;
+}
+
+/**
+ * @brief  启动一次窗口写传输后立即返回（上一次未完成时先等待）
+ *         rows行、每行width字节，行首相隔stride字节，在总线上连成一次传输
+ * @param  dev_addr: 7位从机地址
+ * @param  reg_addr: 控制字节
+ * @param  width: 每行字节数
+ * @param  rows: 行数
+ * @param  stride: 相邻两行起点的间隔（>=width），等于width时数据连续
+ * @param  data: 数据，传输完成前不能修改
+ * @retval OLED_I2C_OK: 已启动；OLED_I2C_ERROR: 上一次传输失败
+ * @note   OLED_I2C_USE_DMA时只有连续数据走DMA，不连续的窗口用TXE中断发送
+ */
+uint8_t OLED_HW_I2C_Write_Window_Async(uint8_t dev_addr, uint8_t reg_addr, uint32_t width, uint32_t rows,
+                                       uint32_t stride, const uint8_t *data)
+{
+    uint8_t result = OLED_I2C_OK;
+
+    if (oled_i2c_busy)
+    {
+        result = OLED_HW_I2C_Wait();
+    }
+
+    for (uint16_t guard = 0; (I2C1->CR1 & I2C_CR1_STOP) && guard < 1000; guard++)
+    {
+        // 上一次的STOP还没发完（约一个SCL周期）
+    }
+
+    oled_i2c_addr = (uint8_t)(dev_addr << 1);
+    oled_i2c_reg = reg_addr;
+    oled_i2c_data = data;
+    oled_i2c_len = width * rows;
+    if (stride == width || rows <= 1)
+    {
+        // 连续数据按一整行处理，行尾不跳转
+        oled_i2c_row_len = oled_i2c_len;
+        oled_i2c_row_skip = 0;
+    }
+    else
+    {
+        oled_i2c_row_len = width;
+        oled_i2c_row_skip = stride - width;
+    }
+    oled_i2c_row_left = oled_i2c_row_len;
+    oled_i2c_result = OLED_I2C_OK;
+    oled_i2c_busy = 1;
+
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+    {
+        I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
+    }
+    I2C_GenerateSTART(I2C1, ENABLE);
+    return result;
+}
+
+/**
+ * @brief  启动一次写传输后立即返回（上一次未完成时先等待）
+ * @param  dev_addr: 7位从机地址
+ * @param  reg_addr: 控制字节
+ * @param  len: 数据长度
+ * @param  data: 数据，传输完成前不能修改
+ * @retval OLED_I2C_OK: 已启动；OLED_I2C_ERROR: 上一次传输失败
+ */
+uint8_t OLED_HW_I2C_Write_Async(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, const uint8_t *data)
+{
+    return OLED_HW_I2C_Write_Window_Async(dev_addr, reg_addr, len, 1, len, data);
+}
+
+/**
+ * @brief  窗口写并等待完成（参数同OLED_HW_I2C_Write_Window_Async，0成功1失败）
+ */
+uint8_t OLED_HW_I2C_Write_Window(uint8_t dev_addr, uint8_t reg_addr, uint32_t width, uint32_t rows,
+                                 uint32_t stride, const uint8_t *data)
+{
+    OLED_HW_I2C_Write_Window_Async(dev_addr, reg_addr, width, rows, stride, data);
+    return OLED_HW_I2C_Wait();
+}
+
+/**
+ * @brief  写多个字节并等待完成（与Soft_I2C_Write_Bytes同参数，0成功1失败）
+ */
+uint8_t OLED_HW_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data)
+{
+    OLED_HW_I2C_Write_Async(dev_addr, reg_addr, len, data);
+    return OLED_HW_I2C_Wait();
+}
+
+/**
+ * @brief  写一个字节并等待完成（与Soft_I2C_Write_Byte同参数，0成功1失败）
+ */
+uint8_t OLED_HW_I2C_Write_Byte(uint8_t dev_addr, uint8_t reg_addr, uint8_t data)
+{
+    if (oled_i2c_busy)
+    {
+        OLED_HW_I2C_Wait(); // 暂存字节可能还在被上一次传输使用
+    }
+    oled_i2c_byte = data;
+    OLED_HW_I2C_Write_Async(dev_addr, reg_addr, 1, &oled_i2c_byte);
+    return OLED_HW_I2C_Wait();
+}
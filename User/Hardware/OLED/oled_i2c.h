@@ -0,0 +1,41 @@
+/**
+ * @file oled_i2c.h
+ * @brief OLED硬件I2C传输：I2C1重映射到PB8(SCL)/PB9(SDA)，与软件I2C接线相同
+ * @version 0.1
+ * @date 2025-12-26
+ *
+ * 数据字节由I2C事件中断逐字节送出（或DMA1_Channel6搬运），调用任务在传输期间阻塞让出CPU。
+ * 注意：I2C1_TX固定占用DMA1_Channel6，与USART2_RX(ESP8266)的循环DMA冲突，
+ * 因此默认用中断发送；只有不使用USART2 DMA接收的工程才能打开OLED_I2C_USE_DMA。
+ */
+#ifndef __OLED_I2C_H
+#define __OLED_I2C_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+#define OLED_I2C_SPEED          400000 // SCL频率（F1快速模式上限400kHz）
+#define OLED_I2C_USE_DMA        0      // 1-DMA1_Channel6发送，0-TXE中断发送
+#define OLED_I2C_IRQ_PRIO       6      // 事件/错误/DMA中断优先级，需低于configMAX_SYSCALL
+#define OLED_I2C_TIMEOUT_MS     50     // 单次传输超时（1KB@400kHz约23ms）
+
+// 返回值
+#define OLED_I2C_OK             0
+#define OLED_I2C_ERROR          1
+
+void OLED_HW_I2C_Init(void);
+uint8_t OLED_HW_I2C_Write_Byte(uint8_t dev_addr, uint8_t reg_addr, uint8_t data);
+uint8_t OLED_HW_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data);
+uint8_t OLED_HW_I2C_Write_Window(uint8_t dev_addr, uint8_t reg_addr, uint32_t width, uint32_t rows,
+                                 uint32_t stride, const uint8_t *data);
+
+// 异步接口：启动后立即返回，数据缓冲在OLED_HW_I2C_Wait返回前不能修改
+uint8_t OLED_HW_I2C_Write_Async(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, const uint8_t *data);
+uint8_t OLED_HW_I2C_Write_Window_Async(uint8_t dev_addr, uint8_t reg_addr, uint32_t width, uint32_t rows,
+                                       uint32_t stride, const uint8_t *data);
+uint8_t OLED_HW_I2C_Wait(void);
+uint8_t OLED_HW_I2C_Busy(void);
+
+extern volatile uint16_t oled_i2c_error_count; // NACK/总线错误/超时次数
+
+#endif
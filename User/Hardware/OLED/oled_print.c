@@ -1,23 +1,117 @@
 #include "oled_print.h"
 
-// 临时缓冲区用于格式化字符串
-static char oled_buffer[128];
+// 文字字段缓存：记录每个位置上次显示的内容（哈希）和宽度
+typedef struct
+{
+    uint32_t hash;  // 上次内容的哈希
+    uint8_t x, y;   // 位置
+    uint8_t size;   // 字号
+    uint8_t height; // 字段高度
+    uint8_t width;  // 上次的文字宽度
+    uint8_t valid;  // 1-屏幕上还是上次画的内容
+} oled_text_field_t;
+
+static oled_text_field_t oled_text_fields[OLED_TEXT_FIELDS];
+static uint8_t oled_text_next = 0;                     // 新位置轮流占用的字段
+static oled_text_field_t *oled_text_drawing = NULL;    // 正在画的字段（自己的改写不算覆盖）
+static uint8_t oled_text_enabled = 0;
+
+// 显存改写通知：与字段区域重叠的字段作废，下次必须重画
+static void OLED_Text_Damage(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+{
+    oled_text_field_t *f;
+    uint8_t i;
+
+    for (i = 0; i < OLED_TEXT_FIELDS; i++)
+    {
+        f = &oled_text_fields[i];
+        if (!f->valid || f == oled_text_drawing)
+            continue;
+        if (x1 < f->x + f->width && f->x <= x2 && y1 < f->y + f->height && f->y <= y2)
+            f->valid = 0;
+    }
+}
+
+// FNV-1a
+static uint32_t OLED_Text_Hash(const char *text)
+{
+    uint32_t h = 2166136261UL;
+
+    while (*text)
+    {
+        h ^= (uint8_t)*text++;
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+void OLED_Text_Init(void)
+{
+    memset(oled_text_fields, 0, sizeof(oled_text_fields));
+    oled_text_enabled = OLED_Add_Damage_Hook(OLED_Text_Damage);
+}
+
+uint8_t OLED_Text_Put(uint8_t x, uint8_t y, uint8_t size, uint8_t width, uint8_t height, const char *text)
+{
+    oled_text_field_t *f = NULL;
+    uint32_t hash = OLED_Text_Hash(text);
+    uint16_t end, clear_end;
+    uint8_t i, drawn, rows;
+
+    for (i = 0; i < OLED_TEXT_FIELDS; i++)
+    {
+        if (oled_text_fields[i].x == x && oled_text_fields[i].y == y && oled_text_fields[i].size == size)
+        {
+            f = &oled_text_fields[i];
+            break;
+        }
+    }
+    if (f != NULL && f->valid && f->hash == hash && f->height == height)
+        return 0;
+    if (f == NULL)
+    {
+        f = &oled_text_fields[oled_text_next];
+        oled_text_next = (oled_text_next + 1) % OLED_TEXT_FIELDS;
+        f->x = x;
+        f->y = y;
+        f->size = size;
+        f->valid = 0;
+    }
+
+    oled_text_drawing = f;
+    drawn = OLED_ShowString(x, y, (uint8_t *)text, size, OLED_MODE_NORMAL);
+    end = (uint16_t)x + drawn;
+    clear_end = (f->valid && f->height == height) ? (uint16_t)x + f->width : (uint16_t)x + width;
+    if (clear_end > 128)
+        clear_end = 128;
+    if (end < clear_end)
+        OLED_Fill_Rect(end, y, clear_end - 1, y + height - 1, 0);
+    rows = (size == 8) ? 8 : (size + 7) / 8 * 8; // 字模画满的行数
+    if (drawn > 0 && rows < height)
+        OLED_Fill_Rect(x, y + rows, end - 1, y + height - 1, 0);
+    oled_text_drawing = NULL;
+
+    f->hash = hash;
+    f->height = height;
+    f->width = drawn;
+    f->valid = oled_text_enabled;
+    return 1;
+}
 
 /**
  * @brief OLED打印函数 - 在指定位置格式化打印信息
  */
 void OLED_Printf(uint8_t x, uint8_t y, const char *format, ...)
 {
+    char buf[OLED_PRINTF_BUF]; // 格式化缓冲放在调用者栈上，多个任务同时调用不会互相覆盖
     va_list args;
     va_start(args, format);
 
     // 格式化字符串
-    vsnprintf(oled_buffer, sizeof(oled_buffer), format, args);
- OLED_Clear_Rect(x,y,127,y+OLED_LINE_HEIGHT);
-    // 显示字符串
-    OLED_ShowString(x, y, (uint8_t *)oled_buffer, 12, 1);
-// OLED_Set_Dirty_Area(0, y, 127, y + OLED_LINE_HEIGHT - 1);
-    
+    vsnprintf(buf, sizeof(buf), format, args);
+
+    // 显示字符串（内容没变时跳过），清除上次多出来的部分
+    OLED_Text_Put(x, y, 12, 128 - x, OLED_LINE_HEIGHT, buf);
 
     va_end(args);
 }
@@ -30,23 +124,15 @@ void OLED_Printf_Line(uint8_t line, const char *format, ...)
     if (line >= OLED_MAX_LINES)
         return; // 防止越界
 
+    char buf[OLED_PRINTF_BUF];
     va_list args;
     va_start(args, format);
 
-    // 计算Y坐标
-    uint8_t y = line * OLED_LINE_HEIGHT;
-
     // 格式化字符串
-    vsnprintf(oled_buffer, sizeof(oled_buffer), format, args);
-
-    // 清除该行
-    OLED_Clear_Line(line);
+    vsnprintf(buf, sizeof(buf), format, args);
 
-    // 显示字符串
-    OLED_ShowString(0, y, (uint8_t *)oled_buffer, 12, 1);
-
-    // 标记该行为脏区域，用于局部刷新
-    OLED_Set_Dirty_Area(0, y, strlen(format)*12, y + OLED_LINE_HEIGHT - 1);
+    // 显示字符串：脏区是实际画过/清除的列，按测量的文字宽度而不是格式串长度
+    OLED_Text_Put(0, line * OLED_LINE_HEIGHT, 12, 128, OLED_LINE_HEIGHT, buf);
 
     va_end(args);
 }
@@ -59,23 +145,15 @@ void OLED_Printf_Line_32(uint8_t line, const char *format, ...)
     if (line >= OLED_MAX_LINES)
         return; // 防止越界
 
+    char buf[OLED_PRINTF_BUF];
     va_list args;
     va_start(args, format);
 
-    // 计算Y坐标
-    uint8_t y = line * OLED_LINE_HEIGHT;
-
     // 格式化字符串
-    vsnprintf(oled_buffer, sizeof(oled_buffer), format, args);
-
-    // 清除该行
-    OLED_Clear_Line(line);
+    vsnprintf(buf, sizeof(buf), format, args);
 
-    // 显示字符串
-    OLED_ShowString(0, y, (uint8_t *)oled_buffer, 24, 1);
-
-    // 标记该行为脏区域，用于局部刷新
-    OLED_Set_Dirty_Area(0, y, 127, y + (OLED_LINE_HEIGHT * 2) - 1);
+    // 显示字符串，占两行
+    OLED_Text_Put(0, line * OLED_LINE_HEIGHT, 24, 128, OLED_LINE_HEIGHT * 2, buf);
 
     va_end(args);
 }
@@ -167,17 +245,8 @@ void OLED_Clear_Rect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
     if (y2 >= 64)
         y2 = 63;
 
-    // 按像素逐点清除（保守但安全）
-    for (uint8_t x = x1; x <= x2; x++)
-    {
-        for (uint8_t y = y1; y <= y2; y++)
-        {
-            OLED_DrawPoint(x, y, 0); // 0 = 清空点
-        }
-    }
-
-    // 标记脏区
-    OLED_Set_Dirty_Area(x1, y1, x2, y2);
+    // 按页字节掩码清除，并标记脏区
+    OLED_Fill_Rect(x1, y1, x2, y2, 0);
 }
 /**
  * @brief 绘制通用进度条（横向）
@@ -223,26 +292,10 @@ void OLED_DrawProgressBar(
     // 画边框（可选）
     if (show_border)
     {
-        // 上边
-        for (uint8_t i = 0; i < width; i++)
-        {
-            OLED_DrawPoint(x + i, y, 1);
-        }
-        // 下边
-        for (uint8_t i = 0; i < width; i++)
-        {
-            OLED_DrawPoint(x + i, y + height - 1, 1);
-        }
-        // 左边
-        for (uint8_t i = 0; i < height; i++)
-        {
-            OLED_DrawPoint(x, y + i, 1);
-        }
-        // 右边
-        for (uint8_t i = 0; i < height; i++)
-        {
-            OLED_DrawPoint(x + width - 1, y + i, 1);
-        }
+        OLED_Fill_Rect(x, y, x + width - 1, y, 1);                           // 上边
+        OLED_Fill_Rect(x, y + height - 1, x + width - 1, y + height - 1, 1); // 下边
+        OLED_Fill_Rect(x, y, x, y + height - 1, 1);                          // 左边
+        OLED_Fill_Rect(x + width - 1, y, x + width - 1, y + height - 1, 1);  // 右边
     }
 
     // 填充内部（可选）
@@ -257,56 +310,47 @@ void OLED_DrawProgressBar(
         if (width > height)
         {
             uint8_t x_fill_end = x + fill_w;
+            uint8_t b = show_border ? 1 : 0;
             if (x_fill_end > x + width)
                 x_fill_end = x + width;
-            for (uint8_t xx = x + (show_border ? 1 : 0);
-                 xx < x_fill_end - (show_border ? 1 : 0);
-                 xx++)
+            if (x_fill_end - b > x + b && height > 2 * b)
             {
-                for (uint8_t yy = y + (show_border ? 1 : 0);
-                     yy < y + height - (show_border ? 1 : 0);
-                     yy++)
-                {
-                    OLED_DrawPoint(xx, yy, (point_mode?1:0));
-                }
+                OLED_Fill_Rect(x + b, y + b, x_fill_end - b - 1, y + height - b - 1,
+                               (point_mode ? 1 : 0));
             }
         }else{
              // 计算填充的起始Y坐标（从底部开始）
             uint8_t y_fill_start = y + height - fill_h;
+            uint8_t b = show_border ? 1 : 0;
             if (y_fill_start < y)
                 y_fill_start = y;
             
-            for (uint8_t yy = y_fill_start + (show_border ? 1 : 0);
-                 yy < y + height - (show_border ? 1 : 0);
-                 yy++)
+            if (y + height - b > y_fill_start + b && width > 2 * b)
             {
-                for (uint8_t xx = x + (show_border ? 1 : 0);
-                     xx < x + width - (show_border ? 1 : 0);
-                     xx++)
-                {
-                    OLED_DrawPoint(xx, yy, (point_mode?1:0));
-                }
+                OLED_Fill_Rect(x + b, y_fill_start + b, x + width - b - 1, y + height - b - 1,
+                               (point_mode ? 1 : 0));
             }
         }
     }
 
     // 无需重复调用 OLED_Set_Dirty_Area()
 }
-void OLED_Show_many_Tupian(const unsigned char *pic_you_want_show[],int size_pic_list,int count)
+// 播放动画：pic_you_want_show按顺序是关键帧+差分帧，必须每帧都画在同一位置
+void OLED_Show_many_Tupian(const oled_bitmap_t *const pic_you_want_show[],int size_pic_list,int count)
 {   
 
     for (int i = 0; i < count; i++)
     {
         for (int i = 0; i < size_pic_list; i++)
     {
-         OLED_ShowPicture(32, 0, 64, 64, pic_you_want_show[i], 1);
+         OLED_ShowBitmap(32, 0, pic_you_want_show[i], 1);
          OLED_Refresh();
          delay_ms(1);
     }
     
     
     }
-     OLED_ShowPicture(32, 0, 64, 64, pic_you_want_show[0], 1);
+     OLED_ShowBitmap(32, 0, pic_you_want_show[0], 1);
     
    
       
@@ -12,6 +12,26 @@
 #define OLED_LINE_HEIGHT 16  // 每行高度（像素）
 #define OLED_MAX_LINES   4   // 最大行数（128x64像素屏幕）
 #define OLED_MAX_CHARS   16  // 每行最大字符数（8x16字体）
+#define OLED_PRINTF_BUF  24  // OLED_Printf系列的格式化缓冲（栈上），12号字一行最多21个字符
+#define OLED_TEXT_FIELDS 8   // 文字缓存的字段数：按(x,y,字号)区分，内容没变且没被别的绘制覆盖时不重画
+
+/**
+ * @brief 注册文字缓存（挂到OLED显存改写通知上），不调用时每次都重画
+ */
+void OLED_Text_Init(void);
+
+/**
+ * @brief 在(x,y)处显示一段文字并清掉上次更长的部分，内容与上次相同时跳过
+ * @param x,y 起点坐标
+ * @param size 字号
+ * @param width 字段宽度，首次显示时文字后面清到这里
+ * @param height 字段高度（行数），字模以下到该高度的部分清空
+ * @param text 已格式化好的字符串（UTF-8）
+ * @return 1-重画了，0-内容没变跳过
+ * @note 同一位置首次显示、或被别的绘制覆盖过之后，清到字段宽度（整行字段与原来的整行清除一致）；
+ *       之后只清除比上次短出来的部分，脏区只有真正改变的列
+ */
+uint8_t OLED_Text_Put(uint8_t x, uint8_t y, uint8_t size, uint8_t width, uint8_t height, const char *text);
 
 /**
  * @brief OLED打印函数 - 在指定位置格式化打印信息
@@ -66,5 +86,5 @@ void OLED_DrawProgressBar(
 void OLED_Clear_Rect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
 
 
-void OLED_Show_many_Tupian(const unsigned char *pic_you_want_show[],int size_pic_list,int count);
+void OLED_Show_many_Tupian(const oled_bitmap_t *const pic_you_want_show[],int size_pic_list,int count);
 #endif // __OLED_PRINT_H__
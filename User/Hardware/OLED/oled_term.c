@@ -0,0 +1,191 @@
+/**
+ * @file oled_term.c
+ * @brief OLED日志终端实现
+ */
+#include "oled_term.h"
+#include "oled.h"
+#include "log.h"
+#include <string.h>
+
+#define OLED_TERM_BLANK     0xFFFFFFFFUL // 该页是空行
+
+// 回滚缓冲：行号L存在第L%OLED_TERM_LINES格，每行补空格到整行宽，覆盖旧内容时不用先清除
+static char oled_term_buf[OLED_TERM_LINES][OLED_TERM_COLS + 1];
+static volatile uint32_t oled_term_count = 0; // 已写入的总行数（自由递增），最新一行的行号是count-1
+
+// 以下只在菜单任务里访问
+static uint32_t oled_term_top = 0;            // 顶行的行号
+static uint8_t oled_term_follow = 1;          // 1-跟随最新一行，0-停在回滚位置
+static uint8_t oled_term_phase = 0;           // 行号L画在RAM第(L+phase)%8页
+static uint8_t oled_term_fresh = 1;           // 1-进入页面后还没画过，按当前顶行重新对齐相位
+static uint32_t oled_term_page_line[8];       // 每页当前画着的行号
+
+// 日志旁路：按换行拆成若干行写入缓冲，超出行宽截断，不可显示字符换成空格。
+// 可能在中断里调用，关中断拷贝（最多一条日志的长度，几微秒）
+static void OLED_Term_Tap(const char *text, uint16_t len)
+{
+	uint32_t primask;
+	char *dst;
+	uint8_t n;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	while (len > 0)
+	{
+		if (*text == '\r' || *text == '\n')
+		{
+			text++;
+			len--;
+			continue;
+		}
+
+		dst = oled_term_buf[oled_term_count & (OLED_TERM_LINES - 1)];
+		n = 0;
+		while (len > 0 && *text != '\n')
+		{
+			if (n < OLED_TERM_COLS && *text != '\r')
+			{
+				dst[n++] = (*text >= ' ' && *text <= '~') ? *text : ' ';
+			}
+			text++;
+			len--;
+		}
+		memset(dst + n, ' ', OLED_TERM_COLS - n);
+		dst[OLED_TERM_COLS] = '\0';
+		oled_term_count++;
+	}
+	__set_PRIMASK(primask);
+}
+
+// 当前能显示的顶行范围：最早还在缓冲里的行 ~ 最新一屏的顶行
+static uint32_t OLED_Term_Last_Top(uint32_t count)
+{
+	return count > OLED_TERM_ROWS ? count - OLED_TERM_ROWS : 0;
+}
+
+/**
+ * @brief  挂到日志旁路上，开始收集日志（令牌化日志为 "#令牌 参数" 简短行，不管终端页面是否打开）
+ */
+void OLED_Term_Init(void)
+{
+	memset(oled_term_buf, ' ', sizeof(oled_term_buf));
+	Log_Set_Tap(OLED_Term_Tap);
+}
+
+/**
+ * @brief  进入终端页面：调用前应已OLED_Clear，所有页按空行处理，回到跟随最新一行
+ */
+void OLED_Term_Enter(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < 8; i++)
+	{
+		oled_term_page_line[i] = OLED_TERM_BLANK;
+	}
+	oled_term_follow = 1;
+	oled_term_fresh = 1;
+}
+
+/**
+ * @brief  离开终端页面：起始行恢复为0，清屏交给后面的页面重画
+ */
+void OLED_Term_Leave(void)
+{
+	OLED_Set_Start_Line(0);
+	OLED_Clear();
+}
+
+/**
+ * @brief  画终端（在帧内调用）：只重画行号变了的页，并设置本帧的起始行
+ */
+void OLED_Term_Draw(void)
+{
+	char text[OLED_TERM_COLS + 1];
+	uint32_t count, oldest, top, line, want;
+	uint32_t primask;
+	uint8_t r, page;
+
+	count = oled_term_count;
+	oldest = count > OLED_TERM_LINES ? count - OLED_TERM_LINES : 0;
+	top = OLED_Term_Last_Top(count);
+	if (!oled_term_follow && oled_term_top < top)
+	{
+		top = oled_term_top;
+	}
+	if (top < oldest)
+	{
+		top = oldest; // 回滚位置的行已被新日志覆盖
+	}
+	oled_term_top = top;
+
+	if (oled_term_fresh)
+	{
+		// 顶行画在第0页，起始行从0开始
+		oled_term_phase = (uint8_t)(0 - top) & 7;
+		oled_term_fresh = 0;
+	}
+
+	for (r = 0; r < OLED_TERM_ROWS; r++)
+	{
+		line = top + r;
+		page = (uint8_t)(line + oled_term_phase) & 7;
+		want = line < count ? line : OLED_TERM_BLANK;
+		if (oled_term_page_line[page] == want)
+		{
+			continue; // 这一行已经在这一页上，滚动时只是换了显示位置
+		}
+
+		OLED_Fill_Rect(0, page * 8, 127, page * 8 + 7, 0);
+		if (want != OLED_TERM_BLANK)
+		{
+			primask = __get_PRIMASK();
+			__disable_irq();
+			memcpy(text, oled_term_buf[line & (OLED_TERM_LINES - 1)], sizeof(text));
+			__set_PRIMASK(primask);
+			OLED_ShowString(0, page * 8, (uint8_t *)text, 8, OLED_MODE_NORMAL);
+		}
+		oled_term_page_line[page] = want;
+	}
+
+	OLED_Set_Start_Line(((top + oled_term_phase) & 7) * 8);
+}
+
+/**
+ * @brief  滚动终端
+ * @param  lines: 负数向前翻看旧日志，正数向后；翻到最新一屏时恢复跟随
+ */
+void OLED_Term_Scroll(int8_t lines)
+{
+	uint32_t last_top = OLED_Term_Last_Top(oled_term_count);
+
+	if (lines < 0)
+	{
+		oled_term_top = (oled_term_top > (uint32_t)-lines) ? oled_term_top + lines : 0;
+		oled_term_follow = 0;
+	}
+	else
+	{
+		oled_term_top += lines;
+		if (oled_term_top >= last_top)
+		{
+			oled_term_follow = 1;
+		}
+	}
+}
+
+/**
+ * @brief  回到最新一屏并跟随
+ */
+void OLED_Term_Follow(void)
+{
+	oled_term_follow = 1;
+}
+
+/**
+ * @brief  是否在跟随最新一行（0表示停在回滚位置）
+ */
+uint8_t OLED_Term_Following(void)
+{
+	return oled_term_follow;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file oled_term.h
+ * @brief OLED日志终端：文本日志旁路进回滚环形缓冲，用显示起始行滚动，每次只写入新出现的一行
+ * @version 0.1
+ * @date 2025-12-30
+ *
+ * 终端按6x8字体每页(8行像素)一行文字，整屏8行。行号L固定画在RAM第(L+phase)%8页，
+ * 滚动一行只需把起始行移动8，再把刚卷到另一边的那一页改画成新的一行：
+ * 一次0x40|n命令加不超过128字节数据，旧的7行不重发。
+ * 回滚时反过来移动，同样只写入一行。
+ * 终端显示期间屏幕与显存按行错位，页面退出时必须调用OLED_Term_Leave恢复起始行。
+ */
+#ifndef __OLED_TERM_H
+#define __OLED_TERM_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+
+#define OLED_TERM_LINES     16  // 回滚缓冲行数（必须为2的幂）
+#define OLED_TERM_COLS      21  // 每行字符数（6像素字宽，128/6）
+#define OLED_TERM_ROWS      8   // 一屏显示行数
+
+void OLED_Term_Init(void);
+void OLED_Term_Enter(void);
+void OLED_Term_Leave(void);
+void OLED_Term_Draw(void);
+void OLED_Term_Scroll(int8_t lines);
+void OLED_Term_Follow(void);
+uint8_t OLED_Term_Following(void);
+
+#endif
@@ -0,0 +1,163 @@
+/**
+ * @file oled_widget.c
+ * @brief OLED保留模式控件实现
+ */
+#include "oled_widget.h"
+#include "oled_print.h"
+#include <stdio.h>
+
+static oled_widget_page_t *oled_widget_active = NULL;   // 当前页面（只有它跟踪显存改写）
+static const oled_widget_t *oled_widget_drawing = NULL; // 正在画的控件（自己的改写不算覆盖）
+static uint8_t oled_widget_enabled = 0;
+
+// 显存改写通知：当前页面里与之重叠的控件作废，下次渲染时重画
+static void OLED_Widget_Damage(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+{
+    oled_widget_page_t *page = oled_widget_active;
+    const oled_widget_t *w;
+    uint8_t i;
+
+    if (page == NULL)
+        return;
+    for (i = 0; i < page->widget_count; i++)
+    {
+        w = &page->widgets[i];
+        if (!page->state[i].valid || w == oled_widget_drawing)
+            continue;
+        if (x1 < w->x + w->w && w->x <= x2 && y1 < w->y + w->h && w->y <= y2)
+            page->state[i].valid = 0;
+    }
+}
+
+// 画一个控件。valid为0（首次或被覆盖过）时先清空整个区域，文字缓存也随之作废
+static void OLED_Widget_Draw(const oled_widget_t *w, uint8_t valid, uint32_t value)
+{
+    char buf[OLED_WIDGET_TEXT_MAX];
+    const oled_bitmap_t *bmp;
+
+    if (!valid)
+        OLED_Fill_Rect(w->x, w->y, w->x + w->w - 1, w->y + w->h - 1, 0);
+
+    oled_widget_drawing = w;
+    switch (w->type)
+    {
+    case OLED_WIDGET_LABEL:
+        OLED_Text_Put(w->x, w->y, w->style, w->w, w->h, w->text);
+        break;
+    case OLED_WIDGET_VALUE:
+        if (w->format != NULL)
+            w->format(buf, sizeof(buf), value);
+        else
+            snprintf(buf, sizeof(buf), w->text, (int)value);
+        OLED_Text_Put(w->x, w->y, w->style, w->w, w->h, buf);
+        break;
+    case OLED_WIDGET_BAR:
+        OLED_DrawProgressBar(w->x, w->y, w->w, w->h, (int32_t)value, w->min, w->max, w->style, 1, 1);
+        break;
+    case OLED_WIDGET_ICON:
+        bmp = w->pick(value);
+        if (bmp == NULL)
+        {
+            if (valid)
+                OLED_Fill_Rect(w->x, w->y, w->x + w->w - 1, w->y + w->h - 1, 0);
+        }
+        else
+        {
+            OLED_ShowBitmap(w->x, w->y, bmp, OLED_MODE_NORMAL);
+        }
+        break;
+    default:
+        break;
+    }
+    oled_widget_drawing = NULL;
+}
+
+/**
+ * @brief 注册显存改写回调，不调用时控件每帧都重画
+ */
+void OLED_Widget_Init(void)
+{
+    oled_widget_enabled = OLED_Add_Damage_Hook(OLED_Widget_Damage);
+}
+
+/**
+ * @brief 进入页面：之后的显存改写作用到该页面，下次渲染画出全部控件
+ */
+void OLED_Widget_Enter(oled_widget_page_t *page)
+{
+    OLED_Widget_Invalidate(page);
+    oled_widget_active = page;
+}
+
+/**
+ * @brief 离开页面
+ */
+void OLED_Widget_Leave(void)
+{
+    oled_widget_active = NULL;
+}
+
+/**
+ * @brief 页面所有控件作废（布局或显示/隐藏改变后调用）
+ */
+void OLED_Widget_Invalidate(oled_widget_page_t *page)
+{
+    uint8_t i;
+
+    for (i = 0; i < page->widget_count; i++)
+    {
+        page->state[i].valid = 0;
+    }
+}
+
+/**
+ * @brief 渲染页面（在帧内调用）：读一遍数据源，只重画数据源版本变了或被覆盖过的控件
+ * @return 本次重画的控件数
+ */
+uint8_t OLED_Widget_Render(oled_widget_page_t *page)
+{
+    oled_source_t *s;
+    const oled_widget_t *w;
+    oled_widget_state_t *st;
+    uint32_t value;
+    uint16_t version;
+    uint8_t i, drawn = 0;
+
+    for (i = 0; i < page->source_count; i++)
+    {
+        s = &page->sources[i];
+        value = s->read();
+        if (value != s->value)
+        {
+            s->value = value;
+            s->version++;
+        }
+    }
+
+    for (i = 0; i < page->widget_count; i++)
+    {
+        w = &page->widgets[i];
+        st = &page->state[i];
+        if (st->flags & OLED_WIDGET_HIDDEN)
+            continue;
+
+        if (w->src < page->source_count)
+        {
+            value = page->sources[w->src].value;
+            version = page->sources[w->src].version;
+        }
+        else
+        {
+            value = 0;
+            version = 0;
+        }
+        if (st->valid && st->seen == version)
+            continue;
+
+        OLED_Widget_Draw(w, st->valid, value);
+        st->seen = version;
+        st->valid = oled_widget_enabled && oled_widget_active == page;
+        drawn++;
+    }
+    return drawn;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file oled_widget.h
+ * @brief OLED保留模式控件：标签、数值、进度条、图标绑定到数据源，只重画数据变了的控件
+ * @version 0.1
+ * @date 2026-01-06
+ *
+ * 每个数据源带一个版本号：渲染时先调用一次读取函数，读到的值与上次不同就把版本号加1。
+ * 控件记下自己上次画时数据源的版本号，版本号没变、区域也没被别的绘制覆盖过就跳过，
+ * 不格式化、不改写显存，脏区只有真正重画的控件区域。
+ * 多个值共同决定的显示（如 时:分:秒）由读取函数打包成一个32位值。
+ *
+ * 页面进入时调用OLED_Widget_Enter（之后第一次渲染画出全部控件），离开时调用OLED_Widget_Leave。
+ * 只有当前页面的控件跟踪显存改写，别的绘制（投递的绘制命令、清屏）覆盖到的控件下次重画。
+ *
+ * 控件描述（类型、位置、格式、回调）是const表，放在flash里；运行时会变的只有每个控件4字节的
+ * oled_widget_state_t（版本、有效、隐藏），与描述表按下标一一对应。
+ * 同一页面有几种排布时，每种排布各写一组控件，用OLED_WIDGET_HIDDEN切换。
+ */
+#ifndef __OLED_WIDGET_H
+#define __OLED_WIDGET_H
+
+#include "stm32f10x.h"
+#include "oled.h"
+#include <stdint.h>
+
+#define OLED_WIDGET_LABEL     0 // 固定文字
+#define OLED_WIDGET_VALUE     1 // 数据源的值格式化成文字
+#define OLED_WIDGET_BAR       2 // 进度条
+#define OLED_WIDGET_ICON      3 // 按数据源的值选择图标，NULL表示清空该区域
+
+#define OLED_WIDGET_HIDDEN    0x01 // 状态标志：不显示（改变后需要OLED_Widget_Invalidate并自行清除）
+
+#define OLED_WIDGET_NO_SOURCE 0xFF // 标签不绑定数据源
+#define OLED_WIDGET_TEXT_MAX  24   // 数值控件格式化缓冲（栈上）
+
+// 数据源：read返回当前值，渲染时每帧读一次
+typedef struct
+{
+    uint32_t (*read)(void); // 读取函数
+    uint32_t value;         // 最近一次读到的值，控件格式化/绘制时用它
+    uint16_t version;       // 值每变化一次加1
+} oled_source_t;
+
+// 控件描述（const，flash）
+typedef struct
+{
+    uint8_t type;         // OLED_WIDGET_xxx
+    uint8_t x, y;         // 左上角
+    uint8_t w, h;         // 区域宽高（文字控件的宽度只用于改写判断，实际清除按文字宽度）
+    uint8_t style;        // 文字：字号；进度条：1-画边框
+    uint8_t src;          // 数据源下标，标签为OLED_WIDGET_NO_SOURCE
+    const char *text;     // 标签文字 / 数值控件的格式串（值按int传入）
+    void (*format)(char *buf, uint8_t len, uint32_t value); // 数值控件：非NULL时代替格式串生成文字
+    const oled_bitmap_t *(*pick)(uint32_t value);           // 图标控件：按值选图标
+    int16_t min, max;     // 进度条范围
+} oled_widget_t;
+
+// 控件运行状态（RAM）
+typedef struct
+{
+    uint16_t seen;        // 上次画时数据源的版本
+    uint8_t valid;        // 1-屏幕上还是上次画的内容
+    uint8_t flags;        // OLED_WIDGET_HIDDEN
+} oled_widget_state_t;
+
+typedef struct
+{
+    oled_source_t *sources;
+    uint8_t source_count;
+    const oled_widget_t *widgets;
+    oled_widget_state_t *state; // 与widgets等长
+    uint8_t widget_count;
+} oled_widget_page_t;
+
+// 控件定义（放在页面的static const数组里）
+#define OLED_SOURCE(read_fn) {(read_fn), 0, 0}
+#define OLED_LABEL(x, y, w, h, size, text) \
+    {OLED_WIDGET_LABEL, (x), (y), (w), (h), (size), OLED_WIDGET_NO_SOURCE, (text), NULL, NULL, 0, 0}
+#define OLED_VALUE(x, y, w, h, size, src, fmt, format_fn) \
+    {OLED_WIDGET_VALUE, (x), (y), (w), (h), (size), (src), (fmt), (format_fn), NULL, 0, 0}
+#define OLED_BAR(x, y, w, h, border, src, min, max) \
+    {OLED_WIDGET_BAR, (x), (y), (w), (h), (border), (src), NULL, NULL, NULL, (min), (max)}
+#define OLED_ICON(x, y, w, h, src, pick_fn) \
+    {OLED_WIDGET_ICON, (x), (y), (w), (h), 0, (src), NULL, NULL, (pick_fn), 0, 0}
+
+#define OLED_WIDGET_COUNT(widgets) (sizeof(widgets) / sizeof((widgets)[0]))
+
+// state为static oled_widget_state_t xxx[OLED_WIDGET_COUNT(widgets)]
+#define OLED_WIDGET_PAGE(sources, widgets, state) \
+    {(sources), sizeof(sources) / sizeof((sources)[0]), (widgets), (state), OLED_WIDGET_COUNT(widgets)}
+
+void OLED_Widget_Init(void);
+void OLED_Widget_Enter(oled_widget_page_t *page);
+void OLED_Widget_Leave(void);
+void OLED_Widget_Invalidate(oled_widget_page_t *page);
+uint8_t OLED_Widget_Render(oled_widget_page_t *page);
+
+#endif
@@ -0,0 +1,175 @@
+/**
+ * @file oledfont.c
+ * @brief 字库（由 Tools/font_packer.py 从 Tools/assets/font_src.h 生成，请勿手工修改）
+ *
+ * 只含固件里用到的字符；bytes 含索引和 24 字节描述符
+ *   font         size glyphs storage  bytes
+ *   asc2_0806     6x8     95     raw    594
+ *   asc2_1206    6x12     95     raw   1259  proportional
+ *   asc2_1608    8x16      0       -      0
+ *   asc2_2412   12x24     11  packed    344  proportional
+ *   total                              2197  (full ASCII tables: 6650)
+ */
+#include "oledfont.h"
+#include <stddef.h>
+
+// asc2_0806: U+0020~U+007E
+static const uint8_t font_asc_0806_data[570] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x00, 0x62,
+    0x64, 0x08, 0x13, 0x23, 0x00, 0x36, 0x49, 0x55, 0x22, 0x50, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x14, 0x08, 0x3E,
+    0x08, 0x14, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00, 0x00, 0xA0, 0x60, 0x00, 0x00, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02,
+    0x00, 0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00, 0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, 0x42, 0x61, 0x51,
+    0x49, 0x46, 0x00, 0x21, 0x41, 0x45, 0x4B, 0x31, 0x00, 0x18, 0x14, 0x12, 0x7F, 0x10, 0x00, 0x27,
+    0x45, 0x45, 0x45, 0x39, 0x00, 0x3C, 0x4A, 0x49, 0x49, 0x30, 0x00, 0x01, 0x71, 0x09, 0x05, 0x03,
+    0x00, 0x36, 0x49, 0x49, 0x49, 0x36, 0x00, 0x06, 0x49, 0x49, 0x29, 0x1E, 0x00, 0x00, 0x36, 0x36,
+    0x00, 0x00, 0x00, 0x00, 0x56, 0x36, 0x00, 0x00, 0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x02, 0x01, 0x51, 0x09, 0x06,
+    0x00, 0x32, 0x49, 0x59, 0x51, 0x3E, 0x00, 0x7C, 0x12, 0x11, 0x12, 0x7C, 0x00, 0x7F, 0x49, 0x49,
+    0x49, 0x36, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x7F,
+    0x49, 0x49, 0x49, 0x41, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A,
+    0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x20, 0x40, 0x41,
+    0x3F, 0x01, 0x00, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7F,
+    0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E,
+    0x00, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x00, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x00, 0x7F, 0x09, 0x19,
+    0x29, 0x46, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x3F,
+    0x40, 0x40, 0x40, 0x3F, 0x00, 0x1F, 0x20, 0x40, 0x20, 0x1F, 0x00, 0x3F, 0x40, 0x38, 0x40, 0x3F,
+    0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x07, 0x08, 0x70, 0x08, 0x07, 0x00, 0x61, 0x51, 0x49,
+    0x45, 0x43, 0x00, 0x00, 0x7F, 0x41, 0x41, 0x00, 0x00, 0x55, 0x2A, 0x55, 0x2A, 0x55, 0x00, 0x00,
+    0x41, 0x41, 0x7F, 0x00, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x7F, 0x48, 0x44,
+    0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x20, 0x00, 0x38, 0x44, 0x44, 0x48, 0x7F, 0x00, 0x38,
+    0x54, 0x54, 0x54, 0x18, 0x00, 0x08, 0x7E, 0x09, 0x01, 0x02, 0x00, 0x18, 0xA4, 0xA4, 0xA4, 0x7C,
+    0x00, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, 0x40, 0x80, 0x84,
+    0x7D, 0x00, 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, 0x7C,
+    0x04, 0x18, 0x04, 0x78, 0x00, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38,
+    0x00, 0xFC, 0x24, 0x24, 0x24, 0x18, 0x00, 0x18, 0x24, 0x24, 0x18, 0xFC, 0x00, 0x7C, 0x08, 0x04,
+    0x04, 0x08, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00, 0x04, 0x3F, 0x44, 0x40, 0x20, 0x00, 0x3C,
+    0x40, 0x40, 0x20, 0x7C, 0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x00, 0x3C, 0x40, 0x30, 0x40, 0x3C,
+    0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x1C, 0xA0, 0xA0, 0xA0, 0x7C, 0x00, 0x44, 0x64, 0x54,
+    0x4C, 0x44, 0x00, 0x00, 0x08, 0x36, 0x41, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x41, 0x36, 0x08, 0x00, 0x00, 0x10, 0x08, 0x08, 0x10, 0x08,
+};
+
+// asc2_1206: U+0020~U+007E
+static const uint8_t font_asc_1206_data[1140] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x02, 0x0C, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xD0, 0xBC, 0xD0, 0xBC, 0x90, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00,
+    0x18, 0x24, 0xFE, 0x44, 0x8C, 0x00, 0x03, 0x02, 0x07, 0x02, 0x01, 0x00, 0x18, 0x24, 0xD8, 0xB0,
+    0x4C, 0x80, 0x00, 0x03, 0x00, 0x01, 0x02, 0x01, 0xC0, 0x38, 0xE4, 0x38, 0xE0, 0x00, 0x01, 0x02,
+    0x02, 0x01, 0x02, 0x02, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0x04, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x02, 0x04, 0xF8,
+    0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x90, 0x60, 0xF8, 0x60, 0x90, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x20, 0xFC, 0x20, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x1C, 0x02, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x04, 0x04, 0x04, 0xF8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x08, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x18, 0x84, 0x44, 0x24, 0x18, 0x00, 0x03, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x08, 0x04, 0x24, 0x24, 0xD8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00,
+    0x40, 0xB0, 0x88, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x3C, 0x24, 0x24, 0x24,
+    0xC4, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0xF8, 0x24, 0x24, 0x2C, 0xC0, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x01, 0x00, 0x0C, 0x04, 0xE4, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xD8, 0x24, 0x24, 0x24, 0xD8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x38, 0x44, 0x44, 0x44,
+    0xF8, 0x00, 0x00, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x50, 0x88, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x88, 0x50, 0x20, 0x00, 0x02,
+    0x01, 0x00, 0x00, 0x00, 0x18, 0x04, 0xC4, 0x24, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xF8, 0x04, 0xE4, 0x94, 0xF8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0xE0, 0x9C, 0xF0,
+    0x80, 0x00, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02, 0x04, 0xFC, 0x24, 0x24, 0xD8, 0x00, 0x02, 0x03,
+    0x02, 0x02, 0x01, 0x00, 0xF8, 0x04, 0x04, 0x04, 0x0C, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00,
+    0x04, 0xFC, 0x04, 0x04, 0xF8, 0x00, 0x02, 0x03, 0x02, 0x02, 0x01, 0x00, 0x04, 0xFC, 0x24, 0x74,
+    0x0C, 0x00, 0x02, 0x03, 0x02, 0x02, 0x03, 0x00, 0x04, 0xFC, 0x24, 0x74, 0x0C, 0x00, 0x02, 0x03,
+    0x02, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x04, 0x44, 0xCC, 0x40, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00,
+    0x04, 0xFC, 0x20, 0x20, 0xFC, 0x04, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02, 0x04, 0x04, 0xFC, 0x04,
+    0x04, 0x00, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00, 0x00, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x06, 0x04,
+    0x04, 0x03, 0x00, 0x00, 0x04, 0xFC, 0x24, 0xD0, 0x0C, 0x04, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02,
+    0x04, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0xFC, 0x3C, 0xC0, 0x3C,
+    0xFC, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0xFC, 0x30, 0xC4, 0xFC, 0x04, 0x02, 0x03,
+    0x02, 0x00, 0x03, 0x00, 0xF8, 0x04, 0x04, 0x04, 0xF8, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00,
+    0x04, 0xFC, 0x24, 0x24, 0x18, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0xF8, 0x84, 0x84, 0x04,
+    0xF8, 0x00, 0x01, 0x02, 0x02, 0x07, 0x05, 0x00, 0x04, 0xFC, 0x24, 0x64, 0x98, 0x00, 0x02, 0x03,
+    0x02, 0x00, 0x03, 0x02, 0x18, 0x24, 0x24, 0x44, 0x8C, 0x00, 0x03, 0x02, 0x02, 0x02, 0x01, 0x00,
+    0x0C, 0x04, 0xFC, 0x04, 0x0C, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00,
+    0xFC, 0x04, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x04, 0x7C, 0x80, 0xE0, 0x1C, 0x04, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0xE0, 0x3C, 0xE0, 0x1C, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00,
+    0x04, 0x9C, 0x60, 0x9C, 0x04, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x04, 0x1C, 0xE0, 0x1C,
+    0x04, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x0C, 0x84, 0x64, 0x1C, 0x04, 0x00, 0x02, 0x03,
+    0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x02, 0x02, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x00,
+    0x00, 0x0E, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x02, 0xFE,
+    0x00, 0x00, 0x00, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x04, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA0, 0xA0,
+    0xC0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x02, 0x04, 0xFC, 0x20, 0x20, 0xC0, 0x00, 0x00, 0x03,
+    0x02, 0x02, 0x01, 0x00, 0x00, 0xC0, 0x20, 0x20, 0x60, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0xC0, 0x20, 0x24, 0xFC, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x02, 0x00, 0xC0, 0xA0, 0xA0,
+    0xC0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x20, 0xF8, 0x24, 0x24, 0x04, 0x00, 0x02,
+    0x03, 0x02, 0x02, 0x00, 0x00, 0x40, 0xA0, 0xA0, 0x60, 0x20, 0x00, 0x07, 0x0A, 0x0A, 0x0A, 0x04,
+    0x04, 0xFC, 0x20, 0x20, 0xC0, 0x00, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02, 0x00, 0x20, 0xE4, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x08, 0x08,
+    0x08, 0x07, 0x00, 0x00, 0x04, 0xFC, 0x80, 0xE0, 0x20, 0x20, 0x02, 0x03, 0x02, 0x00, 0x03, 0x02,
+    0x04, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00, 0xE0, 0x20, 0xE0, 0x20,
+    0xC0, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x20, 0xE0, 0x20, 0x20, 0xC0, 0x00, 0x02, 0x03,
+    0x02, 0x00, 0x03, 0x02, 0x00, 0xC0, 0x20, 0x20, 0xC0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00,
+    0x20, 0xE0, 0x20, 0x20, 0xC0, 0x00, 0x08, 0x0F, 0x0A, 0x02, 0x01, 0x00, 0x00, 0xC0, 0x20, 0x20,
+    0xE0, 0x00, 0x00, 0x01, 0x02, 0x0A, 0x0F, 0x08, 0x20, 0xE0, 0x40, 0x20, 0x20, 0x00, 0x02, 0x03,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x60, 0xA0, 0xA0, 0x20, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x00,
+    0x00, 0x20, 0xF8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x20, 0xE0, 0x00, 0x20,
+    0xE0, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x02, 0x20, 0xE0, 0x20, 0x80, 0x60, 0x20, 0x00, 0x00,
+    0x03, 0x01, 0x00, 0x00, 0x60, 0x80, 0xE0, 0x80, 0x60, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00,
+    0x20, 0x60, 0x80, 0x60, 0x20, 0x00, 0x02, 0x03, 0x00, 0x03, 0x02, 0x00, 0x20, 0xE0, 0x20, 0x80,
+    0x60, 0x20, 0x08, 0x08, 0x07, 0x01, 0x00, 0x00, 0x00, 0x20, 0xA0, 0x60, 0x20, 0x00, 0x00, 0x02,
+    0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x20, 0xDE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xDE, 0x20,
+    0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t font_asc_1206_metrics[95] = {
+    0x06, 0x22, 0x15, 0x06, 0x06, 0x06, 0x06, 0x03, 0x34, 0x14, 0x06, 0x06, 0x03, 0x06, 0x12, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x22, 0x22, 0x16, 0x06, 0x16, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x24, 0x15, 0x14, 0x14, 0x06,
+    0x22, 0x16, 0x06, 0x15, 0x16, 0x15, 0x16, 0x16, 0x06, 0x14, 0x05, 0x06, 0x06, 0x06, 0x06, 0x15,
+    0x06, 0x16, 0x06, 0x15, 0x15, 0x06, 0x06, 0x06, 0x06, 0x06, 0x15, 0x24, 0x32, 0x14, 0x06,
+};
+
+// asc2_2412:  DNafghilot
+static const uint8_t font_asc_2412_data[265] = {
+    0x62, 0x00, 0x00, 0x20, 0x40, 0xE0, 0x42, 0x20, 0x02, 0x40, 0xC0, 0x80, 0x41, 0x00, 0x40, 0xFF,
+    0x43, 0x00, 0x04, 0x01, 0xFF, 0xFE, 0x00, 0x10, 0x40, 0x1F, 0x41, 0x10, 0x05, 0x18, 0x08, 0x0E,
+    0x07, 0x01, 0x00, 0x03, 0x20, 0xE0, 0xE0, 0xC0, 0x43, 0x00, 0x11, 0x20, 0xE0, 0x20, 0x00, 0xFF,
+    0x00, 0x03, 0x07, 0x1C, 0x78, 0xE0, 0x80, 0x00, 0xFF, 0x00, 0x10, 0x1F, 0x10, 0x43, 0x00, 0x03,
+    0x03, 0x0F, 0x1F, 0x00, 0x4C, 0x00, 0x07, 0x98, 0xD8, 0x44, 0x64, 0x24, 0x24, 0xFC, 0xF8, 0x41,
+    0x00, 0x02, 0x0F, 0x1F, 0x18, 0x41, 0x10, 0x04, 0x08, 0x1F, 0x1F, 0x10, 0x18, 0x42, 0x00, 0x06,
+    0x80, 0xC0, 0x60, 0x20, 0x20, 0xE0, 0xC0, 0x40, 0x00, 0x41, 0x04, 0x40, 0xFF, 0x42, 0x04, 0x42,
+    0x00, 0x40, 0x10, 0x40, 0x1F, 0x41, 0x10, 0x41, 0x00, 0x4C, 0x00, 0x0D, 0x70, 0xF8, 0x8C, 0x04,
+    0x04, 0x8C, 0xF8, 0x74, 0x04, 0x0C, 0x00, 0x70, 0x76, 0xCF, 0x41, 0x8D, 0x04, 0x89, 0xC8, 0x78,
+    0x70, 0x00, 0x03, 0x00, 0x20, 0xE0, 0xF0, 0x48, 0x00, 0x02, 0xFF, 0xFF, 0x08, 0x41, 0x04, 0x01,
+    0xFC, 0xF8, 0x41, 0x00, 0x0A, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00,
+    0x43, 0x00, 0x40, 0x60, 0x45, 0x00, 0x41, 0x04, 0x40, 0xFC, 0x45, 0x00, 0x41, 0x10, 0x40, 0x1F,
+    0x41, 0x10, 0x40, 0x00, 0x40, 0x00, 0x41, 0x20, 0x01, 0xE0, 0xF0, 0x48, 0x00, 0x40, 0xFF, 0x45,
+    0x00, 0x41, 0x10, 0x40, 0x1F, 0x41, 0x10, 0x40, 0x00, 0x4B, 0x00, 0x0E, 0xE0, 0xF0, 0x18, 0x0C,
+    0x04, 0x04, 0x0C, 0x18, 0xF0, 0xE0, 0x00, 0x00, 0x03, 0x0F, 0x0C, 0x42, 0x10, 0x03, 0x0C, 0x0F,
+    0x03, 0x00, 0x43, 0x00, 0x00, 0xC0, 0x45, 0x00, 0x41, 0x04, 0x40, 0xFF, 0x41, 0x04, 0x45, 0x00,
+    0x01, 0x0F, 0x1F, 0x41, 0x10, 0x00, 0x0C, 0x40, 0x00,
+};
+static const uint16_t font_asc_2412_offset[11] = {
+    0, 2, 35, 68, 93, 121, 146, 176, 196, 217, 242,
+};
+static const uint16_t font_asc_2412_codes[11] = {
+    0x0020, 0x0044, 0x004E, 0x0061, 0x0066, 0x0067, 0x0068, 0x0069, 0x006C, 0x006F, 0x0074,
+};
+static const uint8_t font_asc_2412_metrics[11] = {
+    0x1B, 0x0C, 0x0C, 0x1C, 0x1B, 0x1C, 0x1B, 0x29, 0x29, 0x1B, 0x1A,
+};
+
+// 按字号从小到大排列，同字号ASCII在前
+const oled_font_t oled_fonts[OLED_FONT_COUNT] = {
+    {font_asc_0806_data, NULL, NULL, NULL, 0x0020, 95, 8, 6},
+    {font_asc_1206_data, NULL, NULL, font_asc_1206_metrics, 0x0020, 95, 12, 6},
+    {font_asc_2412_data, font_asc_2412_offset, font_asc_2412_codes, font_asc_2412_metrics, 0x0020, 11, 24, 12},
+};
@@ -1,62 +1,109 @@
 #include "debug.h"
 #include "FreeRTOS.h"
 #include "task.h"
+#include "log.h"
 
-// UART1ջͳ
+#if UART1_IRQ_PRIO < configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#error "UART1_IRQ_PRIO must not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY"
+#endif
+
+// UART1接收缓冲区和长度（uart1_rx_len非0表示收到完整一行，处理完清零）
 uint8_t uart1_buffer[UART1_BUF_SIZE];
-uint8_t uart1_rx_len;
+volatile uint8_t uart1_rx_len;
+static uint8_t uart1_line_pos = 0;
+static TaskHandle_t uart1_notify_task = NULL;
+
+// 接收统计（控制台 err 命令读取）
+volatile uint16_t uart1_rx_errors = 0;   // ORE/NE/FE错误次数
+volatile uint16_t uart1_rx_overruns = 0; // 上一行未处理时丢弃的字符数
 
 /**
- * @brief  DMAͳʼ
+ * @brief  DMA发送初始化
  */
 static void UART1_DMA_TX_Init(void)
 {
     DMA_InitTypeDef DMA_InitStruct;
     
-    // ʹDMA1ʱӣUART1_TXӦDMA1_Channel4
+    // 使能DMA1时钟（UART1_TX对应DMA1_Channel4）
     RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
     
-    // λDMA1_Channel4
+    // 复位DMA1_Channel4
     DMA_DeInit(DMA1_Channel4);
     
-    // DMA
-    DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR; // ַUART1ݼĴ
-    DMA_InitStruct.DMA_MemoryBaseAddr = 0;                         // ڴַ̬
-    DMA_InitStruct.DMA_DIR = DMA_DIR_PeripheralDST;                // ݷڴ->
-    DMA_InitStruct.DMA_BufferSize = 0;                             // С̬
-    DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;  // ַ
-    DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;           // ڴַ
-    DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte; // ݿȣֽ
-    DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;   // ڴݿȣֽ
-    DMA_InitStruct.DMA_Mode = DMA_Mode_Normal;                     // ģʽδ䣩
-    DMA_InitStruct.DMA_Priority = DMA_Priority_High;               // ȼ
-    DMA_InitStruct.DMA_M2M = DMA_M2M_Disable;                      // ڴ浽ڴ
+    // DMA配置
+    DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR; // 外设地址：UART1数据寄存器
+    DMA_InitStruct.DMA_MemoryBaseAddr = 0;                         // 内存地址：动态设置
+    DMA_InitStruct.DMA_DIR = DMA_DIR_PeripheralDST;                // 数据方向：内存->外设
+    DMA_InitStruct.DMA_BufferSize = 0;                             // 缓冲区大小：动态设置
+    DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;  // 外设地址不递增
+    DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;           // 内存地址递增
+    DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte; // 外设数据宽度：字节
+    DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;   // 内存数据宽度：字节
+    DMA_InitStruct.DMA_Mode = DMA_Mode_Normal;                     // 正常模式（单次传输）
+    DMA_InitStruct.DMA_Priority = DMA_Priority_High;               // 高优先级
+    DMA_InitStruct.DMA_M2M = DMA_M2M_Disable;                      // 禁用内存到内存
     
     DMA_Init(DMA1_Channel4, &DMA_InitStruct);
     
-    // ȽDMAͨȴʹʱ
+    // 先禁用DMA通道，等待使用时再启用
     DMA_Cmd(DMA1_Channel4, DISABLE);
 }
 
-//7USARTжϷʵݽպͷ͡
+//7）在USART接收中断服务函数实现按行接收，整行交给控制台任务处理
 void USART1_IRQHandler(void)
-{   
-    uint16_t  temp = 0;        
-    //жϽձ־λǷ1
-    if(USART_GetITStatus(USART1, USART_IT_RXNE) == SET)
+{
+    BaseType_t woken = pdFALSE;
+    uint16_t sr;
+    uint16_t temp;
+
+    sr = USART1->SR;
+    if (sr & (USART_FLAG_RXNE | USART_FLAG_ORE))
     {
-        USART_ClearITPendingBit(USART1, USART_IT_RXNE); //ձ־λ
-        
-        temp = USART_ReceiveData(USART1);    // ȡݣһֽڣ
-        if (temp == '1')
-		{
-			GPIO_ResetBits(GPIOB, GPIO_Pin_3);
-			vTaskDelay(200);
-			GPIO_SetBits(GPIOB, GPIO_Pin_3);
-		}
-	
-        USART_SendData(USART1, temp);        // ݷͻȥ
+        temp = USART_ReceiveData(USART1); // 先读SR再读DR，同时清除RXNE和ORE标志
+        if (sr & (USART_FLAG_ORE | USART_FLAG_NE | USART_FLAG_FE))
+        {
+            uart1_rx_errors++;
+        }
+
+        if (temp == '\r' || temp == '\n')
+        {
+            if (uart1_rx_len == 0 && uart1_line_pos > 0)
+            {
+                uart1_buffer[uart1_line_pos] = '\0';
+                uart1_rx_len = uart1_line_pos;
+                uart1_line_pos = 0;
+                if (uart1_notify_task != NULL)
+                {
+                    vTaskNotifyGiveFromISR(uart1_notify_task, &woken);
+                }
+            }
+        }
+        else if (uart1_rx_len != 0)
+        {
+            uart1_rx_overruns++; // 上一行还没处理完，丢弃
+        }
+        else if (temp == '\b' || temp == 0x7F)
+        {
+            if (uart1_line_pos > 0)
+            {
+                uart1_line_pos--;
+            }
+        }
+        else if (uart1_line_pos < UART1_BUF_SIZE - 1)
+        {
+            uart1_buffer[uart1_line_pos++] = (uint8_t)temp;
+        }
     }
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief  设置收到完整一行时要通知的任务（控制台任务）
+ * @param  task: 任务句柄，NULL表示不通知（由调用者轮询uart1_rx_len）
+ */
+void Debug_Set_Rx_Notify(TaskHandle_t task)
+{
+    uart1_notify_task = task;
 }
 
 // PA9-TX, PA10-RX
@@ -66,128 +113,98 @@ void debug_init(void)
     USART_InitTypeDef USART_InitStruct;
     NVIC_InitTypeDef NVIC_InitStruct;
     
-    // 1ʹRXTXGPIOʱӺUSARTʱӣ
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);    // GPIOʱ
+    // 1）使能RX和TX引脚GPIO时钟和USART时钟；
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);    // GPIO时钟
     RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1, ENABLE); //for USART1 and USART6 
 
-    // 2ʼGPIOGPIOõUSART
+    // 2）初始化GPIO，并将GPIO复用到USART上
     GPIO_InitStruct.GPIO_Pin = GPIO_Pin_9 | GPIO_Pin_10;
-    GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF_PP;      // ģʽ
-    GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz; // 
+    GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF_PP;      // 复用推挽输出模式
+    GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz; // 高速
  
     GPIO_Init(GPIOA, &GPIO_InitStruct);
     
 //    GPIO_PinAFConfig(GPIOA, GPIO_PinSource9, GPIO_AF_USART1);
 //    GPIO_PinAFConfig(GPIOA, GPIO_PinSource10, GPIO_AF_USART1);
 
-    // 3USART
-    USART_InitStruct.USART_BaudRate = 115200;                        // 
-    USART_InitStruct.USART_WordLength = USART_WordLength_8b;        // 8λЧλ
-    USART_InitStruct.USART_StopBits = USART_StopBits_1;              // 1λֹͣλ
-    USART_InitStruct.USART_Parity = USART_Parity_No;                // У
-    USART_InitStruct.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;    // պͷģʽ
-    USART_InitStruct.USART_HardwareFlowControl = USART_HardwareFlowControl_None; // Ӳ
+    // 3）配置USART参数；
+    USART_InitStruct.USART_BaudRate = 115200;                        // 波特率
+    USART_InitStruct.USART_WordLength = USART_WordLength_8b;        // 8位有效数据位
+    USART_InitStruct.USART_StopBits = USART_StopBits_1;              // 1位停止位
+    USART_InitStruct.USART_Parity = USART_Parity_No;                // 无校验
+    USART_InitStruct.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;    // 接收和发送数据模式
+    USART_InitStruct.USART_HardwareFlowControl = USART_HardwareFlowControl_None; // 无硬件控制流
     USART_Init(USART1, &USART_InitStruct);
 
-    // 4жϿʹUSARTж
+    // 4）配置中断控制器并使能USART接收中断
     USART_ITConfig(USART1, USART_IT_RXNE, ENABLE);
 
-    // 5жȼҪжϲҪ裩
-    NVIC_InitStruct.NVIC_IRQChannel = USART1_IRQn;         // жͨ(жԴ)
-    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 1;
-    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 2;
+    // 5）设置中断优先级（如果需要开启串口中断才需要这个步骤）
+    NVIC_InitStruct.NVIC_IRQChannel = USART1_IRQn;         // 中断通道(中断源)
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = UART1_IRQ_PRIO;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0; // PriorityGroup_4没有子优先级
     NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
     NVIC_Init(&NVIC_InitStruct);
     
-    // 6ʹUSART
+    // 6）使能USART；
     USART_Cmd(USART1, ENABLE);
     
-    // 7ʼDMA
+    // 7）初始化DMA发送
     UART1_DMA_TX_Init();
 }
 
 /**
- * @brief  DMAʽݵԴ
- * @param  data: ͵ݻָ
- * @param  len:  ݵĳȣֽڣ
- * @retval 0: ɹ1: 
+ * @brief  DMA方式发送数据到调试串口
+ * @note   DMA1_Channel4由日志排空任务独占，这里只把数据写入日志缓冲，不等待发送完成
+ * @param  data: 待发送的数据缓冲区指针
+ * @param  len:  发送数据的长度（字节）
+ * @retval 0: 成功；1: 参数错误
  */
 uint8_t UART1_SendDataToDebug_DMA(uint8_t *data, uint16_t len)
 {
-    // У
+    // 参数校验
     if(data == NULL || len == 0 || len > UART1_BUF_SIZE)
     {
         return 1;
     }
     
-    // ȴDMAɣڴ䣩
-    while(DMA_GetFlagStatus(DMA1_FLAG_TC4) == RESET);
-    
-    // DMAɱ־
-    DMA_ClearFlag(DMA1_FLAG_TC4);
-    
-    // DMAͨ
-    DMA_Cmd(DMA1_Channel4, DISABLE);
-    
-    // DMA
-    DMA1_Channel4->CNDTR = len;                    // ôݳ
-    DMA1_Channel4->CMAR = (uint32_t)data;          // ڴַ
-    
-    // ʹDMAͨ
-    DMA_Cmd(DMA1_Channel4, ENABLE);
-    
-    // ʹUART1DMA
-    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
-    
-    // ȴDMA
-    while(DMA_GetFlagStatus(DMA1_FLAG_TC4) == RESET);
-    
-    // DMAɱ־
-    DMA_ClearFlag(DMA1_FLAG_TC4);
-    
-    // UART1DMA
-    USART_DMACmd(USART1, USART_DMAReq_Tx, DISABLE);
-    
+    Log_Write((const char *)data, len);
     return 0;
 }
 
-// ͨ1Ƭַ
+// 通过串口1，单片机发送字符串
 void Usart1_Send_Sring(char *string)
 {
     
     while(*string != '\0')
     {
-        USART_SendData(USART1, *string++);	// ⺯
-        // ȴݼĴ
+        USART_SendData(USART1, *string++);	// 库函数
+        // 等待发送数据寄存器空
         while(USART_GetFlagStatus(USART1, USART_FLAG_TXE) == RESET);
     }
-    // ȴ
+    // 等待发送完成
     while(USART_GetFlagStatus(USART1, USART_FLAG_TC) == RESET);
 }
 
-//ضc⺯printfڣضʹprintf
+//重定向c库函数printf到日志缓冲（日志任务启动前仍直接轮询发送）
 int fputc(int ch, FILE *f)
 {
-    /* һֽݵ */
-    USART_SendData(USART1, (uint8_t) ch);
-
-    /* ȴ */
-    while (USART_GetFlagStatus(USART1, USART_FLAG_TXE) == RESET);
+    Log_Putc((char)ch);
 
     return (ch);
 }
 
-// USART1ֽ麯
+// USART1发送字节数组函数
 void Usart1_send_bytes(uint8_t *buf, uint16_t len)
 {
     uint16_t i;
     for(i = 0; i < len; i++) {
-        /* һֽݵ */
+        /* 发送一个字节数据到串口 */
         USART_SendData(USART1, buf[i]);
         
-        /* ȴͼĴ */
+        /* 等待发送寄存器空 */
         while(USART_GetFlagStatus(USART1, USART_FLAG_TXE) == RESET);
     }
-    /* ȴ */
+    /* 等待发送完成 */
     while(USART_GetFlagStatus(USART1, USART_FLAG_TC) == RESET);
 }
@@ -3,16 +3,22 @@
 
 #include "stm32f10x.h"                  // Device header
 #include <stdio.h>
+#include "FreeRTOS.h"
+#include "task.h"
 
 // 定义UART1接收缓冲区大小
 #define UART1_BUF_SIZE 128
+#define UART1_IRQ_PRIO 6 // USART1中断优先级，中断里通知控制台任务，需低于configMAX_SYSCALL
 
 extern uint8_t uart1_buffer[UART1_BUF_SIZE];
-extern uint8_t uart1_rx_len;
+extern volatile uint8_t uart1_rx_len;
+extern volatile uint16_t uart1_rx_errors;
+extern volatile uint16_t uart1_rx_overruns;
 
 void debug_init(void);
 void Usart1_Send_Sring(char *string);
 void Usart1_send_bytes(uint8_t *buf, uint16_t len);
+void Debug_Set_Rx_Notify(TaskHandle_t task);
 
 // DMA发送相关函数
 uint8_t UART1_SendDataToDebug_DMA(uint8_t *data, uint16_t len);
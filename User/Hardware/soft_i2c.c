@@ -1,229 +1,216 @@
 #include "soft_i2c.h"
+#include "perf_counter.h"
+#define LOG_FILE_ID 7
+#include "log.h"
+#include <string.h>
+
+volatile uint16_t soft_i2c_nack_count = 0;
+
+// SCL低/高电平段的等待周期数，Soft_I2C_Init按SYSCLK计算
+static uint32_t soft_i2c_low_cycles = 0;
+static uint32_t soft_i2c_high_cycles = 0;
+
+// 用DWT周期计数等待，精度不受编译优化和中断影响（中断只会让电平段变长）
+static void Soft_I2C_Wait(uint32_t cycles)
+{
+	uint32_t start = Perf_Cycles();
+	while (Perf_Cycles() - start < cycles);
+}
+
+#define I2C_DELAY_L	Soft_I2C_Wait(soft_i2c_low_cycles)
+#define I2C_DELAY_H	Soft_I2C_Wait(soft_i2c_high_cycles)
+
+// 释放SCL，打开时钟延展时等从机松开
+static void Soft_I2C_SCL_Release(void)
+{
+	SCL_H;
+#if SOFT_I2C_CLOCK_STRETCH
+	for (uint16_t i = 0; SCLin == 0 && i < SOFT_I2C_STRETCH_LOOPS; i++);
+#endif
+}
 
 // PB9->SDA, PB8->SCL
-// ųʼ
+// 引脚初始化：两脚都是开漏输出，输出1即释放总线，此时IDR读到的就是总线电平
 void Soft_I2C_Init(void)
 {
 	GPIO_InitTypeDef GPIO_InitStruct;
+	uint32_t period;
+	uint32_t low;
+
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
-	GPIO_InitStruct.GPIO_Pin = GPIO_Pin_8 | GPIO_Pin_9;        
-  GPIO_InitStruct.GPIO_Mode = GPIO_Mode_Out_OD;    // ©
-  GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz; 
-  
-	GPIO_Init(GPIOB, &GPIO_InitStruct);	
-	// ʼͷߣߣ
-    SCL_H;
-    SDA_H;
-	printf("I2Cinit OK\n");
-	
-}
+	GPIO_InitStruct.GPIO_Pin = SOFT_I2C_SCL_PIN | SOFT_I2C_SDA_PIN;
+	GPIO_InitStruct.GPIO_Mode = GPIO_Mode_Out_OD;    // 开漏输出
+	GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_Init(SOFT_I2C_PORT, &GPIO_InitStruct);
 
-// PB9/
-void Soft_I2C_Mode(GPIOMode_TypeDef GPIO_Mode)
-{
-	GPIO_InitTypeDef GPIO_InitStruct;
+	// 初始释放总线（拉高）
+	SCL_H;
+	SDA_H;
 
-	GPIO_InitStruct.GPIO_Pin = GPIO_Pin_9;        
-    GPIO_InitStruct.GPIO_Mode = GPIO_Mode;    
-    GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz; 
-	GPIO_Init(GPIOB, &GPIO_InitStruct);	
+	// 按SYSCLK换算时序：快速模式要求低电平>=1.3us、高电平>=0.6us，按13:12分配周期
+	Perf_Init();
+	period = SystemCoreClock / SOFT_I2C_SPEED_HZ;
+	low = period * 13 / 25;
+	soft_i2c_low_cycles = low > SOFT_I2C_EDGE_CYCLES ? low - SOFT_I2C_EDGE_CYCLES : 0;
+	soft_i2c_high_cycles = (period - low) > SOFT_I2C_EDGE_CYCLES ? (period - low) - SOFT_I2C_EDGE_CYCLES : 0;
+	LOG_D(OLED, "soft i2c init OK, low %lu high %lu cycles\r\n", (unsigned long)soft_i2c_low_cycles, (unsigned long)soft_i2c_high_cycles);
 }
 
-// ʼź
+// 起始信号（也用作重复起始，进入时SCL可为低）
 void Soft_I2C_Start(void)
 {
-	// printf("Soft_I2C_Start - >\n");
-
-
 	SDA_H;
-	SCL_H;
-	// printf("delay start->");
-
-	I2C_DELAY;
-	
+	I2C_DELAY_L;
+	Soft_I2C_SCL_Release();
+	I2C_DELAY_H;
 
 	SDA_L;
-	I2C_DELAY;
-	
+	I2C_DELAY_H;
+
 	SCL_L;
-	// printf("<-Soft_I2C_Start\n");
 }
 
 
-// ֹͣź
+// 停止信号
 void Soft_I2C_Stop(void)
 {
 	SDA_L;
-	SCL_H;
-	I2C_DELAY;
-	
+	I2C_DELAY_L;
+	Soft_I2C_SCL_Release();
+	I2C_DELAY_H;
+
 	SDA_H;
-	I2C_DELAY;
+	I2C_DELAY_L;	// 总线空闲时间
 }
 
 
 
-// Ӧź
+// 发送应答信号
 void Soft_I2C_Send_Ack(void)
 {
 	SDA_L;
-	I2C_DELAY;
-	
-	SCL_H;
-	I2C_DELAY;
-	
+	I2C_DELAY_L;
+	Soft_I2C_SCL_Release();
+	I2C_DELAY_H;
 	SCL_L;
-	I2C_DELAY;
-	
 	SDA_H;
 }
 
-// ͷӦź
+// 发送非应答信号
 void Soft_I2C_Send_NAck(void)
 {
 	SDA_H;
-	I2C_DELAY;
-	
-	SCL_H;
-	I2C_DELAY;
-	
+	I2C_DELAY_L;
+	Soft_I2C_SCL_Release();
+	I2C_DELAY_H;
 	SCL_L;
-	I2C_DELAY;
-	
-	SDA_H;
 }
 
 
 
-// Ӧ0/Ӧź1,Ӧź
+// 接收应答0/非应答信号1,返回应答信号
 uint8_t Soft_I2C_Wait_Ack(void)
 {
-	uint8_t ack = 0;
-	SDA_H;	// ͷsda
-	
-	Soft_I2C_Mode(GPIO_Mode_IPU);// ģʽ
-	I2C_DELAY;	// ôӻSDAһᣬȴSDAȶ
-	
-	SCL_H;
-	I2C_DELAY;
-	if(SDAin == 1)
-		ack = 1;
-	else 
-		ack = 0;
+	uint8_t ack;
+
+	SDA_H;	// 释放sda总线，开漏输出下直接读IDR
+	I2C_DELAY_L;
+	Soft_I2C_SCL_Release();
+	I2C_DELAY_H;
+	ack = SDAin;
 	SCL_L;
-	I2C_DELAY;	// ôӻһ
-	
-	Soft_I2C_Mode(GPIO_Mode_Out_OD);
-	SDA_H;	// ͷsda
+
+	if (ack)
+	{
+		soft_i2c_nack_count++;
+	}
 	return ack;
 }
 
-// һֽ
-void Soft_I2C_Send_Byte(uint8_t data)
+// 只打出应答位的时钟，不采样（不关心应答的显示数据）
+static void Soft_I2C_Skip_Ack(void)
 {
+	SDA_H;
+	I2C_DELAY_L;
+	Soft_I2C_SCL_Release();
+	I2C_DELAY_H;
+	SCL_L;
+}
 
-	
-	for (int i = 0; i < 8; i++)
+// 发送一个字节
+void Soft_I2C_Send_Byte(uint8_t data)
+{
+	for (uint8_t i = 0; i < 8; i++)
 	{
-		// ȷλ
-		if (data & 0x80) // 1
+		// 先发高位
+		if (data & 0x80) // 发送数据1
 		{
 			SDA_H;
 		}
-		else	// 0
+		else	// 发送数据0
 		{
-			SDA_L;	
+			SDA_L;
 		}
-		I2C_DELAY;
+		I2C_DELAY_L;
 
-		SCL_H;
-		I2C_DELAY;
+		Soft_I2C_SCL_Release();
+		I2C_DELAY_H;
 
 		SCL_L;
-		I2C_DELAY;
-
 		data <<= 1;
 	}
-	SDA_H;	// ͷ
 }
 
-// һֽ
+// 接收一个字节
 uint8_t Soft_I2C_Read_Byte(void)
 {
 	uint8_t data = 0;
-	SDA_H;	// ͷsda
-	
-	Soft_I2C_Mode(GPIO_Mode_IPU);// ģʽ
-	I2C_DELAY;	// ôӻSDAһᣬȴSDAȶ
-	for (int i = 0; i < 8; i++) // λ
+
+	SDA_H;	// 释放sda总线
+	for (uint8_t i = 0; i < 8; i++) // 高位先收
 	{
 		data <<= 1;
-		SCL_H;
-		I2C_DELAY;
-		if(SDAin == 1)
+		I2C_DELAY_L;	// 让从机准备好发送的数据
+		Soft_I2C_SCL_Release();
+		I2C_DELAY_H;
+		if (SDAin)
 			data |= 1;
-		
 		SCL_L;
-		I2C_DELAY;	// ôӻ׼÷͵
 	}
-	Soft_I2C_Mode(GPIO_Mode_Out_OD);
-	SDA_H;	// ͷsda
 	return data;
 }
 
 /**
-  * @brief  ָ豸Ĵдһֽ
-  * @param  dev_addr: 豸ַ(7λ)
-  * @param  reg_addr: Ĵַ
-  * @param  data: Ҫд
-  * @retval 0:ɹ, 1:ʧ
+  * @brief  向指定设备寄存器写入一个字节
+  * @param  dev_addr: 设备地址(7位)
+  * @param  reg_addr: 寄存器地址
+  * @param  data: 要写入的数据
+  * @retval 0:成功, 1:失败
   */
 uint8_t Soft_I2C_Write_Byte(uint8_t dev_addr, uint8_t reg_addr, uint8_t data)
 {
-	// printf("Soft_I2C_Write_Byte start->\n");
-	Soft_I2C_Start();
-	Soft_I2C_Send_Byte(dev_addr << 1);	// ʹӻַд
-	// printf("Soft_I2C_Send_Byte : %d",dev_addr);
-	if (Soft_I2C_Wait_Ack())
-	{
-		Soft_I2C_Stop();
-		return 1;
-	}
-	Soft_I2C_Send_Byte(reg_addr);	// ͼĴַ
-	if (Soft_I2C_Wait_Ack())
-	{
-		Soft_I2C_Stop();
-		return 1;
-	}
-	Soft_I2C_Send_Byte(data);	// 1ֽ
-	if (Soft_I2C_Wait_Ack())
-	{
-		Soft_I2C_Stop();
-		return 1;
-	}
-	Soft_I2C_Stop();
-	return 0;
+	return Soft_I2C_Write_Bytes(dev_addr, reg_addr, 1, &data);
 }
 
 uint8_t Soft_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data)
 {
 	Soft_I2C_Start();
-	Soft_I2C_Send_Byte(dev_addr << 1);	// ʹӻַд
+	Soft_I2C_Send_Byte(dev_addr << 1);	// 发送从机地址（写）
 	if (Soft_I2C_Wait_Ack())
 	{
 		Soft_I2C_Stop();
 		return 1;
 	}
-	Soft_I2C_Send_Byte(reg_addr);	// ͼĴַ
+	Soft_I2C_Send_Byte(reg_addr);	// 发送寄存器地址
 	if (Soft_I2C_Wait_Ack())
 	{
 		Soft_I2C_Stop();
 		return 1;
 	}
-	
+
 	for(uint32_t i = 0; i < len; i++)
 	{
-		Soft_I2C_Send_Byte(*data);	// 1ֽ
+		Soft_I2C_Send_Byte(*data);	// 发送1个字节数据
 		if (Soft_I2C_Wait_Ack())
 		{
 			Soft_I2C_Stop();
@@ -231,84 +218,143 @@ uint8_t Soft_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, u
 		}
 		data++;
 	}
-	
+
 	Soft_I2C_Stop();
 	return 0;
 }
 
-
-
+/**
+  * @brief  连续写入，只检查地址应答，数据字节不采样应答（显示数据丢一字节下一帧会覆盖）
+  * @param  dev_addr: 设备地址(7位)
+  * @param  reg_addr: 寄存器地址/控制字节
+  * @param  len: 数据长度
+  * @param  data: 数据
+  * @retval 0:成功, 1:设备无应答
+  */
+uint8_t Soft_I2C_Write_Bytes_NoAck(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, const uint8_t *data)
+{
+	return Soft_I2C_Write_Window_NoAck(dev_addr, reg_addr, len, 1, len, data);
+}
 
 /**
-  * @brief  ָ豸Ĵȡһֽ
-  * @param  dev_addr: 豸ַ(7λ)
-  * @param  reg_addr: Ĵַ
-  * @param  data: ȡָ
-  * @retval 0:ɹ, 1:ʧ
+  * @brief  窗口写入：rows行、每行width字节，行首相隔stride字节，在总线上连成一次传输，应答处理同上
+  * @param  dev_addr: 设备地址(7位)
+  * @param  reg_addr: 寄存器地址/控制字节
+  * @param  width: 每行字节数
+  * @param  rows: 行数
+  * @param  stride: 相邻两行起点的间隔
+  * @param  data: 数据
+  * @retval 0:成功, 1:设备无应答
   */
-uint8_t Soft_I2C_Read_Byte_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint8_t *data)
+uint8_t Soft_I2C_Write_Window_NoAck(uint8_t dev_addr, uint8_t reg_addr, uint32_t width, uint32_t rows,
+                                    uint32_t stride, const uint8_t *data)
 {
+	uint32_t i;
+
 	Soft_I2C_Start();
-	Soft_I2C_Send_Byte(dev_addr << 1);	// ʹӻַд
-	if (Soft_I2C_Wait_Ack())
-	{
-		Soft_I2C_Stop();
-		return 1;
-	}
-	Soft_I2C_Send_Byte(reg_addr);	// ͼĴַ
+	Soft_I2C_Send_Byte(dev_addr << 1);	// 发送从机地址（写）
 	if (Soft_I2C_Wait_Ack())
 	{
 		Soft_I2C_Stop();
 		return 1;
 	}
-	Soft_I2C_Start();
-	Soft_I2C_Send_Byte((dev_addr << 1) | 1);	// ʹӻַ
-	if (Soft_I2C_Wait_Ack())
+	Soft_I2C_Send_Byte(reg_addr);
+	Soft_I2C_Skip_Ack();
+
+	while (rows--)
 	{
-		Soft_I2C_Stop();
-		return 1;
+		for (i = 0; i < width; i++)
+		{
+			Soft_I2C_Send_Byte(data[i]);
+			Soft_I2C_Skip_Ack();
+		}
+		data += stride;
 	}
-	
-	*data = Soft_I2C_Read_Byte();
-	Soft_I2C_Send_NAck();
+
 	Soft_I2C_Stop();
 	return 0;
 }
 
+
+
+/**
+  * @brief  从指定设备寄存器读取一个字节
+  * @param  dev_addr: 设备地址(7位)
+  * @param  reg_addr: 寄存器地址
+  * @param  data: 读取到的数据指针
+  * @retval 0:成功, 1:失败
+  */
+uint8_t Soft_I2C_Read_Byte_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint8_t *data)
+{
+	return Soft_I2C_Read_Bytes_From_Reg(dev_addr, reg_addr, 1, data);
+}
+
 uint8_t Soft_I2C_Read_Bytes_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data)
 {
 	Soft_I2C_Start();
-	Soft_I2C_Send_Byte(dev_addr << 1);	// ʹӻַд
+	Soft_I2C_Send_Byte(dev_addr << 1);	// 发送从机地址（写）
 	if (Soft_I2C_Wait_Ack())
 	{
 		Soft_I2C_Stop();
 		return 1;
 	}
-	Soft_I2C_Send_Byte(reg_addr);	// ͼĴַ
+	Soft_I2C_Send_Byte(reg_addr);	// 发送寄存器地址
 	if (Soft_I2C_Wait_Ack())
 	{
 		Soft_I2C_Stop();
 		return 1;
 	}
 	Soft_I2C_Start();
-	Soft_I2C_Send_Byte((dev_addr << 1) | 1);	// ʹӻַ
+	Soft_I2C_Send_Byte((dev_addr << 1) | 1);	// 发送从机地址（读）
 	if (Soft_I2C_Wait_Ack())
 	{
 		Soft_I2C_Stop();
 		return 1;
 	}
-	
+
 	for(uint32_t i = 0; i < len; i++)
 	{
 		*data = Soft_I2C_Read_Byte();
-		if (i == len - 1)		// һζֹݴ䣬Nack
+		if (i == len - 1)		// 最后一次读，终止数据传输，发送Nack
 			Soft_I2C_Send_NAck();
 		else
 			Soft_I2C_Send_Ack();
 		data++;
 	}
-	
+
 	Soft_I2C_Stop();
 	return 0;
 }
 
+/**
+  * @brief  总线速率基准：向SSD1306连续写128个NOP命令(0xE3)，不影响显示内容
+  * @param  dev_addr: 设备地址(7位)
+  * @note   结果用DWT周期数计算实际达到的SCL频率，调用者应避免其他任务同时访问总线
+  */
+void Soft_I2C_Benchmark(uint8_t dev_addr)
+{
+	uint8_t nop[128];
+	uint32_t bits = (2 + sizeof(nop)) * 9 + 2;	// 地址+控制字节+数据，各9位，加起始/停止
+	uint32_t cycles_ack;
+	uint32_t cycles_fast;
+	uint32_t start;
+
+	memset(nop, 0xE3, sizeof(nop));
+
+	start = Perf_Cycles();
+	Soft_I2C_Write_Bytes(dev_addr, 0x00, sizeof(nop), nop);
+	cycles_ack = Perf_Cycles() - start;
+
+	start = Perf_Cycles();
+	Soft_I2C_Write_Bytes_NoAck(dev_addr, 0x00, sizeof(nop), nop);
+	cycles_fast = Perf_Cycles() - start;
+
+	printf("soft i2c target %lu kHz, %u bytes\r\n",
+	       (unsigned long)(SOFT_I2C_SPEED_HZ / 1000), (unsigned)sizeof(nop));
+	printf("  ack check: %lu cycles, %lu us, %lu kHz\r\n",
+	       (unsigned long)cycles_ack, (unsigned long)Perf_Cycles_To_Us(cycles_ack),
+	       (unsigned long)((uint64_t)bits * SystemCoreClock / cycles_ack / 1000));
+	printf("  no ack   : %lu cycles, %lu us, %lu kHz\r\n",
+	       (unsigned long)cycles_fast, (unsigned long)Perf_Cycles_To_Us(cycles_fast),
+	       (unsigned long)((uint64_t)bits * SystemCoreClock / cycles_fast / 1000));
+}
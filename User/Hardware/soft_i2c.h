@@ -6,17 +6,34 @@
 #include "Delay.h"
 #include "debug.h"
 
-#define SCL_H GPIO_OUT(GPIOB,8) = 1
-#define SCL_L GPIO_OUT(GPIOB,8) = 0
-#define SDA_H	GPIO_OUT(GPIOB,9) = 1
-#define SDA_L	GPIO_OUT(GPIOB,9) = 0
-#define SDAin	GPIO_IN(GPIOB,9)
-#define I2C_DELAY  Delay_us(3)
+// PB8->SCL, PB9->SDA，两脚都保持开漏输出，读SDA直接读IDR，不切换输入/输出模式
+#define SOFT_I2C_PORT			GPIOB
+#define SOFT_I2C_SCL_PIN		GPIO_Pin_8
+#define SOFT_I2C_SDA_PIN		GPIO_Pin_9
+
+#define SOFT_I2C_SPEED_HZ		400000	// 目标SCL频率，按SYSCLK换算成每个半周期的等待周期数
+#define SOFT_I2C_EDGE_CYCLES	14		// 每个电平段里写BSRR+调用等待函数本身消耗的周期（用基准测试校准）
+#define SOFT_I2C_CLOCK_STRETCH	0		// 1-释放SCL后等从机松开（时钟延展），0-不检查
+#define SOFT_I2C_STRETCH_LOOPS	2000	// 时钟延展最长等待循环次数
+
+// BSRR低16位置位、高16位复位，单条写操作完成，不需要读-改-写
+#define SCL_H	(SOFT_I2C_PORT->BSRR = SOFT_I2C_SCL_PIN)
+#define SCL_L	(SOFT_I2C_PORT->BSRR = (uint32_t)SOFT_I2C_SCL_PIN << 16)
+#define SDA_H	(SOFT_I2C_PORT->BSRR = SOFT_I2C_SDA_PIN)
+#define SDA_L	(SOFT_I2C_PORT->BSRR = (uint32_t)SOFT_I2C_SDA_PIN << 16)
+#define SDAin	((SOFT_I2C_PORT->IDR & SOFT_I2C_SDA_PIN) ? 1 : 0)
+#define SCLin	((SOFT_I2C_PORT->IDR & SOFT_I2C_SCL_PIN) ? 1 : 0)
+
+extern volatile uint16_t soft_i2c_nack_count; // 从机无应答次数（控制台 err 命令读取）
 
 void Soft_I2C_Init(void);
 uint8_t Soft_I2C_Write_Byte(uint8_t dev_addr, uint8_t reg_addr, uint8_t data);
 uint8_t Soft_I2C_Write_Bytes(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data);
+uint8_t Soft_I2C_Write_Bytes_NoAck(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, const uint8_t *data);
+uint8_t Soft_I2C_Write_Window_NoAck(uint8_t dev_addr, uint8_t reg_addr, uint32_t width, uint32_t rows,
+                                    uint32_t stride, const uint8_t *data);
 uint8_t Soft_I2C_Read_Byte_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint8_t *data);
 uint8_t Soft_I2C_Read_Bytes_From_Reg(uint8_t dev_addr, uint8_t reg_addr, uint32_t len, uint8_t *data);
+void Soft_I2C_Benchmark(uint8_t dev_addr);
 #endif
 
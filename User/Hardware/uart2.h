@@ -1,8 +1,12 @@
 #ifndef UART2_H
 #define UART2_H
 #include "stm32f10x.h"
-// UART2ջ128ֽڣ
+// 定义UART2接收缓冲区（128字节）
 #define UART2_BUF_SIZE 128
 void UART2_DMA_RX_Init(uint32_t baudrate);
 uint8_t UART2_SendDataToWiFi_Poll(uint8_t *data, uint16_t len);
+
+extern volatile uint32_t uart2_rx_frames;
+extern volatile uint16_t uart2_rx_errors;
+extern volatile uint16_t uart2_rx_overruns;
 #endif
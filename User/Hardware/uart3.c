@@ -1,9 +1,17 @@
 #include "uart3.h"
 #include <stdio.h>
+#define LOG_FILE_ID 3
+#include "log.h"
+
 
 uint8_t uart3_buffer[UART3_BUF_SIZE];
 uint8_t uart3_rx_len;
 
+// 接收统计（控制台 err 命令读取）
+volatile uint32_t uart3_rx_frames = 0;   // 收到的帧数
+volatile uint16_t uart3_rx_errors = 0;   // ORE/NE/FE错误次数
+volatile uint16_t uart3_rx_overruns = 0; // 上一帧未处理就被新帧覆盖的次数
+
 static void UART3_GPIO_Init(void)
 {
     GPIO_InitTypeDef GPIO_InitStruct;
@@ -39,14 +47,14 @@ static void UART3_Init(uint32_t baudrate)
     USART_ITConfig(USART3, USART_IT_IDLE, ENABLE);
 
     NVIC_InitStruct.NVIC_IRQChannel                   = USART3_IRQn;
-    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 7; // 中断里LOG_D会调FromISR接口，需低于configMAX_SYSCALL
     NVIC_InitStruct.NVIC_IRQChannelSubPriority        = 0;
     NVIC_InitStruct.NVIC_IRQChannelCmd                = ENABLE;
     NVIC_Init(&NVIC_InitStruct);
 
     USART_Cmd(USART3, ENABLE);
     
-    printf("UART3 initialized with baudrate: %d\r\n", baudrate);
+    LOG_I(UART3, "UART3 initialized with baudrate: %d\r\n", baudrate);
 }
 
 static void UART3_DMA_Init(void)
@@ -91,9 +99,18 @@ void USART3_IRQHandler(void)
     {
         // 清除IDLE中断标志位（重要！）
         temp = USART3->SR;
+        if (temp & (USART_FLAG_ORE | USART_FLAG_NE | USART_FLAG_FE))
+        {
+            uart3_rx_errors++;
+        }
         temp = USART3->DR;
         (void)temp;
 
+        if (uart3_rx_len > 0)
+        {
+            uart3_rx_overruns++;
+        }
+        uart3_rx_frames++;
         DMA_Cmd(DMA1_Channel3, DISABLE);
         uart3_rx_len = UART3_BUF_SIZE - DMA_GetCurrDataCounter(DMA1_Channel3);
         DMA_SetCurrDataCounter(DMA1_Channel3, UART3_BUF_SIZE);
@@ -105,7 +122,7 @@ void USART3_IRQHandler(void)
         // 调试信息
         if (uart3_rx_len > 0)
         {
-            printf("UART3 IDLE Interrupt: Received %d bytes\r\n", uart3_rx_len);
+            LOG_D(UART3, "IDLE interrupt: received %d bytes\r\n", uart3_rx_len);
         }
     }
 }
@@ -9,6 +9,10 @@
 extern uint8_t uart3_buffer[UART3_BUF_SIZE];
 extern uint8_t uart3_rx_len;
 
+extern volatile uint32_t uart3_rx_frames;
+extern volatile uint16_t uart3_rx_errors;
+extern volatile uint16_t uart3_rx_overruns;
+
 void UART3_DMA_RX_Init(uint32_t baudrate);
 uint8_t UART3_SendDataToBLE_Poll(uint8_t *data, uint16_t len);   // 专为蓝牙封装
 
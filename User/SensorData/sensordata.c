@@ -5,6 +5,7 @@
 #include "stm32f10x_gpio.h"
 
 static TaskHandle_t sensordate_handle = NULL;
+static void (*sensordata_update_hook)(void) = NULL; // 数据变化时通知（界面据此刷新，不用轮询）
 uint8_t Light_ON = 1;
 uint8_t Light_ERR = 0 ;
 SensorData_TypeDef SensorData;
@@ -31,8 +32,14 @@ static void SensorData_Task(void *pvParameters)
             taskENTER_CRITICAL();
             ADC_RegularChannelConfig(ADC1, ADC_Channel_1, 1, ADC_SampleTime_55Cycles5);
             uint16_t lux_value = Light_GetLux();
+            uint8_t changed = (SensorData.light_data.lux != lux_value);
             SensorData.light_data.lux = lux_value;
             taskEXIT_CRITICAL();
+
+            if (changed && sensordata_update_hook != NULL)
+            {
+                sensordata_update_hook();
+            }
         }
       
 
@@ -41,12 +48,20 @@ static void SensorData_Task(void *pvParameters)
     }
 }
 
-void SensorData_CreateTask(void)
+// 注册数据变化回调，在传感器任务里调用
+void SensorData_Set_Update_Hook(void (*hook)(void))
+{
+    sensordata_update_hook = hook;
+}
+
+// 返回0成功，1堆不足创建失败
+uint8_t SensorData_CreateTask(void)
 {
-    xTaskCreate((TaskFunction_t)SensorData_Task,     /* 任务函数 */
-                (const char *)"SensorData",          /* 任务名称 */
-                (uint16_t)620,                       /* 任务堆栈大小 */
-                (void *)NULL,                        /* 任务函数参数 */
-                (UBaseType_t)3,                      /* 任务优先级 */
-                (TaskHandle_t *)&sensordate_handle); /* 任务控制句柄 */
+    // 任务只做ADC采样、回调和一条printf，最深在vsnprintf里，约0.7KB
+    return xTaskCreate((TaskFunction_t)SensorData_Task,     /* 任务函数 */
+                       (const char *)"SensorData",          /* 任务名称 */
+                       (uint16_t)256,                       /* 任务堆栈大小 */
+                       (void *)NULL,                        /* 任务函数参数 */
+                       (UBaseType_t)3,                      /* 任务优先级 */
+                       (TaskHandle_t *)&sensordate_handle) != pdPASS; /* 任务控制句柄 */
 }
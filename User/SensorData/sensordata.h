@@ -26,7 +26,8 @@ extern uint8_t Light_ERR;
 
 
 void SensorData_Init(void);
-void SensorData_CreateTask(void);
+uint8_t SensorData_CreateTask(void);
+void SensorData_Set_Update_Hook(void (*hook)(void));
 
 
 #endif
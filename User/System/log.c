@@ -0,0 +1,515 @@
+/**
+ * @file log.c
+ * @brief 非阻塞日志：多生产者无锁环形缓冲 + USART1 DMA排空任务
+ * @version 0.1
+ * @date 2025-12-22
+ *
+ * 记录格式：[头字节][内容]，头字节 0=尚未提交，1~254=内容长度，0xFF=填充到缓冲末尾。
+ * 生产者用LDREX/STREX预留空间（中断打断会使STREX失败并重试，因此任务和中断都可调用），
+ * 先写内容、最后写头字节提交；排空任务按序把内容直接交给DMA，发送完成后清零并释放。
+ * 调度器启动前（排空任务未运行）仍按原方式轮询发送，保证启动日志不丢。
+ */
+#include "log.h"
+#include "debug.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+#include <stdio.h>
+
+#if LOG_DMA_IRQ_PRIO < configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#error "LOG_DMA_IRQ_PRIO must not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY"
+#endif
+
+#define LOG_MASK        (LOG_RING_SIZE - 1)
+#define LOG_PAD         0xFF
+#define LOG_RECORD_MAX  254
+
+static uint8_t log_ring[LOG_RING_SIZE];
+static volatile uint32_t log_head = 0;  // 生产者预留位置（自由递增）
+static volatile uint32_t log_tail = 0;  // 排空任务释放位置（自由递增）
+
+static volatile uint32_t log_written = 0;
+static volatile uint32_t log_dropped = 0;
+static volatile uint32_t log_sent = 0;
+static uint16_t log_high_water = 0;
+
+static TaskHandle_t log_task_handle = NULL;
+static volatile uint8_t log_task_running = 0;
+static log_tap_t log_tap = NULL;
+
+#if LOG_RUNTIME_FILTER
+// 运行期级别阈值，默认全部放行（编译期级别已做第一道过滤）
+uint8_t log_runtime_level[LOG_MOD_COUNT] = {
+#define LOG_MODULE_INIT(m) LOG_LVL_DEBUG,
+    LOG_MODULE_LIST(LOG_MODULE_INIT)
+#undef LOG_MODULE_INIT
+};
+#endif
+
+#define LOG_MODULE_NAME(m) #m,
+static const char *const log_module_names[LOG_MOD_COUNT] = {LOG_MODULE_LIST(LOG_MODULE_NAME)};
+#undef LOG_MODULE_NAME
+
+// fputc逐字符输出的行缓冲（printf兼容路径）
+static char log_putc_line[LOG_LINE_MAX];
+static uint8_t log_putc_len = 0;
+static uint32_t log_putc_tick = 0;
+
+/**
+ * @brief  是否处于中断上下文
+ */
+static uint8_t Log_In_ISR(void)
+{
+    return (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) != 0;
+}
+
+static uint32_t Log_Tick(void)
+{
+    return Log_In_ISR() ? xTaskGetTickCountFromISR() : xTaskGetTickCount();
+}
+
+static void Log_Atomic_Inc(volatile uint32_t *value)
+{
+    uint32_t v;
+    do
+    {
+        v = __LDREXW((uint32_t *)value);
+    } while (__STREXW(v + 1, (uint32_t *)value));
+}
+
+/**
+ * @brief  调度器启动前的轮询发送
+ */
+static void Log_Poll_Send(const char *data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++)
+    {
+        USART_SendData(USART1, (uint8_t)data[i]);
+        while (USART_GetFlagStatus(USART1, USART_FLAG_TXE) == RESET);
+    }
+}
+
+/**
+ * @brief  写入一条记录（前缀+内容），无锁、可在中断中调用
+ * @param  prefix: 前缀（时间戳），可为NULL
+ * @param  plen: 前缀长度
+ * @param  data: 内容
+ * @param  dlen: 内容长度
+ * @retval 0: 成功；1: 缓冲满丢弃
+ */
+static uint8_t Log_Push(const char *prefix, uint8_t plen, const char *data, uint8_t dlen)
+{
+    uint32_t head, pos, pad, need, used;
+    uint8_t len = plen + dlen;
+
+    do
+    {
+        head = __LDREXW((uint32_t *)&log_head);
+        pos = head & LOG_MASK;
+        pad = (pos + 1 + len > LOG_RING_SIZE) ? (LOG_RING_SIZE - pos) : 0;
+        need = pad + 1 + len;
+        used = head + need - log_tail;
+        if (used > LOG_RING_SIZE)
+        {
+            __CLREX();
+            Log_Atomic_Inc(&log_dropped);
+            return 1;
+        }
+    } while (__STREXW(head + need, (uint32_t *)&log_head));
+
+    if (pad)
+    {
+        log_ring[pos] = LOG_PAD; // 末尾放不下，跳到缓冲起始
+        pos = 0;
+    }
+    if (plen)
+    {
+        memcpy(&log_ring[pos + 1], prefix, plen);
+    }
+    memcpy(&log_ring[pos + 1 + plen], data, dlen);
+    __DMB();
+    log_ring[pos] = len; // 最后写头字节，提交
+
+    if (used > log_high_water)
+    {
+        log_high_water = used;
+    }
+    Log_Atomic_Inc(&log_written);
+    return 0;
+}
+
+/**
+ * @brief  唤醒排空任务（中断中写入的日志不通知，由排空任务超时轮询）
+ */
+static void Log_Notify(void)
+{
+    if (!Log_In_ISR() && log_task_handle != NULL)
+    {
+        xTaskNotifyGive(log_task_handle);
+    }
+}
+
+/**
+ * @brief  格式化时间戳前缀 "[tick] "
+ */
+static uint8_t Log_Stamp(char *buf, uint32_t tick)
+{
+    return (uint8_t)snprintf(buf, 14, "[%6lu] ", (unsigned long)tick);
+}
+
+/**
+ * @brief  写入原始数据（不加时间戳），超长自动分段
+ * @param  data: 数据
+ * @param  len: 长度
+ */
+void Log_Write(const char *data, uint16_t len)
+{
+    if (!log_task_running)
+    {
+        Log_Poll_Send(data, len);
+        return;
+    }
+    while (len > 0)
+    {
+        uint8_t chunk = len > LOG_RECORD_MAX ? LOG_RECORD_MAX : (uint8_t)len;
+        Log_Push(NULL, 0, data, chunk);
+        data += chunk;
+        len -= chunk;
+    }
+    Log_Notify();
+}
+
+/**
+ * @brief  格式化一条带时间戳的日志
+ * @note   格式化缓冲在调用者栈上（LOG_LINE_MAX字节）
+ * @retval 写入的内容长度
+ */
+int Log_VPrintf(const char *format, va_list args)
+{
+    char line[LOG_LINE_MAX];
+    int n;
+    int m;
+
+    n = Log_Stamp(line, Log_Tick());
+    m = vsnprintf(line + n, sizeof(line) - n, format, args);
+    if (m < 0)
+    {
+        return m;
+    }
+    if (m > (int)sizeof(line) - n - 1)
+    {
+        m = sizeof(line) - n - 1;
+    }
+    if (log_tap != NULL)
+    {
+        log_tap(line + n, (uint16_t)m);
+    }
+    Log_Write(line, n + m);
+    return m;
+}
+
+int Log_Printf(const char *format, ...)
+{
+    va_list args;
+    int len;
+
+    va_start(args, format);
+    len = Log_VPrintf(format, args);
+    va_end(args);
+    return len;
+}
+
+/**
+ * @brief  逐字符写入（fputc重定向），遇换行或行满时整行提交
+ * @param  ch: 字符
+ */
+void Log_Putc(char ch)
+{
+    uint32_t primask;
+    char stamp[14];
+    uint8_t n;
+    uint8_t flushed = 0;
+
+    if (!log_task_running)
+    {
+        Log_Poll_Send(&ch, 1);
+        return;
+    }
+
+    // 行缓冲被所有任务和中断共享，用PRIMASK保护（最多拷贝一行，约几微秒）
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (log_putc_len == 0)
+    {
+        log_putc_tick = Log_Tick();
+    }
+    log_putc_line[log_putc_len++] = ch;
+    if (ch == '\n' || log_putc_len >= LOG_LINE_MAX)
+    {
+        n = Log_Stamp(stamp, log_putc_tick);
+        Log_Push(stamp, n, log_putc_line, log_putc_len);
+        if (log_tap != NULL)
+        {
+            log_tap(log_putc_line, log_putc_len);
+        }
+        log_putc_len = 0;
+        flushed = 1;
+    }
+    __set_PRIMASK(primask);
+
+    if (flushed)
+    {
+        Log_Notify();
+    }
+}
+
+/**
+ * @brief  启动一次DMA发送，完成后由DMA1_Channel4中断通知排空任务
+ */
+static void Log_DMA_Send(const uint8_t *data, uint16_t len)
+{
+    DMA_Cmd(DMA1_Channel4, DISABLE);
+    DMA_ClearFlag(DMA1_FLAG_TC4);
+    DMA1_Channel4->CMAR = (uint32_t)data;
+    DMA1_Channel4->CNDTR = len;
+    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
+    DMA_Cmd(DMA1_Channel4, ENABLE);
+}
+
+void DMA1_Channel4_IRQHandler(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (DMA_GetITStatus(DMA1_IT_TC4) != RESET)
+    {
+        DMA_ClearITPendingBit(DMA1_IT_TC4);
+        DMA_Cmd(DMA1_Channel4, DISABLE);
+        if (log_task_handle != NULL)
+        {
+            vTaskNotifyGiveFromISR(log_task_handle, &woken);
+        }
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief  日志排空任务：按序取出已提交的记录，直接从环形缓冲DMA发出
+ */
+static void Log_Task(void *pvParameters)
+{
+    uint32_t reported_drop = 0;
+    TickType_t start;
+    uint32_t tail;
+    uint32_t pos;
+    uint8_t hdr;
+
+    log_task_running = 1;
+
+    while (1)
+    {
+        tail = log_tail;
+        if (tail == log_head)
+        {
+            // 丢弃计数变化时补一条提示
+            if (log_dropped != reported_drop)
+            {
+                char msg[40];
+                uint32_t dropped = log_dropped;
+                int n = snprintf(msg, sizeof(msg), "[log] %lu lines dropped\r\n",
+                                 (unsigned long)(dropped - reported_drop));
+                reported_drop = dropped;
+                Log_Push(NULL, 0, msg, (uint8_t)n);
+                continue;
+            }
+            // 中断中写入的日志不发通知，靠超时轮询
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+            continue;
+        }
+
+        pos = tail & LOG_MASK;
+        hdr = log_ring[pos];
+        if (hdr == 0)
+        {
+            vTaskDelay(1); // 已预留但生产者尚未提交
+            continue;
+        }
+
+        if (hdr == LOG_PAD)
+        {
+            memset(&log_ring[pos], 0, LOG_RING_SIZE - pos);
+            __DMB();
+            log_tail = tail + (LOG_RING_SIZE - pos);
+            continue;
+        }
+
+        (void)ulTaskNotifyTake(pdTRUE, 0); // 清掉生产者积累的通知
+        Log_DMA_Send(&log_ring[pos + 1], hdr);
+
+        // 生产者写日志也会发同一个通知，被唤醒不代表发完：以CNDTR归零为准，
+        // DMA读完这条记录后才能清零、归还空间（否则下一次发送会打断正在发的记录）
+        start = xTaskGetTickCount();
+        while (DMA1_Channel4->CNDTR != 0 &&
+               (xTaskGetTickCount() - start) < pdMS_TO_TICKS(LOG_DMA_TIMEOUT_MS))
+        {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        }
+
+        memset(&log_ring[pos], 0, 1 + hdr);
+        __DMB();
+        log_tail = tail + 1 + hdr;
+        log_sent++;
+    }
+}
+
+/**
+ * @brief  初始化日志（USART1及DMA通道需已由debug_init配置）
+ */
+void Log_Init(void)
+{
+    NVIC_InitTypeDef NVIC_InitStruct;
+
+    memset(log_ring, 0, sizeof(log_ring));
+    log_head = 0;
+    log_tail = 0;
+
+    DMA_ITConfig(DMA1_Channel4, DMA_IT_TC, ENABLE);
+
+    NVIC_InitStruct.NVIC_IRQChannel = DMA1_Channel4_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = LOG_DMA_IRQ_PRIO;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+}
+
+/**
+ * @brief  创建日志排空任务，任务运行后printf改走环形缓冲
+ * @retval 0: 成功, 1: 堆不足创建失败（printf保持轮询发送）
+ */
+uint8_t Log_CreateTask(void)
+{
+    return xTaskCreate((TaskFunction_t)Log_Task,          /* 任务函数 */
+                       (const char *)"Log",               /* 任务名称 */
+                       (uint16_t)LOG_TASK_STACK,          /* 任务堆栈大小 */
+                       (void *)NULL,                      /* 任务函数参数 */
+                       (UBaseType_t)LOG_TASK_PRIO,        /* 任务优先级 */
+                       (TaskHandle_t *)&log_task_handle) != pdPASS; /* 任务控制句柄 */
+}
+
+/**
+ * @brief  缓冲中尚未发出的字节数（大段输出的调用者据此让出CPU，避免挤爆缓冲）
+ */
+uint16_t Log_Pending(void)
+{
+    return (uint16_t)(log_head - log_tail);
+}
+
+/**
+ * @brief  设置文本旁路回调（NULL取消）
+ */
+void Log_Set_Tap(log_tap_t tap)
+{
+    log_tap = tap;
+}
+
+/**
+ * @brief  读取文本旁路回调，令牌化日志据此决定是否拼旁路文本
+ */
+log_tap_t Log_Get_Tap(void)
+{
+    return log_tap;
+}
+
+/**
+ * @brief  读取日志统计
+ */
+void Log_Get_Stats(log_stats_t *stats)
+{
+    stats->written = log_written;
+    stats->dropped = log_dropped;
+    stats->sent = log_sent;
+    stats->high_water = log_high_water;
+}
+
+/**
+ * @brief  模块编号转名称
+ */
+const char *Log_Module_Name(uint8_t mod)
+{
+    return mod < LOG_MOD_COUNT ? log_module_names[mod] : "?";
+}
+
+/**
+ * @brief  按名称查找模块编号（不区分大小写）
+ * @retval 模块编号，LOG_MOD_COUNT表示未找到
+ */
+static uint8_t Log_Find_Module(const char *module)
+{
+    for (uint8_t i = 0; i < LOG_MOD_COUNT; i++)
+    {
+        const char *a = log_module_names[i];
+        const char *b = module;
+        while (*a != '\0' && (*a | 0x20) == (*b | 0x20))
+        {
+            a++;
+            b++;
+        }
+        if (*a == '\0' && *b == '\0')
+        {
+            return i;
+        }
+    }
+    return LOG_MOD_COUNT;
+}
+
+/**
+ * @brief  设置模块运行期日志级别（只能压低，高于编译期级别的日志已不存在）
+ * @param  module: 模块名，"*"表示全部模块
+ * @param  level: 0~4
+ * @retval 0: 成功；1: 模块不存在或未开启运行期过滤
+ */
+uint8_t Log_Set_Level(const char *module, uint8_t level)
+{
+#if LOG_RUNTIME_FILTER
+    uint8_t mod;
+
+    if (level > LOG_LVL_DEBUG)
+    {
+        level = LOG_LVL_DEBUG;
+    }
+    if (module[0] == '*' && module[1] == '\0')
+    {
+        memset(log_runtime_level, level, sizeof(log_runtime_level));
+        return 0;
+    }
+    mod = Log_Find_Module(module);
+    if (mod >= LOG_MOD_COUNT)
+    {
+        return 1;
+    }
+    log_runtime_level[mod] = level;
+    return 0;
+#else
+    (void)module;
+    (void)level;
+    return 1;
+#endif
+}
+
+/**
+ * @brief  读取模块运行期日志级别
+ * @retval 级别，0xFF表示模块不存在
+ */
+uint8_t Log_Get_Level(const char *module)
+{
+    uint8_t mod = Log_Find_Module(module);
+
+    if (mod >= LOG_MOD_COUNT)
+    {
+        return 0xFF;
+    }
+#if LOG_RUNTIME_FILTER
+    return log_runtime_level[mod];
+#else
+    return LOG_LVL_DEBUG;
+#endif
+}
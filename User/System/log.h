@@ -0,0 +1,133 @@
+/**
+ * @file log.h
+ * @brief 非阻塞日志：调用处只格式化并写入无锁环形缓冲，低优先级任务经USART1 DMA发出
+ * @version 0.1
+ * @date 2025-12-22
+ */
+#ifndef __LOG_H
+#define __LOG_H
+
+#include "stm32f10x.h"
+#include <stdint.h>
+#include <stdarg.h>
+#include "log_config.h"
+#include "log_token.h"
+
+#define LOG_RING_SIZE       512  // 环形缓冲大小（必须为2的幂）
+#define LOG_LINE_MAX        120  // 单条日志最大长度（含时间戳）
+#define LOG_TASK_PRIO       1    // 排空任务优先级（低于所有业务任务）
+#define LOG_TASK_STACK      128  // 排空任务堆栈（字）
+#define LOG_DMA_IRQ_PRIO    6    // DMA1_Channel4中断优先级，需低于configMAX_SYSCALL
+#define LOG_DMA_TIMEOUT_MS  100  // 一条记录最长发送时间（120字节@115200约10ms），超时按发完处理
+
+typedef struct
+{
+    uint32_t written;   // 写入条数
+    uint32_t dropped;   // 缓冲满丢弃条数
+    uint32_t sent;      // 已发出条数
+    uint16_t high_water;// 缓冲占用峰值（字节）
+} log_stats_t;
+
+void Log_Init(void);
+uint8_t Log_CreateTask(void);
+
+// 任意上下文（任务/中断）可调用，不阻塞
+int Log_Printf(const char *format, ...);
+int Log_VPrintf(const char *format, va_list args);
+void Log_Write(const char *data, uint16_t len);
+void Log_Putc(char ch);
+
+// 文本旁路：每条文本日志（不含时间戳）额外交给一个回调，如OLED日志终端。
+// 回调可能在中断里、关中断时被调用，只能做短小的拷贝；
+// 令牌化日志没有格式串，旁路收到的是 "#<令牌十六进制> <参数>..." 的简短行
+typedef void (*log_tap_t)(const char *text, uint16_t len);
+void Log_Set_Tap(log_tap_t tap);
+log_tap_t Log_Get_Tap(void);
+
+void Log_Get_Stats(log_stats_t *stats);
+uint16_t Log_Pending(void);
+
+/*
+ * 分级日志：LOG_E/W/I/D(模块, 格式, ...)，模块名取 log_config.h 中 LOG_MODULE_LIST 的项
+ *     LOG_W(ESP8266, "Send failed, retry %d\r\n", retry);
+ * 输出 "[tick] W/ESP8266: Send failed, retry 1"；LOG_TOKENIZE为1时只发令牌和参数，
+ * 由主机端 log_decode.py 还原成同样的文本（文件号和单行调用的要求见 log_token.h）。
+ * 级别高于 LOG_LEVEL_<模块> 或 LOG_LEVEL_MAX 的调用展开为空语句。
+ */
+#define LOG_LVL_NONE    0
+#define LOG_LVL_ERROR   1
+#define LOG_LVL_WARN    2
+#define LOG_LVL_INFO    3
+#define LOG_LVL_DEBUG   4
+
+#define LOG_MODULE_ENUM(m) LOG_MOD_##m,
+typedef enum
+{
+    LOG_MODULE_LIST(LOG_MODULE_ENUM)
+    LOG_MOD_COUNT
+} log_module_t;
+
+#if LOG_RUNTIME_FILTER
+extern uint8_t log_runtime_level[LOG_MOD_COUNT];
+#define LOG_RUNTIME_PASS(mod, lvl) (log_runtime_level[mod] >= (lvl))
+#else
+#define LOG_RUNTIME_PASS(mod, lvl) 1
+#endif
+
+uint8_t Log_Set_Level(const char *module, uint8_t level);
+uint8_t Log_Get_Level(const char *module);
+const char *Log_Module_Name(uint8_t mod);
+
+// 编译期比较：LOG_GE(配置级别, 调用级别) 展开为 1 或 0
+#define LOG_CAT_(a, b)  a##b
+#define LOG_CAT(a, b)   LOG_CAT_(a, b)
+#define LOG_GE(cfg, lvl) LOG_CAT(LOG_GE_, LOG_CAT(cfg, LOG_CAT(_, lvl)))
+#define LOG_GE_0_1 0
+#define LOG_GE_0_2 0
+#define LOG_GE_0_3 0
+#define LOG_GE_0_4 0
+#define LOG_GE_1_1 1
+#define LOG_GE_1_2 0
+#define LOG_GE_1_3 0
+#define LOG_GE_1_4 0
+#define LOG_GE_2_1 1
+#define LOG_GE_2_2 1
+#define LOG_GE_2_3 0
+#define LOG_GE_2_4 0
+#define LOG_GE_3_1 1
+#define LOG_GE_3_2 1
+#define LOG_GE_3_3 1
+#define LOG_GE_3_4 0
+#define LOG_GE_4_1 1
+#define LOG_GE_4_2 1
+#define LOG_GE_4_3 1
+#define LOG_GE_4_4 1
+
+#if LOG_TOKENIZE
+#define LOG_OUTPUT(fmt, ...) Log_Token_Emit(LOG_TOKEN_ID, ##__VA_ARGS__)
+#else
+#define LOG_OUTPUT(fmt, ...) Log_Printf(fmt, ##__VA_ARGS__)
+#endif
+
+#define LOG_EMIT_11(mod, lvl, fmt, ...)                \
+    do                                                 \
+    {                                                  \
+        if (LOG_RUNTIME_PASS(mod, lvl))                \
+        {                                              \
+            LOG_OUTPUT(fmt, ##__VA_ARGS__);            \
+        }                                              \
+    } while (0)
+#define LOG_EMIT_10(mod, lvl, fmt, ...) do { } while (0)
+#define LOG_EMIT_01(mod, lvl, fmt, ...) do { } while (0)
+#define LOG_EMIT_00(mod, lvl, fmt, ...) do { } while (0)
+
+#define LOG_EMIT(module, lvl, tag, fmt, ...)                                              \
+    LOG_CAT(LOG_EMIT_, LOG_CAT(LOG_GE(LOG_LEVEL_MAX, lvl), LOG_GE(LOG_LEVEL_##module, lvl))) \
+    (LOG_MOD_##module, lvl, tag "/" #module ": " fmt, ##__VA_ARGS__)
+
+#define LOG_E(module, fmt, ...) LOG_EMIT(module, 1, "E", fmt, ##__VA_ARGS__)
+#define LOG_W(module, fmt, ...) LOG_EMIT(module, 2, "W", fmt, ##__VA_ARGS__)
+#define LOG_I(module, fmt, ...) LOG_EMIT(module, 3, "I", fmt, ##__VA_ARGS__)
+#define LOG_D(module, fmt, ...) LOG_EMIT(module, 4, "D", fmt, ##__VA_ARGS__)
+
+#endif
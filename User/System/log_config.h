@@ -0,0 +1,42 @@
+/**
+ * @file log_config.h
+ * @brief 各模块编译期日志级别
+ * @version 0.1
+ * @date 2025-12-24
+ *
+ * 级别：0-关闭 1-错误(E) 2-警告(W) 3-信息(I) 4-调试(D)
+ * 必须写成数字字面量（LOG_x宏通过记号拼接比较级别），高于配置级别的调用在预处理阶段被删除，
+ * 格式串和参数都不会编进固件。
+ */
+#ifndef __LOG_CONFIG_H
+#define __LOG_CONFIG_H
+
+// 全局上限，发布版本改为1只保留错误日志
+#ifndef LOG_LEVEL_MAX
+#define LOG_LEVEL_MAX       4
+#endif
+
+#define LOG_LEVEL_MAIN      3
+#define LOG_LEVEL_ESP8266   3
+#define LOG_LEVEL_HC05      3
+#define LOG_LEVEL_MENU      2
+#define LOG_LEVEL_OLED      3
+#define LOG_LEVEL_UART3     3
+#define LOG_LEVEL_GATEWAY   3
+#define LOG_LEVEL_CMD       3
+
+// 1-已编译的日志再按运行期阈值过滤（每模块1字节RAM），0-只有编译期级别
+#define LOG_RUNTIME_FILTER  1
+
+// 模块列表，新增模块时同时增加上面的 LOG_LEVEL_xxx
+#define LOG_MODULE_LIST(X) \
+    X(MAIN)                \
+    X(ESP8266)             \
+    X(HC05)                \
+    X(MENU)                \
+    X(OLED)                \
+    X(UART3)               \
+    X(GATEWAY)             \
+    X(CMD)
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ * @file log_token.c
+ * @brief 令牌化日志编码：按生成的参数类型表打包可变参数，base64后以 "$" 行写入日志缓冲
+ * @version 0.1
+ * @date 2025-12-23
+ */
+#include "log.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <string.h>
+
+#define LOG_TOKEN_PAYLOAD_MAX   64
+#define LOG_TOKEN_TAP_MAX       32  // 旁路文本行长度（OLED终端一行只显示21字符）
+
+static const char log_b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/**
+ * @brief  二分查找令牌的参数类型串
+ * @retval 类型串，NULL表示类型表中没有该令牌（类型表未随源码重新生成）
+ */
+static const char *Log_Token_Find_Sig(uint32_t id)
+{
+    int lo = 0;
+    int hi = (int)log_token_sig_count - 1;
+
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (log_token_sigs[mid].id == id)
+        {
+            return log_token_sigs[mid].sig;
+        }
+        if (log_token_sigs[mid].id < id)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+    return NULL;
+}
+
+static uint8_t Log_Token_Varint(uint8_t *buf, uint32_t value)
+{
+    uint8_t n = 0;
+    while (value >= 0x80)
+    {
+        buf[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buf[n++] = (uint8_t)value;
+    return n;
+}
+
+/**
+ * @brief  base64编码，返回输出长度
+ */
+static uint16_t Log_Token_Base64(char *out, const uint8_t *in, uint16_t len)
+{
+    uint16_t n = 0;
+    uint16_t i;
+
+    for (i = 0; i + 2 < len; i += 3)
+    {
+        out[n++] = log_b64[in[i] >> 2];
+        out[n++] = log_b64[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+        out[n++] = log_b64[((in[i + 1] & 0x0F) << 2) | (in[i + 2] >> 6)];
+        out[n++] = log_b64[in[i + 2] & 0x3F];
+    }
+    if (i < len)
+    {
+        out[n++] = log_b64[in[i] >> 2];
+        if (i + 1 < len)
+        {
+            out[n++] = log_b64[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+            out[n++] = log_b64[(in[i + 1] & 0x0F) << 2];
+        }
+        else
+        {
+            out[n++] = log_b64[(in[i] & 0x03) << 4];
+            out[n++] = '=';
+        }
+        out[n++] = '=';
+    }
+    return n;
+}
+
+/**
+ * @brief  旁路文本追加数字，放不下时截断
+ * @param  value: 数值；hex为0时按有符号十进制解释
+ */
+static uint8_t Log_Token_Tap_Num(char *buf, uint8_t n, uint32_t value, uint8_t hex, uint8_t is_signed)
+{
+    char digits[10];
+    uint8_t d = 0;
+
+    if (is_signed && (int32_t)value < 0)
+    {
+        if (n < LOG_TOKEN_TAP_MAX)
+        {
+            buf[n++] = '-';
+        }
+        value = 0U - value;
+    }
+    do
+    {
+        digits[d++] = "0123456789ABCDEF"[hex ? (value & 0x0F) : (value % 10)];
+        value = hex ? (value >> 4) : (value / 10);
+    } while (value != 0);
+    while (d > 0 && n < LOG_TOKEN_TAP_MAX)
+    {
+        buf[n++] = digits[--d];
+    }
+    return n;
+}
+
+/**
+ * @brief  输出一条令牌化日志（任务和中断中均可调用）
+ * @param  id: 令牌ID，由LOG_x宏生成
+ * @param  ...: 与格式串一致的参数
+ */
+void Log_Token_Emit(uint32_t id, ...)
+{
+    uint8_t payload[LOG_TOKEN_PAYLOAD_MAX];
+    char line[2 + (LOG_TOKEN_PAYLOAD_MAX + 2) / 3 * 4 + 2];
+    char tap[LOG_TOKEN_TAP_MAX];
+    log_tap_t tap_fn = Log_Get_Tap();
+    uint8_t t = 0;
+    const char *sig;
+    uint16_t n = 0;
+    uint16_t len;
+    uint32_t tick;
+    va_list args;
+
+    tick = (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) ? xTaskGetTickCountFromISR() : xTaskGetTickCount();
+    n += Log_Token_Varint(&payload[n], id);
+    n += Log_Token_Varint(&payload[n], tick);
+
+    sig = Log_Token_Find_Sig(id);
+    if (sig == NULL)
+    {
+        sig = ""; // 主机端会提示参数缺失
+    }
+
+    // 旁路没有格式串，给一行 "#<令牌> <参数>..."：整数十进制、字符和字符串原样、浮点取整数部分
+    if (tap_fn != NULL)
+    {
+        tap[t++] = '#';
+        t = Log_Token_Tap_Num(tap, t, id, 1, 0);
+    }
+
+    va_start(args, id);
+    for (; *sig != '\0'; sig++)
+    {
+        // 预留最长参数（字符串）所需空间，放不下的参数截断
+        if (n + 1 + LOG_TOKEN_STR_MAX > LOG_TOKEN_PAYLOAD_MAX)
+        {
+            break;
+        }
+        if (tap_fn != NULL && t < LOG_TOKEN_TAP_MAX)
+        {
+            tap[t++] = ' ';
+        }
+        switch (*sig)
+        {
+        case 'i':
+        {
+            int32_t v = va_arg(args, int32_t);
+            n += Log_Token_Varint(&payload[n], ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+            if (tap_fn != NULL)
+            {
+                t = Log_Token_Tap_Num(tap, t, (uint32_t)v, 0, 1);
+            }
+            break;
+        }
+        case 'u':
+        {
+            uint32_t v = va_arg(args, uint32_t);
+            n += Log_Token_Varint(&payload[n], v);
+            if (tap_fn != NULL)
+            {
+                t = Log_Token_Tap_Num(tap, t, v, 0, 0);
+            }
+            break;
+        }
+        case 'c':
+            payload[n++] = (uint8_t)va_arg(args, int);
+            if (tap_fn != NULL && t < LOG_TOKEN_TAP_MAX)
+            {
+                tap[t++] = (char)payload[n - 1];
+            }
+            break;
+        case 'f':
+        {
+            float f = (float)va_arg(args, double);
+            memcpy(&payload[n], &f, 4);
+            n += 4;
+            if (tap_fn != NULL)
+            {
+                t = Log_Token_Tap_Num(tap, t, (uint32_t)(int32_t)f, 0, 1);
+            }
+            break;
+        }
+        case 's':
+        {
+            const char *s = va_arg(args, const char *);
+            uint8_t slen = 0;
+            if (s == NULL)
+            {
+                s = "(null)";
+            }
+            while (s[slen] != '\0' && slen < LOG_TOKEN_STR_MAX)
+            {
+                slen++;
+            }
+            payload[n++] = slen;
+            memcpy(&payload[n], s, slen);
+            n += slen;
+            for (; tap_fn != NULL && slen > 0 && t < LOG_TOKEN_TAP_MAX; slen--)
+            {
+                tap[t++] = *s++;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    va_end(args);
+
+    if (tap_fn != NULL)
+    {
+        tap_fn(tap, t);
+    }
+
+    line[0] = '$';
+    len = 1 + Log_Token_Base64(&line[1], payload, n);
+    line[len++] = '\r';
+    line[len++] = '\n';
+    Log_Write(line, len);
+}
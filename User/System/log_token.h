@@ -0,0 +1,59 @@
+/**
+ * @file log_token.h
+ * @brief 令牌化日志：LOG_E/W/I/D的格式串在编译期被丢弃，设备只发送令牌ID + 打包参数
+ * @version 0.1
+ * @date 2025-12-23
+ *
+ * 用法：使用LOG_x的 .c 文件在包含 log.h 之前定义全工程唯一的文件号，每个调用写在同一行：
+ *     #define LOG_FILE_ID 3
+ *     #include "log.h"
+ *     LOG_W(ESP8266, "Send failed, retry %d\r\n", retry);
+ * 模块和级别的编译期/运行期过滤与文本输出相同，被编译期删掉的调用不产生任何代码。
+ *
+ * 令牌ID = (LOG_FILE_ID << 16) | 格式串哈希，格式串含级别和模块前缀（"W/ESP8266: ..."），与行号无关，
+ * 由 Tools/log_tokenizer.py 在构建前扫描源码分配，
+ * 生成调用点映射 log_token_ids.h、参数类型表 log_token_db.c 和主机端数据库 Tools/log_tokens.csv。
+ * 调用点按 LOG_TOKEN_ID_<文件号>_<行号> 取ID：行号变化后忘记重新生成时该名字未定义，编译失败；
+ * 原行上改了格式串编译器查不出，提交前用 log_tokenizer.py --check 检查。
+ * 主机用 Tools/log_decode.py 把串口中的 "$<base64>" 行还原成文本，普通文本行原样输出。
+ *
+ * 线上格式（base64前）：varint(令牌ID) varint(tick) 参数...
+ *   整数  zigzag varint       字符串  长度字节 + 内容（最长LOG_TOKEN_STR_MAX）
+ *   浮点  4字节 float(小端)    字符    1字节
+ */
+#ifndef __LOG_TOKEN_H
+#define __LOG_TOKEN_H
+
+#include <stdint.h>
+
+// 1-LOG_x令牌化输出，0-退回文本输出（格式串照常编进固件）
+#ifndef LOG_TOKENIZE
+#define LOG_TOKENIZE        1
+#endif
+
+#define LOG_TOKEN_STR_MAX   24   // 字符串参数最长发送字节
+#define LOG_TOKEN_ARGS_MAX  8    // 单条日志最多参数个数
+
+#if LOG_TOKENIZE
+#include "log_token_ids.h"
+
+// 调用处没有定义LOG_FILE_ID时展开成未定义的LOG_TOKEN_ID_LOG_FILE_ID_<行号>，编译失败
+#define LOG_TOKEN_ID_NAME(file, line) LOG_TOKEN_ID_##file##_##line
+#define LOG_TOKEN_ID_AT(file, line)   LOG_TOKEN_ID_NAME(file, line)
+#define LOG_TOKEN_ID                  LOG_TOKEN_ID_AT(LOG_FILE_ID, __LINE__)
+#endif
+
+// 参数类型表项（由 log_tokenizer.py 生成，按id升序）
+typedef struct
+{
+    uint32_t id;
+    const char *sig; // 每个参数一个字符：i有符号 u无符号 s字符串 c字符 f浮点
+} log_token_sig_t;
+
+extern const log_token_sig_t log_token_sigs[];
+extern const uint16_t log_token_sig_count;
+extern const uint32_t log_token_db_hash;
+
+void Log_Token_Emit(uint32_t id, ...);
+
+#endif
@@ -0,0 +1,129 @@
+/**
+ * @file log_token_db.c
+ * @brief 令牌参数类型表（由 Tools/log_tokenizer.py 生成，请勿手工修改）
+ */
+#include "log_token.h"
+
+const uint32_t log_token_db_hash = 0x323257FAUL;
+
+const log_token_sig_t log_token_sigs[] = {
+    {0x00013502UL, "su"}, // main.c:59
+    {0x000166E4UL, "uu"}, // main.c:191
+    {0x00016A1CUL, "s"}, // main.c:243
+    {0x00016F0EUL, "i"}, // main.c:194
+    {0x00019692UL, ""}, // main.c:252
+    {0x00019D0AUL, ""}, // main.c:248
+    {0x0002007EUL, "s"}, // esp8266.c:389
+    {0x00020783UL, "s"}, // esp8266.c:265
+    {0x000208DEUL, "i"}, // esp8266.c:736
+    {0x00020E84UL, "ii"}, // esp8266.c:399
+    {0x000212C4UL, "i"}, // esp8266.c:484
+    {0x000217F8UL, "i"}, // esp8266.c:763
+    {0x00021AE4UL, ""}, // esp8266.c:694
+    {0x00021AEBUL, "s"}, // esp8266.c:666
+    {0x00022582UL, ""}, // esp8266.c:110
+    {0x000225E5UL, ""}, // esp8266.c:142
+    {0x0002272BUL, "ii"}, // esp8266.c:473
+    {0x00022854UL, "ss"}, // esp8266.c:296
+    {0x00023C28UL, "s"}, // esp8266.c:512
+    {0x00023C58UL, "is"}, // esp8266.c:62
+    {0x000240B8UL, ""}, // esp8266.c:451
+    {0x0002424DUL, ""}, // esp8266.c:98
+    {0x000243F4UL, ""}, // esp8266.c:765
+    {0x00024581UL, "i"}, // esp8266.c:445
+    {0x00024A27UL, "ii"}, // esp8266.c:732
+    {0x000254F8UL, ""}, // esp8266.c:679
+    {0x000259BFUL, ""}, // esp8266.c:104
+    {0x00025F2DUL, ""}, // esp8266.c:429
+    {0x0002633BUL, "ii"}, // esp8266.c:465
+    {0x00026F2FUL, ""}, // esp8266.c:83
+    {0x00026F6EUL, "ii"}, // esp8266.c:425
+    {0x00026FFBUL, "s"}, // esp8266.c:534
+    {0x0002839AUL, "ii"}, // esp8266.c:434
+    {0x00028671UL, ""}, // esp8266.c:492
+    {0x0002882FUL, "s"}, // esp8266.c:117
+    {0x00029257UL, "sii"}, // esp8266.c:508
+    {0x00029268UL, ""}, // esp8266.c:410
+    {0x00029A3BUL, ""}, // esp8266.c:300
+    {0x0002A2CDUL, ""}, // esp8266.c:675
+    {0x0002A6ECUL, ""}, // esp8266.c:304
+    {0x0002A7A4UL, "i"}, // esp8266.c:657
+    {0x0002B7C5UL, ""}, // esp8266.c:80
+    {0x0002BC69UL, "s"}, // esp8266.c:537
+    {0x0002BCFEUL, "s"}, // esp8266.c:641
+    {0x0002BDFCUL, ""}, // esp8266.c:468
+    {0x0002C570UL, "ii"}, // esp8266.c:637
+    {0x0002C741UL, "s"}, // esp8266.c:339
+    {0x0002DA3CUL, "si"}, // esp8266.c:528
+    {0x0002DFACUL, ""}, // esp8266.c:392
+    {0x0002DFB1UL, ""}, // esp8266.c:489
+    {0x0002E266UL, "sii"}, // esp8266.c:517
+    {0x0002E3ACUL, ""}, // esp8266.c:454
+    {0x0002E51EUL, "s"}, // esp8266.c:53
+    {0x0002E957UL, ""}, // esp8266.c:663
+    {0x0002EC17UL, ""}, // esp8266.c:309
+    {0x0002EDE7UL, "s"}, // esp8266.c:752
+    {0x0002F3A1UL, ""}, // esp8266.c:129
+    {0x0002FED1UL, "ii"}, // esp8266.c:646
+    {0x000391A3UL, "i"}, // uart3.c:57
+    {0x000392E7UL, "i"}, // uart3.c:125
+    {0x00043DD1UL, "s"}, // gateway.c:423
+    {0x00046677UL, "s"}, // gateway.c:286
+    {0x000486A0UL, "is"}, // gateway.c:402
+    {0x00048F87UL, "i"}, // gateway.c:135
+    {0x0004A2FFUL, "is"}, // gateway.c:544
+    {0x0004D2D9UL, "s"}, // gateway.c:522
+    {0x0004E835UL, "is"}, // gateway.c:138
+    {0x0004F5E2UL, ""}, // gateway.c:644
+    {0x00050076UL, ""}, // HC-05.c:172
+    {0x00051FD8UL, "i"}, // HC-05.c:221
+    {0x00052A65UL, ""}, // HC-05.c:234
+    {0x00052D67UL, "is"}, // HC-05.c:155
+    {0x00052DC3UL, "s"}, // HC-05.c:395
+    {0x000539DCUL, "is"}, // HC-05.c:109
+    {0x00053EEFUL, ""}, // HC-05.c:177
+    {0x00054B25UL, "i"}, // HC-05.c:106
+    {0x00054F6FUL, ""}, // HC-05.c:167
+    {0x00057F3BUL, "s"}, // HC-05.c:324
+    {0x00059787UL, "s"}, // HC-05.c:369
+    {0x00059E67UL, ""}, // HC-05.c:188
+    {0x0005AE49UL, "s"}, // HC-05.c:261
+    {0x0005AF98UL, "i"}, // HC-05.c:152
+    {0x0005BC85UL, "s"}, // HC-05.c:245
+    {0x0005BF9DUL, ""}, // HC-05.c:56
+    {0x0005C2BFUL, "i"}, // HC-05.c:29
+    {0x0005C6C0UL, ""}, // HC-05.c:374
+    {0x0005CA89UL, ""}, // HC-05.c:300
+    {0x0005D3C3UL, ""}, // HC-05.c:199
+    {0x0005D9ECUL, "i"}, // HC-05.c:349
+    {0x0005E070UL, ""}, // HC-05.c:51
+    {0x0005E2B3UL, ""}, // HC-05.c:295
+    {0x0005E7E1UL, "s"}, // HC-05.c:335
+    {0x0005E9D3UL, ""}, // HC-05.c:194
+    {0x0005F522UL, "s"}, // HC-05.c:277
+    {0x0005FA46UL, ""}, // HC-05.c:400
+    {0x00060ACDUL, ""}, // oled.c:1236
+    {0x00061533UL, ""}, // oled.c:1231
+    {0x00061EBBUL, ""}, // oled.c:666
+    {0x00067339UL, ""}, // oled.c:1241
+    {0x0006A700UL, "u"}, // oled.c:1233
+    {0x0006B345UL, ""}, // oled.c:1244
+    {0x000753E9UL, "uu"}, // soft_i2c.c:56
+    {0x0008DB11UL, "iii"}, // memory_optimized_menu.c:38
+    {0x000925D4UL, ""}, // unified_menu.c:635
+    {0x000936C0UL, "ss"}, // unified_menu.c:520
+    {0x00094BC9UL, "i"}, // unified_menu.c:328
+    {0x00095357UL, ""}, // unified_menu.c:87
+    {0x00096932UL, "s"}, // unified_menu.c:556
+    {0x00098C27UL, ""}, // unified_menu.c:80
+    {0x00099083UL, ""}, // unified_menu.c:333
+    {0x0009A4FBUL, "i"}, // unified_menu.c:295
+    {0x0009C3CEUL, "ssi"}, // unified_menu.c:614
+    {0x0009C910UL, ""}, // unified_menu.c:526
+    {0x0009CCAAUL, ""}, // unified_menu.c:84
+    {0x0009CCEBUL, ""}, // unified_menu.c:628
+    {0x0009DBB4UL, "i"}, // unified_menu.c:447
+    {0x0009E208UL, "i"}, // unified_menu.c:820
+};
+
+const uint16_t log_token_sig_count = 117;
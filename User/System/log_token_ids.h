@@ -0,0 +1,144 @@
+/**
+ * @file log_token_ids.h
+ * @brief 调用点到令牌ID的映射（由 Tools/log_tokenizer.py 生成，请勿手工修改）
+ */
+#ifndef __LOG_TOKEN_IDS_H
+#define __LOG_TOKEN_IDS_H
+
+#define LOG_TOKEN_ID_1_59 0x00013502UL // main.c
+#define LOG_TOKEN_ID_1_191 0x000166E4UL // main.c
+#define LOG_TOKEN_ID_1_194 0x00016F0EUL // main.c
+#define LOG_TOKEN_ID_1_243 0x00016A1CUL // main.c
+#define LOG_TOKEN_ID_1_248 0x00019D0AUL // main.c
+#define LOG_TOKEN_ID_1_252 0x00019692UL // main.c
+#define LOG_TOKEN_ID_2_53 0x0002E51EUL // esp8266.c
+#define LOG_TOKEN_ID_2_62 0x00023C58UL // esp8266.c
+#define LOG_TOKEN_ID_2_80 0x0002B7C5UL // esp8266.c
+#define LOG_TOKEN_ID_2_83 0x00026F2FUL // esp8266.c
+#define LOG_TOKEN_ID_2_98 0x0002424DUL // esp8266.c
+#define LOG_TOKEN_ID_2_104 0x000259BFUL // esp8266.c
+#define LOG_TOKEN_ID_2_110 0x00022582UL // esp8266.c
+#define LOG_TOKEN_ID_2_117 0x0002882FUL // esp8266.c
+#define LOG_TOKEN_ID_2_129 0x0002F3A1UL // esp8266.c
+#define LOG_TOKEN_ID_2_136 0x0002882FUL // esp8266.c
+#define LOG_TOKEN_ID_2_142 0x000225E5UL // esp8266.c
+#define LOG_TOKEN_ID_2_265 0x00020783UL // esp8266.c
+#define LOG_TOKEN_ID_2_296 0x00022854UL // esp8266.c
+#define LOG_TOKEN_ID_2_300 0x00029A3BUL // esp8266.c
+#define LOG_TOKEN_ID_2_304 0x0002A6ECUL // esp8266.c
+#define LOG_TOKEN_ID_2_309 0x0002EC17UL // esp8266.c
+#define LOG_TOKEN_ID_2_339 0x0002C741UL // esp8266.c
+#define LOG_TOKEN_ID_2_389 0x0002007EUL // esp8266.c
+#define LOG_TOKEN_ID_2_392 0x0002DFACUL // esp8266.c
+#define LOG_TOKEN_ID_2_399 0x00020E84UL // esp8266.c
+#define LOG_TOKEN_ID_2_410 0x00029268UL // esp8266.c
+#define LOG_TOKEN_ID_2_425 0x00026F6EUL // esp8266.c
+#define LOG_TOKEN_ID_2_429 0x00025F2DUL // esp8266.c
+#define LOG_TOKEN_ID_2_434 0x0002839AUL // esp8266.c
+#define LOG_TOKEN_ID_2_445 0x00024581UL // esp8266.c
+#define LOG_TOKEN_ID_2_451 0x000240B8UL // esp8266.c
+#define LOG_TOKEN_ID_2_454 0x0002E3ACUL // esp8266.c
+#define LOG_TOKEN_ID_2_465 0x0002633BUL // esp8266.c
+#define LOG_TOKEN_ID_2_468 0x0002BDFCUL // esp8266.c
+#define LOG_TOKEN_ID_2_473 0x0002272BUL // esp8266.c
+#define LOG_TOKEN_ID_2_484 0x000212C4UL // esp8266.c
+#define LOG_TOKEN_ID_2_489 0x0002DFB1UL // esp8266.c
+#define LOG_TOKEN_ID_2_492 0x00028671UL // esp8266.c
+#define LOG_TOKEN_ID_2_498 0x0002BDFCUL // esp8266.c
+#define LOG_TOKEN_ID_2_508 0x00029257UL // esp8266.c
+#define LOG_TOKEN_ID_2_512 0x00023C28UL // esp8266.c
+#define LOG_TOKEN_ID_2_517 0x0002E266UL // esp8266.c
+#define LOG_TOKEN_ID_2_528 0x0002DA3CUL // esp8266.c
+#define LOG_TOKEN_ID_2_534 0x00026FFBUL // esp8266.c
+#define LOG_TOKEN_ID_2_537 0x0002BC69UL // esp8266.c
+#define LOG_TOKEN_ID_2_551 0x00029257UL // esp8266.c
+#define LOG_TOKEN_ID_2_555 0x00023C28UL // esp8266.c
+#define LOG_TOKEN_ID_2_560 0x0002E266UL // esp8266.c
+#define LOG_TOKEN_ID_2_571 0x0002DA3CUL // esp8266.c
+#define LOG_TOKEN_ID_2_577 0x00026FFBUL // esp8266.c
+#define LOG_TOKEN_ID_2_580 0x0002BC69UL // esp8266.c
+#define LOG_TOKEN_ID_2_594 0x00029257UL // esp8266.c
+#define LOG_TOKEN_ID_2_598 0x00023C28UL // esp8266.c
+#define LOG_TOKEN_ID_2_603 0x0002E266UL // esp8266.c
+#define LOG_TOKEN_ID_2_614 0x0002DA3CUL // esp8266.c
+#define LOG_TOKEN_ID_2_620 0x00026FFBUL // esp8266.c
+#define LOG_TOKEN_ID_2_623 0x0002BC69UL // esp8266.c
+#define LOG_TOKEN_ID_2_637 0x0002C570UL // esp8266.c
+#define LOG_TOKEN_ID_2_641 0x0002BCFEUL // esp8266.c
+#define LOG_TOKEN_ID_2_646 0x0002FED1UL // esp8266.c
+#define LOG_TOKEN_ID_2_657 0x0002A7A4UL // esp8266.c
+#define LOG_TOKEN_ID_2_663 0x0002E957UL // esp8266.c
+#define LOG_TOKEN_ID_2_666 0x00021AEBUL // esp8266.c
+#define LOG_TOKEN_ID_2_675 0x0002A2CDUL // esp8266.c
+#define LOG_TOKEN_ID_2_679 0x000254F8UL // esp8266.c
+#define LOG_TOKEN_ID_2_694 0x00021AE4UL // esp8266.c
+#define LOG_TOKEN_ID_2_732 0x00024A27UL // esp8266.c
+#define LOG_TOKEN_ID_2_736 0x000208DEUL // esp8266.c
+#define LOG_TOKEN_ID_2_752 0x0002EDE7UL // esp8266.c
+#define LOG_TOKEN_ID_2_763 0x000217F8UL // esp8266.c
+#define LOG_TOKEN_ID_2_765 0x000243F4UL // esp8266.c
+#define LOG_TOKEN_ID_3_57 0x000391A3UL // uart3.c
+#define LOG_TOKEN_ID_3_125 0x000392E7UL // uart3.c
+#define LOG_TOKEN_ID_4_135 0x00048F87UL // gateway.c
+#define LOG_TOKEN_ID_4_138 0x0004E835UL // gateway.c
+#define LOG_TOKEN_ID_4_286 0x00046677UL // gateway.c
+#define LOG_TOKEN_ID_4_402 0x000486A0UL // gateway.c
+#define LOG_TOKEN_ID_4_423 0x00043DD1UL // gateway.c
+#define LOG_TOKEN_ID_4_522 0x0004D2D9UL // gateway.c
+#define LOG_TOKEN_ID_4_544 0x0004A2FFUL // gateway.c
+#define LOG_TOKEN_ID_4_644 0x0004F5E2UL // gateway.c
+#define LOG_TOKEN_ID_5_29 0x0005C2BFUL // HC-05.c
+#define LOG_TOKEN_ID_5_51 0x0005E070UL // HC-05.c
+#define LOG_TOKEN_ID_5_56 0x0005BF9DUL // HC-05.c
+#define LOG_TOKEN_ID_5_106 0x00054B25UL // HC-05.c
+#define LOG_TOKEN_ID_5_109 0x000539DCUL // HC-05.c
+#define LOG_TOKEN_ID_5_152 0x0005AF98UL // HC-05.c
+#define LOG_TOKEN_ID_5_155 0x00052D67UL // HC-05.c
+#define LOG_TOKEN_ID_5_167 0x00054F6FUL // HC-05.c
+#define LOG_TOKEN_ID_5_172 0x00050076UL // HC-05.c
+#define LOG_TOKEN_ID_5_177 0x00053EEFUL // HC-05.c
+#define LOG_TOKEN_ID_5_188 0x00059E67UL // HC-05.c
+#define LOG_TOKEN_ID_5_194 0x0005E9D3UL // HC-05.c
+#define LOG_TOKEN_ID_5_199 0x0005D3C3UL // HC-05.c
+#define LOG_TOKEN_ID_5_221 0x00051FD8UL // HC-05.c
+#define LOG_TOKEN_ID_5_234 0x00052A65UL // HC-05.c
+#define LOG_TOKEN_ID_5_245 0x0005BC85UL // HC-05.c
+#define LOG_TOKEN_ID_5_261 0x0005AE49UL // HC-05.c
+#define LOG_TOKEN_ID_5_277 0x0005F522UL // HC-05.c
+#define LOG_TOKEN_ID_5_295 0x0005E2B3UL // HC-05.c
+#define LOG_TOKEN_ID_5_300 0x0005CA89UL // HC-05.c
+#define LOG_TOKEN_ID_5_324 0x00057F3BUL // HC-05.c
+#define LOG_TOKEN_ID_5_335 0x0005E7E1UL // HC-05.c
+#define LOG_TOKEN_ID_5_349 0x0005D9ECUL // HC-05.c
+#define LOG_TOKEN_ID_5_369 0x00059787UL // HC-05.c
+#define LOG_TOKEN_ID_5_374 0x0005C6C0UL // HC-05.c
+#define LOG_TOKEN_ID_5_395 0x00052DC3UL // HC-05.c
+#define LOG_TOKEN_ID_5_400 0x0005FA46UL // HC-05.c
+#define LOG_TOKEN_ID_6_666 0x00061EBBUL // oled.c
+#define LOG_TOKEN_ID_6_1231 0x00061533UL // oled.c
+#define LOG_TOKEN_ID_6_1233 0x0006A700UL // oled.c
+#define LOG_TOKEN_ID_6_1236 0x00060ACDUL // oled.c
+#define LOG_TOKEN_ID_6_1241 0x00067339UL // oled.c
+#define LOG_TOKEN_ID_6_1244 0x0006B345UL // oled.c
+#define LOG_TOKEN_ID_7_56 0x000753E9UL // soft_i2c.c
+#define LOG_TOKEN_ID_8_38 0x0008DB11UL // memory_optimized_menu.c
+#define LOG_TOKEN_ID_9_80 0x00098C27UL // unified_menu.c
+#define LOG_TOKEN_ID_9_84 0x0009CCAAUL // unified_menu.c
+#define LOG_TOKEN_ID_9_87 0x00095357UL // unified_menu.c
+#define LOG_TOKEN_ID_9_295 0x0009A4FBUL // unified_menu.c
+#define LOG_TOKEN_ID_9_328 0x00094BC9UL // unified_menu.c
+#define LOG_TOKEN_ID_9_333 0x00099083UL // unified_menu.c
+#define LOG_TOKEN_ID_9_447 0x0009DBB4UL // unified_menu.c
+#define LOG_TOKEN_ID_9_456 0x0009DBB4UL // unified_menu.c
+#define LOG_TOKEN_ID_9_520 0x000936C0UL // unified_menu.c
+#define LOG_TOKEN_ID_9_526 0x0009C910UL // unified_menu.c
+#define LOG_TOKEN_ID_9_527 0x000936C0UL // unified_menu.c
+#define LOG_TOKEN_ID_9_556 0x00096932UL // unified_menu.c
+#define LOG_TOKEN_ID_9_614 0x0009C3CEUL // unified_menu.c
+#define LOG_TOKEN_ID_9_628 0x0009CCEBUL // unified_menu.c
+#define LOG_TOKEN_ID_9_629 0x000936C0UL // unified_menu.c
+#define LOG_TOKEN_ID_9_635 0x000925D4UL // unified_menu.c
+#define LOG_TOKEN_ID_9_636 0x000936C0UL // unified_menu.c
+#define LOG_TOKEN_ID_9_820 0x0009E208UL // unified_menu.c
+
+#endif
@@ -1,4 +1,5 @@
 #include "rtc_date.h"
+#include "oled_draw.h"
 
 
 // ================== 全局变量 ==================
@@ -182,12 +183,12 @@ void MyRTC_Init(void)
         while (RCC_GetFlagStatus(RCC_FLAG_LSERDY) != SET) {
             Delay_s(1);
             printf("%d",timeout);
-            OLED_Printf_Line(0,"LSE time out : %d",(5-timeout));
-            OLED_DrawProgressBar(0,32,128,10,timeout,0,LSE_TIMEOUT_S,1,1,0);
-            OLED_Refresh_Dirty();
+            OLED_Post_Line(0,"LSE time out : %d",(5-timeout));
+            OLED_Post_Progress(0,32,128,10,timeout,0,LSE_TIMEOUT_S,
+                               OLED_BAR_BORDER | OLED_BAR_FILL | OLED_BAR_INVERT);
             if (++timeout > LSE_TIMEOUT_S) {
                 printf("LSE timeout! Falling back to LSI.\n");
-                OLED_Clear();
+                OLED_Post_Clear();
                 goto USE_LSI;
             }
         }
@@ -196,8 +197,7 @@ void MyRTC_Init(void)
         RCC_RTCCLKCmd(ENABLE);
         
         printf(" RTC_WaitForSynchro");
-        OLED_Printf_Line(1,"wait for Synchro...");
-        OLED_Refresh_Dirty();
+        OLED_Post_Line(1,"wait for Synchro...");
         if (!RTC_WaitForSynchro_Debug())
         {
             goto USE_LSI;
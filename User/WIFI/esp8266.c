@@ -1,7 +1,7 @@
 /**
  * @file esp8266.c
  * @author Jaychen (719095404@qq.com)
- * @brief esp8266ӰͷTCP豸
+ * @brief esp8266连接巴法云TCP设备
  * @version 0.1
  * @date 2025-12-09
  * 
@@ -13,14 +13,23 @@
 #include <stdio.h>
 #include <FreeRTOS.h>
 #include <task.h>
+#include "gateway.h"
+#include "cmd_router.h"
+#include "oled_draw.h"
+#define LOG_FILE_ID 2
+#include "log.h"
+
 
 extern uint8_t Server_connected=0;
 extern uint8_t wifi_connected = 0;
-//䵽ƶ˵ʱ
+//传输到云端的时间间隔
 uint16_t publish_delaytime = 15;
+esp8266_link_stats_t esp8266_link_stats = {0};
+esp8266_time_sync_t esp8266_time_sync = {0};
+static volatile uint8_t esp8266_time_request = 0; // 有未处理的对时请求
 
-extern uint8_t uart2_buffer[UART2_BUF_SIZE]; // uart2ջ
-extern uint8_t uart2_rx_len;     // uart2ճ
+extern uint8_t uart2_buffer[UART2_BUF_SIZE]; // uart2接收缓冲
+extern uint8_t uart2_rx_len;     // uart2接收长度
 
 void ESP8266_Receive_Start(void)
 {
@@ -29,19 +38,19 @@ void ESP8266_Receive_Start(void)
 }
 
 /**
- * @brief ָָʱڽָ
+ * @brief 发送指令，并指定时间内接收指定的数据
  *
- * @param cmd  ATָע\r\n
- * @param wait_string   ȴַ
- * @param timeout  ʱʱms
- * @return uint8_t 0ʱ1ɹ
+ * @param cmd  AT指令注意带\r\n
+ * @param wait_string   等待字符串
+ * @param timeout  超时时间ms
+ * @return uint8_t 0：超时，1：成功
  */
 uint8_t ESP8266_Send_AT_Cmd(const char *cmd, const char *wait_string, uint16_t timeout)
 {
     uart2_rx_len = 0;
     memset(uart2_buffer, 0, sizeof(uart2_buffer));
-    UART2_SendDataToWiFi_Poll((uint8_t *)cmd, strlen(cmd));    // 
-    //printf("ESP8266 Send cmd: %s", cmd);
+    UART2_SendDataToWiFi_Poll((uint8_t *)cmd, strlen(cmd));    // 发送命令
+    LOG_D(ESP8266, "ESP8266 Send cmd: %s", cmd);
 loop:
     while (uart2_rx_len <= 0 && timeout > 0)
     {
@@ -50,142 +59,191 @@ loop:
     }
     if (uart2_rx_len > 0 && timeout > 0 && strstr((const char *)uart2_buffer, wait_string))
     {
-        //printf("uart2_rx_len = %d, uart2_buf = %s\n", uart2_rx_len, uart2_buffer);
-        uart2_rx_len = 0; // սջ,
-        return 1;         // ɹ
+        LOG_D(ESP8266, "uart2_rx_len = %d, uart2_buf = %s\n", uart2_rx_len, uart2_buffer);
+        uart2_rx_len = 0; // 清空接收缓冲,继续接收
+        return 1;         // 成功
     }
     else if (timeout > 0)
     {
-        uart2_rx_len = 0; // սջ,
+        uart2_rx_len = 0; // 清空接收缓冲,继续接收
         goto loop;
     }
-    uart2_rx_len = 0; // սջ,
+    uart2_rx_len = 0; // 清空接收缓冲,继续接收
     return 0;
 }
 
-// ˳͸ģʽ
+// 退出透传模式
 uint8_t ESP8266_Exit_Transmit_Mode(void)
 {
-    if (ESP8266_Send_AT_Cmd("+++", NULL, 2000) != 1) // ˳͸ģʽ
+    if (ESP8266_Send_AT_Cmd("+++", NULL, 2000) != 1) // 退出透传模式
     {
-        printf("ESP8266 Exit Transmit Mode , Error\r\n");
+        LOG_E(ESP8266, "ESP8266 Exit Transmit Mode , Error\r\n");
         return 0;
     }
-    printf("ESP8266 Exit Transmit Mode , Success\r\n");
+    LOG_I(ESP8266, "ESP8266 Exit Transmit Mode , Success\r\n");
     return 1;
 }
 
 uint8_t ESP8266_Connect_WiFi(const char *ssid,const char *password)
 {
     uint8_t i = 0;
-    char cmd[50];                                       // ָ
-    ESP8266_Exit_Transmit_Mode();                      // ˳͸ģʽ
+    char cmd[50];                                       // 指令缓冲
+    ESP8266_Exit_Transmit_Mode();                      // 退出透传模式
 
-    while (ESP8266_Send_AT_Cmd("AT\r\n", "OK", 500) != 1) // ģ״̬
+    while (ESP8266_Send_AT_Cmd("AT\r\n", "OK", 500) != 1) // 测试模块状态
     {
         i++;
         if (i >= 3)
         {
-            printf("ESP8266 Send cmd: AT , Error\r\n");
+            LOG_E(ESP8266, "ESP8266 Send cmd: AT , Error\r\n");
             return 0;
         }
     }
-    if (ESP8266_Send_AT_Cmd("ATE0\r\n", "OK", 500) != 1) // رջ
+    if (ESP8266_Send_AT_Cmd("ATE0\r\n", "OK", 500) != 1) // 关闭回显
     {
-        printf("ESP8266 Send cmd: ATE0 , Error\r\n");
+        LOG_E(ESP8266, "ESP8266 Send cmd: ATE0 , Error\r\n");
         return 0;
     }
     
-    if (ESP8266_Send_AT_Cmd("AT+CWMODE=3\r\n", "OK", 500) != 1) // Ϊstationģʽ
+    if (ESP8266_Send_AT_Cmd("AT+CWMODE=3\r\n", "OK", 500) != 1) // 设置为station模式
     {
-        printf("ESP8266 Send cmd: AT+CWMODE=3 , Error\r\n");
+        LOG_E(ESP8266, "ESP8266 Send cmd: AT+CWMODE=3 , Error\r\n");
         return 0;
     }
 
-    snprintf(cmd, sizeof(cmd), "AT+CWJAP=\"%s\",\"%s\"\r\n", ssid, password); // ƴָ
-    if (ESP8266_Send_AT_Cmd(cmd, "OK", 8000) != 1)                           // WiFi
+    snprintf(cmd, sizeof(cmd), "AT+CWJAP=\"%s\",\"%s\"\r\n", ssid, password); // 拼接指令
+    if (ESP8266_Send_AT_Cmd(cmd, "OK", 8000) != 1)                           // 连接WiFi
     {
-        printf("ESP8266 Send cmd: %s, Error\r\n", cmd);
+        LOG_E(ESP8266, "ESP8266 Send cmd: %s, Error\r\n", cmd);
         return 0;
     }
     return 1;
 }
 
-// ӷbemfa.comTCP˿8344, MQTT˿ڣ9501͸ģʽ
+// 连接服务器bemfa.com，TCP端口8344, MQTT端口：9501，进入透传模式
 uint8_t ESP8266_Connect_Server(const char *ip,const char *port)
 {
-    char cmd[50];                                            // ָ
-    if (ESP8266_Send_AT_Cmd("AT+CIPMODE=1\r\n", "OK", 2000) != 1) // ͸ģʽ
+    char cmd[50];                                            // 指令缓冲
+    if (ESP8266_Send_AT_Cmd("AT+CIPMODE=1\r\n", "OK", 2000) != 1) // 设置透传模式
     {
-        printf("ESP8266 Send cmd: AT+CIPMODE=1 , Error\r\n");
+        LOG_E(ESP8266, "ESP8266 Send cmd: AT+CIPMODE=1 , Error\r\n");
         return 0;
     }
-    // ӷͶ˿AT+CIPSTART="TCP","bemfa.com",8344
+    // 连接服务器和端口AT+CIPSTART="TCP","bemfa.com",8344
     snprintf(cmd, sizeof(cmd), "AT+CIPSTART=\"TCP\",\"%s\",%s\r\n", ip, port);
-    if (ESP8266_Send_AT_Cmd(cmd, "OK", 5000) != 1) // ӷ
+    if (ESP8266_Send_AT_Cmd(cmd, "OK", 5000) != 1) // 连接服务器
     {
-        printf("ESP8266 Send cmd: %s, Error\r\n", cmd);
+        LOG_E(ESP8266, "ESP8266 Send cmd: %s, Error\r\n", cmd);
         return 0;
     }
-    // ͸ģʽ淢Ķ
-    if (ESP8266_Send_AT_Cmd("AT+CIPSEND\r\n", "OK", 3000) != 1) // ͸ģʽ
+    // 进入透传模式，后面发的都会无条件传输
+    if (ESP8266_Send_AT_Cmd("AT+CIPSEND\r\n", "OK", 3000) != 1) // 进入透传模式
     {
-        printf("ESP8266 Send cmd: AT+CIPSEND\r\n, Error\r\n");
+        LOG_E(ESP8266, "ESP8266 Send cmd: AT+CIPSEND\r\n, Error\r\n");
         return 0;
     }
     return 1;
 }
 
-// 
+// 订阅主题
 uint8_t ESP8266_TCP_Subscribe(const char *uid,const char *topic)
 {
-    char cmd[128]; // ָ
+    char cmd[128]; // 指令缓冲
     snprintf(cmd, sizeof(cmd), "cmd=1&uid=%s&topic=%s", uid, topic);
-    if (ESP8266_Send_AT_Cmd(cmd, "cmd=1&res=1", 1000) != 1) // ȴĳɹ
+    if (ESP8266_Send_AT_Cmd(cmd, "cmd=1&res=1", 1000) != 1) // 等待订阅成功
     {
-        return 0; // ʧ
+        return 0; // 订阅失败
     }
-    return 1; // ĳɹ
+    return 1; // 订阅成功
 }
 
-// 
+// 发布主题
 uint8_t ESP8266_TCP_Publish(const char *uid,const char *topic, char *data)
 {
-    char cmd[128]; // ָ
+    char cmd[128]; // 指令缓冲
     // cmd=2&uid=4d9ec352e0376f2110a0c601a2857225&topic=light002&msg=#32#27.80#ON#
     snprintf(cmd, sizeof(cmd), "cmd=2&uid=%s&topic=%s&msg=%s", uid, topic, data);
-    if (ESP8266_Send_AT_Cmd(cmd, "cmd=2&res=1", 1000) != 1) // ȴɹ
+    if (ESP8266_Send_AT_Cmd(cmd, "cmd=2&res=1", 1000) != 1) // 等待发布成功
     {
-        return 0; // ʧ
+        return 0; // 失败
     }
     return 1;
 }
 
 
 
-// 
+/**
+ * @brief 批量发布：连续发出多条cmd=2报文后统一等待应答，N个主题只等一次往返
+ *
+ * @param uid 巴法云私钥
+ * @param topics 主题数组
+ * @param msgs 消息数组
+ * @param count 条数
+ * @return uint8_t 成功发布（收到res=1）的条数
+ */
+uint8_t ESP8266_TCP_Publish_Batch(const char *uid, const char *const topics[], const char *const msgs[], uint8_t count)
+{
+    char cmd[128]; // 指令缓冲
+    uint8_t acked = 0;
+    uint16_t timeout = 1000;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uart2_rx_len = 0;
+    memset(uart2_buffer, 0, sizeof(uart2_buffer));
+    for (uint8_t i = 0; i < count; i++)
+    {
+        // 每条报文以\r\n分隔，服务器按行解析
+        snprintf(cmd, sizeof(cmd), "cmd=2&uid=%s&topic=%s&msg=%s\r\n", uid, topics[i], msgs[i]);
+        UART2_SendDataToWiFi_Poll((uint8_t *)cmd, strlen(cmd));
+    }
+
+    // 应答可能合并在一次IDLE中，也可能分多次到达，逐段累计
+    while (acked < count && timeout > 0)
+    {
+        if (uart2_rx_len > 0)
+        {
+            const char *p = (const char *)uart2_buffer;
+            while ((p = strstr(p, "cmd=2&res=1")) != NULL && acked < count)
+            {
+                acked++;
+                p += 11;
+            }
+            uart2_rx_len = 0;
+            memset(uart2_buffer, 0, sizeof(uart2_buffer));
+        }
+        timeout--;
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    return acked;
+}
+
+// 发送心跳包
 uint8_t ESP8266_TCP_Heartbeat(void)
 {
-    if (ESP8266_Send_AT_Cmd("cmd=0&msg=ping", "cmd=0&res=1", 1000) != 1) // ȴ
+    if (ESP8266_Send_AT_Cmd("cmd=0&msg=ping", "cmd=0&res=1", 1000) != 1) // 等待
     {
         return 0;
     }
     return 1;
 }
-// ȡʱ
+// 获取时间
 uint8_t ESP8266_TCP_GetTime(const char *uid, char *time_buffer, uint16_t buffer_size)
 {
     char cmd[128];
     snprintf(cmd, sizeof(cmd), "cmd=7&uid=%s&type=1\r\n", uid);
     
-    // սջ
+    // 清空接收缓冲区
     uart2_rx_len = 0;
     memset(uart2_buffer, 0, sizeof(uart2_buffer));
     
-    // ʱȡ
+    // 发送时间获取命令
     UART2_SendDataToWiFi_Poll((uint8_t *)cmd, strlen(cmd));
     
-    // ȴӦ
+    // 等待响应
     uint16_t timeout = 3000;
     while (uart2_rx_len <= 0 && timeout > 0)
     {
@@ -195,35 +253,35 @@ uint8_t ESP8266_TCP_GetTime(const char *uid, char *time_buffer, uint16_t buffer_
     
     if (uart2_rx_len > 0 && timeout > 0)
     {
-        // ʱݣʽ2021-06-11 16:39:27
+        // 查找时间数据（格式：2021-06-11 16:39:27）
 //        char *time_start = (char *)uart2_buffer;
         
-        // ֱӸƽյݵ
+        // 直接复制接收到的数据到输出缓冲区
         uint16_t copy_len = uart2_rx_len < buffer_size - 1 ? uart2_rx_len : buffer_size - 1;
         memcpy(time_buffer, uart2_buffer, copy_len);
         time_buffer[copy_len] = '\0';
         
-        // ӡյڵ
-        printf("Received time data: %s\n", time_buffer);
+        // 打印接收到的数据用于调试
+        LOG_I(ESP8266, "Received time data: %s\n", time_buffer);
         
-        uart2_rx_len = 0; // սջ
+        uart2_rx_len = 0; // 清空接收缓冲
         return 1;
     }
     
-    uart2_rx_len = 0; // սջ
+    uart2_rx_len = 0; // 清空接收缓冲
     return 0;
 }
 
 // ==================================
-// Ϣ
+// 新增消息解析函数
 // ==================================
 
 /**
- * @brief ַеָ
- * @param buffer յַ
- * @param topic Ҫҵtopic
- * @param msg_value 洢ҵmsgֵ
- * @return 1-ɹҵ0-δҵ
+ * @brief 解析命令字符串中的指定参数
+ * @param buffer 接收到的命令字符串
+ * @param topic 需要查找的topic
+ * @param msg_value 存储找到的msg值
+ * @return 1-成功找到参数，0-未找到
  */
 uint8_t ESP8266_Parse_Command(const char *buffer, const char *topic, char *msg_value)
 {
@@ -231,31 +289,31 @@ uint8_t ESP8266_Parse_Command(const char *buffer, const char *topic, char *msg_v
         return 0;
     }
     
-    // ʱַв
+    // 创建临时字符串进行查找
     char temp_topic[64];
     snprintf(temp_topic, sizeof(temp_topic), "topic=%s", topic);
     
-    // printf("Looking for topic: %s in buffer: %s\r\n", temp_topic, buffer);  // ӵϢ
+    LOG_D(ESP8266, "Looking for topic: %s in buffer: %s\r\n", temp_topic, buffer);
     
-    // Ƿָtopic
+    // 检查是否包含指定的topic
     if (strstr(buffer, temp_topic) == NULL) {
-        printf("Topic not found\r\n");  // ӵϢ
+        LOG_D(ESP8266, "Topic not found\r\n");
         return 0;
     }
     
-    // printf("Topic found!\r\n");  // ӵϢ
+    LOG_D(ESP8266, "Topic found!\r\n");
     
-    // msg
+    // 查找msg参数
     const char *msg_start = strstr(buffer, "msg=");
     if (msg_start == NULL) {
-        printf("msg parameter not found\r\n");  // ӵϢ
+        LOG_W(ESP8266, "msg parameter not found\r\n");
         return 0;
     }
     
-    // "msg="ǰ׺
+    // 跳过"msg="前缀
     msg_start += 4;
     
-    // ȡmsgֱֵ&\r\nַ
+    // 提取msg值（直到遇到&或\r或\n或字符串结束）
     int i = 0;
     while (msg_start[i] != '\0' && msg_start[i] != '&' && msg_start[i] != '\r' && msg_start[i] != '\n' && i < 31) {
         msg_value[i] = msg_start[i];
@@ -268,9 +326,9 @@ uint8_t ESP8266_Parse_Command(const char *buffer, const char *topic, char *msg_v
 }
 
 /**
- * @brief صԶ
- * @param buffer յַ
- * @return 1-ɹ0-δ
+ * @brief 处理传感器相关的远程命令（USART2适配层，命令表见cmd_table.c）
+ * @param buffer 接收到的命令字符串
+ * @return 1-成功处理命令，0-未处理
  */
 uint8_t ESP8266_Process_Sensor_Commands(const char *buffer)
 {
@@ -278,42 +336,84 @@ uint8_t ESP8266_Process_Sensor_Commands(const char *buffer)
         return 0;
     }
     
-    printf("Processing command: %s\r\n", buffer);  // ӵϢ
-    
-    char msg_value[32] = {0};
+    LOG_D(ESP8266, "Processing command: %s\r\n", buffer);  // 添加调试信息
     
-  
-    
-    // Light
-    if (ESP8266_Parse_Command(buffer, "myLUX004", msg_value)) {
-        printf("Found Light topic, msg_value: %s\r\n", msg_value);  // ӵϢ
-        extern uint8_t Light_ON;
-        if (strcmp(msg_value, "on") == 0) {
-            Light_ON = 1;
-            printf("Light sensor turned ON via remote command, current status: %d\r\n", Light_ON);
-            return 1;
-        } else if (strcmp(msg_value, "off") == 0) {
-            Light_ON = 0;
-            printf("Light sensor turned OFF via remote command, current status: %d\r\n", Light_ON);
-            return 1;
+    return Cmd_Process_Bemfa(buffer) == CMD_OK;
+}
+
+static TaskHandle_t ESP8266_handle = NULL;
+
+/**
+ * @brief 创建ESP8266任务（网关模式下由main调用）
+ * @retval 0: 成功, 1: 堆不足创建失败
+ */
+uint8_t ESP8266_CreateTask(void)
+{
+    return xTaskCreate((TaskFunction_t)ESP8266_Main_Task, /* 任务函数 */
+                       (const char *)"ESP8266_Main",      /* 任务名称 */
+                       (uint16_t)512,                     /* 任务堆栈大小（批量发布缓冲在栈上） */
+                       (void *)NULL,                      /* 任务参数 */
+                       (UBaseType_t)2,                    /* 任务优先级 */
+                       (TaskHandle_t *)&ESP8266_handle) != pdPASS; /* 任务句柄 */
+}
+
+/**
+ * @brief 请求一次网络对时（任意任务可调用，不阻塞），进度和结果见esp8266_time_sync
+ * @retval 1: 已受理（含已在进行中）, 0: ESP8266任务没有运行
+ */
+uint8_t ESP8266_Request_Time_Sync(void)
+{
+    if (ESP8266_handle == NULL)
+    {
+        return 0;
+    }
+    if (esp8266_time_sync.state != ESP8266_TIME_BUSY)
+    {
+        esp8266_time_sync.attempt = 0;
+        esp8266_time_sync.state = ESP8266_TIME_BUSY;
+        esp8266_time_request = 1;
+    }
+    return 1;
+}
+
+/**
+ * @brief 执行对时请求：查询网络时间（带重试）并写入RTC，在ESP8266任务中调用
+ */
+static void ESP8266_Sync_Time(const char *uid)
+{
+    for (uint8_t attempt = 1; attempt <= ESP8266_TIME_RETRIES; attempt++)
+    {
+        esp8266_time_sync.attempt = attempt;
+        if (ESP8266_TCP_GetTime(uid, esp8266_time_sync.time, sizeof(esp8266_time_sync.time)) == 1)
+        {
+            LOG_I(ESP8266, "Time sync: %s\r\n", esp8266_time_sync.time);
+            if (RTC_SetFromNetworkTime(esp8266_time_sync.time) != 1)
+            {
+                LOG_E(ESP8266, "Time sync: RTC Sync Failed\r\n");
+                esp8266_time_sync.state = ESP8266_TIME_RTC_FAILED;
+                return;
+            }
+            esp8266_time_sync.state = ESP8266_TIME_OK;
+            return;
+        }
+        LOG_W(ESP8266, "Time sync: Get Time Error, attempt %d/%d\r\n", attempt, ESP8266_TIME_RETRIES);
+        if (attempt < ESP8266_TIME_RETRIES)
+        {
+            vTaskDelay(pdMS_TO_TICKS(5000));
         }
-        return 1; // ȷʹmsgֵƥҲ
     }
-    
-  
-    
-    return 0;
+    esp8266_time_sync.state = ESP8266_TIME_FAILED;
 }
 
 static void ESP8266_Main_Task(void *pvParameters)
 {
-    printf("ESP8266_Main_Task start ->\n");
+    LOG_I(ESP8266, "ESP8266_Main_Task start ->\n");
 
     uint8_t first = 1;
     TickType_t heart_tick = xTaskGetTickCount(); //
     TickType_t Publish_tick = xTaskGetTickCount();
 
-    vTaskDelay(pdMS_TO_TICKS(2000)); // ȴESP8266
+    vTaskDelay(pdMS_TO_TICKS(2000)); // 等待ESP8266开机
     ESP8266_Receive_Start();
 
     uint8_t retry_count = 0;
@@ -322,19 +422,19 @@ static void ESP8266_Main_Task(void *pvParameters)
     while (!wifi_connected && retry_count < max_retries)
     {
         retry_count++;
-        printf("WiFi connection attempt %d/%d\r\n", retry_count, max_retries);
+        LOG_D(ESP8266, "WiFi connection attempt %d/%d\r\n", retry_count, max_retries);
 
-        if (ESP8266_Connect_WiFi("ElevatedNetwork.lt", "798798798") == 1) // WiFi
+        if (ESP8266_Connect_WiFi("ElevatedNetwork.lt", "798798798") == 1) // 连接WiFi
         {
-            printf("ESP8266 Connect WiFi Success\r\n");
+            LOG_I(ESP8266, "ESP8266 Connect WiFi Success\r\n");
             wifi_connected = 1;
         }
         else
         {
-            printf("ESP8266 Connect WiFi Error, attempt %d/%d\r\n", retry_count, max_retries);
+            LOG_W(ESP8266, "ESP8266 Connect WiFi Error, attempt %d/%d\r\n", retry_count, max_retries);
             if (retry_count < max_retries)
             {
-                // ȴ5
+                // 等待5秒后重试
                 vTaskDelay(pdMS_TO_TICKS(5000));
             }
         }
@@ -342,19 +442,18 @@ static void ESP8266_Main_Task(void *pvParameters)
 
     if (!wifi_connected)
     {
-        printf("WiFi connection failed after %d attempts, entering retry loop\r\n", max_retries);
+        LOG_W(ESP8266, "WiFi connection failed after %d attempts, entering retry loop\r\n", max_retries);
 
-        // ѭ
+        // 进入无限重试循环
         while (!wifi_connected)
         {
-            vTaskDelay(pdMS_TO_TICKS(30000)); // ÿ30һ
-            printf("Retrying WiFi connection...\r\n");
+            vTaskDelay(pdMS_TO_TICKS(30000)); // 每30秒重试一次
+            LOG_I(ESP8266, "Retrying WiFi connection...\r\n");
             if (ESP8266_Connect_WiFi("ElevatedNetwork.lt", "798798798") == 1)
             {
-                printf("ESP8266 Connect WiFi Success after retry\r\n");
+                LOG_I(ESP8266, "ESP8266 Connect WiFi Success after retry\r\n");
                 wifi_connected = 1;
-                OLED_Printf_Line(0, "WiFi Connected!");
-                OLED_Refresh();
+                OLED_Post_Line(0, "WiFi Connected!");
             }
         }
     }
@@ -363,18 +462,18 @@ static void ESP8266_Main_Task(void *pvParameters)
     while (!Server_connected && retry_count < max_retries)
     {
         retry_count++;
-        printf("Server connection attempt %d/%d\r\n", retry_count, max_retries);
-        if (ESP8266_Connect_Server("bemfa.com", "8344") == 1) // ӷ
+        LOG_D(ESP8266, "Server connection attempt %d/%d\r\n", retry_count, max_retries);
+        if (ESP8266_Connect_Server("bemfa.com", "8344") == 1) // 尝试连接服务器
         {
-            printf("ESP8266 Connect Server Success\r\n");
+            LOG_I(ESP8266, "ESP8266 Connect Server Success\r\n");
             Server_connected = 1;
         }
         else
         {
-            printf("ESP8266 Connect Server Error, attempt %d/%d\r\n", retry_count, max_retries);
+            LOG_W(ESP8266, "ESP8266 Connect Server Error, attempt %d/%d\r\n", retry_count, max_retries);
             if (retry_count < max_retries)
             {
-                // ȴ5
+                // 等待5秒后重试
                 vTaskDelay(pdMS_TO_TICKS(5000));
             }
         }
@@ -382,22 +481,22 @@ static void ESP8266_Main_Task(void *pvParameters)
 
     if (!Server_connected)
     {
-        printf("Server connection failed after %d attempts, entering retry loop\r\n", max_retries);
+        LOG_W(ESP8266, "Server connection failed after %d attempts, entering retry loop\r\n", max_retries);
 
         while (!Server_connected)
         {
-            vTaskDelay(pdMS_TO_TICKS(30000)); // ÿ30һ
-            printf("Retrying Server connection...\r\n");
+            vTaskDelay(pdMS_TO_TICKS(30000)); // 每30秒重试一次
+            LOG_I(ESP8266, "Retrying Server connection...\r\n");
             if (ESP8266_Connect_Server("bemfa.com", "8344") == 1)
             {
-                printf("ESP8266 Connect Server Success after retry\r\n");
+                LOG_I(ESP8266, "ESP8266 Connect Server Success after retry\r\n");
                 Server_connected = 1;
             }
         }
     }
 
-    printf("ESP8266 Connect Server Success\r\n");
-   // ====================== 1mydht004ԣ ======================
+    LOG_I(ESP8266, "ESP8266 Connect Server Success\r\n");
+   // ====================== 订阅主题1：mydht004（带重试） ======================
     retry_count = 0;
     uint8_t sub1_connected = 0;
     const char* uid = "4af24e3731744508bd519435397e4ab5";
@@ -406,19 +505,19 @@ static void ESP8266_Main_Task(void *pvParameters)
     while (!sub1_connected && retry_count < max_retries)
     {
         retry_count++;
-        printf("Subscribe %s attempt %d/%d\r\n", topic1, retry_count, max_retries);
+        LOG_D(ESP8266, "Subscribe %s attempt %d/%d\r\n", topic1, retry_count, max_retries);
         
-        if (ESP8266_TCP_Subscribe(uid, topic1) == 1) // 
+        if (ESP8266_TCP_Subscribe(uid, topic1) == 1) // 订阅主题
         {
-            printf("ESP8266 TCP Subscribe %s Success\r\n", topic1);
+            LOG_I(ESP8266, "ESP8266 TCP Subscribe %s Success\r\n", topic1);
             sub1_connected = 1;
         }
         else
         {
-            printf("ESP8266 TCP Subscribe %s Error, attempt %d/%d\r\n", topic1, retry_count, max_retries);
+            LOG_W(ESP8266, "ESP8266 TCP Subscribe %s Error, attempt %d/%d\r\n", topic1, retry_count, max_retries);
             if (retry_count < max_retries)
             {
-                // ȴ5
+                // 等待5秒后重试
                 vTaskDelay(pdMS_TO_TICKS(5000));
             }
         }
@@ -426,22 +525,22 @@ static void ESP8266_Main_Task(void *pvParameters)
 
     if (!sub1_connected)
     {
-        printf("Subscribe %s failed after %d attempts, entering retry loop\r\n", topic1, max_retries);
+        LOG_W(ESP8266, "Subscribe %s failed after %d attempts, entering retry loop\r\n", topic1, max_retries);
 
-        // ѭ
+        // 进入无限重试循环
         while (!sub1_connected)
         {
-            vTaskDelay(pdMS_TO_TICKS(30000)); // ÿ30һ
-            printf("Retrying subscribe %s...\r\n", topic1);
+            vTaskDelay(pdMS_TO_TICKS(30000)); // 每30秒重试一次
+            LOG_I(ESP8266, "Retrying subscribe %s...\r\n", topic1);
             if (ESP8266_TCP_Subscribe(uid, topic1) == 1)
             {
-                printf("ESP8266 TCP Subscribe %s Success after retry\r\n", topic1);
+                LOG_I(ESP8266, "ESP8266 TCP Subscribe %s Success after retry\r\n", topic1);
                 sub1_connected = 1;
             }
         }
     }
 
-    // ====================== 2myMP25004ԣ ======================
+    // ====================== 订阅主题2：myMP25004（带重试） ======================
     retry_count = 0;
     uint8_t sub2_connected = 0;
     const char* topic2 = "myMP25004";
@@ -449,19 +548,19 @@ static void ESP8266_Main_Task(void *pvParameters)
     while (!sub2_connected && retry_count < max_retries)
     {
         retry_count++;
-        printf("Subscribe %s attempt %d/%d\r\n", topic2, retry_count, max_retries);
+        LOG_D(ESP8266, "Subscribe %s attempt %d/%d\r\n", topic2, retry_count, max_retries);
         
-        if (ESP8266_TCP_Subscribe(uid, topic2) == 1) // 
+        if (ESP8266_TCP_Subscribe(uid, topic2) == 1) // 订阅主题
         {
-            printf("ESP8266 TCP Subscribe %s Success\r\n", topic2);
+            LOG_I(ESP8266, "ESP8266 TCP Subscribe %s Success\r\n", topic2);
             sub2_connected = 1;
         }
         else
         {
-            printf("ESP8266 TCP Subscribe %s Error, attempt %d/%d\r\n", topic2, retry_count, max_retries);
+            LOG_W(ESP8266, "ESP8266 TCP Subscribe %s Error, attempt %d/%d\r\n", topic2, retry_count, max_retries);
             if (retry_count < max_retries)
             {
-                // ȴ5
+                // 等待5秒后重试
                 vTaskDelay(pdMS_TO_TICKS(5000));
             }
         }
@@ -469,22 +568,22 @@ static void ESP8266_Main_Task(void *pvParameters)
 
     if (!sub2_connected)
     {
-        printf("Subscribe %s failed after %d attempts, entering retry loop\r\n", topic2, max_retries);
+        LOG_W(ESP8266, "Subscribe %s failed after %d attempts, entering retry loop\r\n", topic2, max_retries);
 
-        // ѭ
+        // 进入无限重试循环
         while (!sub2_connected)
         {
-            vTaskDelay(pdMS_TO_TICKS(30000)); // ÿ30һ
-            printf("Retrying subscribe %s...\r\n", topic2);
+            vTaskDelay(pdMS_TO_TICKS(30000)); // 每30秒重试一次
+            LOG_I(ESP8266, "Retrying subscribe %s...\r\n", topic2);
             if (ESP8266_TCP_Subscribe(uid, topic2) == 1)
             {
-                printf("ESP8266 TCP Subscribe %s Success after retry\r\n", topic2);
+                LOG_I(ESP8266, "ESP8266 TCP Subscribe %s Success after retry\r\n", topic2);
                 sub2_connected = 1;
             }
         }
     }
 
-    // ====================== 3myLUX004ԣ ======================
+    // ====================== 订阅主题3：myLUX004（带重试） ======================
     retry_count = 0;
     uint8_t sub3_connected = 0;
     const char* topic3 = "myLUX004";
@@ -492,19 +591,19 @@ static void ESP8266_Main_Task(void *pvParameters)
     while (!sub3_connected && retry_count < max_retries)
     {
         retry_count++;
-        printf("Subscribe %s attempt %d/%d\r\n", topic3, retry_count, max_retries);
+        LOG_D(ESP8266, "Subscribe %s attempt %d/%d\r\n", topic3, retry_count, max_retries);
         
-        if (ESP8266_TCP_Subscribe(uid, topic3) == 1) // 
+        if (ESP8266_TCP_Subscribe(uid, topic3) == 1) // 订阅主题
         {
-            printf("ESP8266 TCP Subscribe %s Success\r\n", topic3);
+            LOG_I(ESP8266, "ESP8266 TCP Subscribe %s Success\r\n", topic3);
             sub3_connected = 1;
         }
         else
         {
-            printf("ESP8266 TCP Subscribe %s Error, attempt %d/%d\r\n", topic3, retry_count, max_retries);
+            LOG_W(ESP8266, "ESP8266 TCP Subscribe %s Error, attempt %d/%d\r\n", topic3, retry_count, max_retries);
             if (retry_count < max_retries)
             {
-                // ȴ5
+                // 等待5秒后重试
                 vTaskDelay(pdMS_TO_TICKS(5000));
             }
         }
@@ -512,22 +611,22 @@ static void ESP8266_Main_Task(void *pvParameters)
 
     if (!sub3_connected)
     {
-        printf("Subscribe %s failed after %d attempts, entering retry loop\r\n", topic3, max_retries);
+        LOG_W(ESP8266, "Subscribe %s failed after %d attempts, entering retry loop\r\n", topic3, max_retries);
 
-        // ѭ
+        // 进入无限重试循环
         while (!sub3_connected)
         {
-            vTaskDelay(pdMS_TO_TICKS(30000)); // ÿ30һ
-            printf("Retrying subscribe %s...\r\n", topic3);
+            vTaskDelay(pdMS_TO_TICKS(30000)); // 每30秒重试一次
+            LOG_I(ESP8266, "Retrying subscribe %s...\r\n", topic3);
             if (ESP8266_TCP_Subscribe(uid, topic3) == 1)
             {
-                printf("ESP8266 TCP Subscribe %s Success after retry\r\n", topic3);
+                LOG_I(ESP8266, "ESP8266 TCP Subscribe %s Success after retry\r\n", topic3);
                 sub3_connected = 1;
             }
         }
     }
 
-    // ====================== ȡʱ䣨ԣ ======================
+    // ====================== 获取时间（带重试） ======================
     retry_count = 0;
     uint8_t get_time_success = 0;
     char time_buffer[64];
@@ -535,19 +634,19 @@ static void ESP8266_Main_Task(void *pvParameters)
     while (!get_time_success && retry_count < max_retries)
     {
         retry_count++;
-        printf("Get Time attempt %d/%d\r\n", retry_count, max_retries);
+        LOG_D(ESP8266, "Get Time attempt %d/%d\r\n", retry_count, max_retries);
         
         if (ESP8266_TCP_GetTime(uid, time_buffer, sizeof(time_buffer)) == 1)
         {
-            printf("ESP8266 Get Time Success: %s\r\n", time_buffer);
+            LOG_I(ESP8266, "ESP8266 Get Time Success: %s\r\n", time_buffer);
             get_time_success = 1;
         }
         else
         {
-            printf("ESP8266 Get Time Error, attempt %d/%d\r\n", retry_count, max_retries);
+            LOG_W(ESP8266, "ESP8266 Get Time Error, attempt %d/%d\r\n", retry_count, max_retries);
             if (retry_count < max_retries)
             {
-                // ȴ5
+                // 等待5秒后重试
                 vTaskDelay(pdMS_TO_TICKS(5000));
             }
         }
@@ -555,81 +654,115 @@ static void ESP8266_Main_Task(void *pvParameters)
 
     if (!get_time_success)
     {
-        printf("Get Time failed after %d attempts, entering retry loop\r\n", max_retries);
+        LOG_W(ESP8266, "Get Time failed after %d attempts, entering retry loop\r\n", max_retries);
 
-        // ѭ
+        // 进入无限重试循环
         while (!get_time_success)
         {
-            vTaskDelay(pdMS_TO_TICKS(30000)); // ÿ30һ
-            printf("Retrying Get Time...\r\n");
+            vTaskDelay(pdMS_TO_TICKS(30000)); // 每30秒重试一次
+            LOG_I(ESP8266, "Retrying Get Time...\r\n");
             if (ESP8266_TCP_GetTime(uid, time_buffer, sizeof(time_buffer)) == 1)
             {
-                printf("ESP8266 Get Time Success after retry: %s\r\n", time_buffer);
+                LOG_I(ESP8266, "ESP8266 Get Time Success after retry: %s\r\n", time_buffer);
                 get_time_success = 1;
             }
         }
     }
 
-    // ͬRTC
+    // 同步到RTC
     if (RTC_SetFromNetworkTime(time_buffer) != 1)
     {
-        printf("RTC Sync Failed\r\n");
+        LOG_E(ESP8266, "RTC Sync Failed\r\n");
     }
     else
     {
-        printf("RTC Sync Success\r\n");
+        LOG_I(ESP8266, "RTC Sync Success\r\n");
     }
 
     while (1)
     {
         if ((xTaskGetTickCount() - heart_tick) / 1000 >= 60)
         {
-            // ƽ̨
+            // 发送心跳包云平台
             heart_tick = xTaskGetTickCount();
             ESP8266_TCP_Heartbeat();
+            esp8266_link_stats.heartbeats++;
         }
 
         if ((xTaskGetTickCount() - Publish_tick) / 1000 >= publish_delaytime || first)
         {
-            printf("---->\r\n");
-            // 
+            LOG_D(ESP8266, "---->\r\n");
+            // 发布主题
             Publish_tick = xTaskGetTickCount();
             first = 0;
 
             //
 
-            char data[16];
-            //  :mydht004
+            // 本板样本与网关汇聚的节点样本合并为一批发布
+            char topics[GATEWAY_MAX_NODES + 1][GATEWAY_TOPIC_LEN];
+            char msgs[GATEWAY_MAX_NODES + 1][GATEWAY_MSG_LEN];
+            const char *topic_list[GATEWAY_MAX_NODES + 1];
+            const char *msg_list[GATEWAY_MAX_NODES + 1];
+            uint8_t count = 0;
             
             if (Light_ON)
             {
-                //  :myLuxGet
-                snprintf(data, sizeof(data), "#%d",
+                // 发布主题 :myLuxGet
+                strcpy(topics[count], "myLUX004");
+                snprintf(msgs[count], GATEWAY_MSG_LEN, "#%d",
                          SensorData.light_data.lux);
+                count++;
+            }
+#if GATEWAY_ENABLE
+            count += Gateway_Collect_Samples(&topics[count], &msgs[count], GATEWAY_MAX_NODES + 1 - count);
+#endif
+            for (uint8_t i = 0; i < count; i++)
+            {
+                topic_list[i] = topics[i];
+                msg_list[i] = msgs[i];
+            }
 
-                if (ESP8266_TCP_Publish("4af24e3731744508bd519435397e4ab5", "myLUX004", data) != 1) // 
+            if (count > 0)
+            {
+                uint8_t acked = ESP8266_TCP_Publish_Batch(uid, topic_list, msg_list, count); // 发布主题
+                esp8266_link_stats.publish_ok += acked;
+                esp8266_link_stats.publish_fail += count - acked;
+                if (acked != count)
                 {
-                    printf("ESP8266 TCP Publish myLuxGet Error\r\n");
+                    LOG_W(ESP8266, "TCP Publish Error, %d/%d acked\r\n", acked, count);
                 }
                 else
                 {
-                    printf("ESP8266 TCP Publish myLuxGet Success\r\n");
+                    LOG_I(ESP8266, "TCP Publish %d topics Success\r\n", count);
                 }
             }
-           
+        }
+#if GATEWAY_ENABLE
+        Gateway_Service_Cloud(uid);
+#endif
+        if (esp8266_time_request)
+        {
+            esp8266_time_request = 0;
+            ESP8266_Sync_Time(uid);
         }
         if (uart2_rx_len > 0)
         {
             uart2_rx_len = 0;
-            printf("ESP8266 Receive Data: %s\r\n", uart2_buffer); // յͷ·
+            esp8266_link_stats.rx_msgs++;
+            LOG_I(ESP8266, "Receive Data: %s\r\n", (const char *)uart2_buffer); // 收到巴法云下发的数据
             
-            // ʹµͳһϢ
+            // 使用新的统一消息解析函数处理传感器命令
             uint8_t result = ESP8266_Process_Sensor_Commands((const char *)uart2_buffer);
+#if GATEWAY_ENABLE
+            if (result == 0) {
+                // 不是本板主题，尝试转发给对端节点
+                result = Gateway_Route_Downlink((const char *)uart2_buffer);
+            }
+#endif
             if (result == 1) {
-                printf("Command processed successfully. Current sensor states: Light=%d\r\n", 
-                        Light_ON);
+                LOG_I(ESP8266, "Command processed successfully. Current sensor states: Light=%d\r\n", Light_ON);
             } else {
-                printf("No matching sensor command found\r\n");
+                LOG_D(ESP8266, "No matching sensor command found\r\n");
             }
             
         }
@@ -19,11 +19,40 @@ extern uint8_t wifi_connected;
 extern uint8_t Server_connected;
 extern uint16_t publish_delaytime;
 
+// 云端链路计数（控制台 link 命令读取）
+typedef struct
+{
+    uint32_t publish_ok;    // 发布成功（已应答）条数
+    uint32_t publish_fail;  // 发布未应答条数
+    uint32_t heartbeats;    // 心跳发送次数
+    uint32_t rx_msgs;       // 收到的下发消息数
+} esp8266_link_stats_t;
+
+extern esp8266_link_stats_t esp8266_link_stats;
+
+// 网络对时：页面只投递请求，由ESP8266任务在主循环里执行（单次查询最长阻塞约3s，失败隔5s重试）
+#define ESP8266_TIME_IDLE       0 // 未请求
+#define ESP8266_TIME_BUSY       1 // 已请求，等待或正在查询
+#define ESP8266_TIME_OK         2 // 已写入RTC
+#define ESP8266_TIME_FAILED     3 // 重试后仍未取到时间
+#define ESP8266_TIME_RTC_FAILED 4 // 取到的时间无法写入RTC
+#define ESP8266_TIME_RETRIES    3
+
+typedef struct
+{
+    volatile uint8_t state;   // ESP8266_TIME_xxx
+    volatile uint8_t attempt; // 当前第几次查询，0表示还没开始
+    char time[64];            // 取到的时间，state为OK/RTC_FAILED时有效
+} esp8266_time_sync_t;
+
+extern esp8266_time_sync_t esp8266_time_sync;
+
 void ESP8266_Receive_Start(void);
 uint8_t ESP8266_Connect_WiFi(const char *ssid,const char *password);
 uint8_t ESP8266_Connect_Server(const char *ip,const char *port);
 uint8_t ESP8266_TCP_Subscribe(const char *uid,const char *topic);
 uint8_t ESP8266_TCP_Publish(const char *uid,const char *topic, char *data);
+uint8_t ESP8266_TCP_Publish_Batch(const char *uid, const char *const topics[], const char *const msgs[], uint8_t count);
 uint8_t ESP8266_TCP_Heartbeat(void);
 uint8_t ESP8266_TCP_GetTime(const char *uid, char *time_buffer, uint16_t buffer_size);
 
@@ -33,4 +62,6 @@ uint8_t ESP8266_Process_Sensor_Commands(const char *buffer);
 
 
 static void ESP8266_Main_Task(void *pvParameters);
+uint8_t ESP8266_CreateTask(void);
+uint8_t ESP8266_Request_Time_Sync(void);
 #endif 
@@ -6,10 +6,14 @@
 #include "debug.h"
 #include "beep.h"
 #include "oled_print.h"
+#include "oled_draw.h"
+#include "oled_widget.h"
 #include "rtc_date.h"
 #include "queue.h"
 #include "unified_menu.h"
+#include "memory_optimized_menu.h"
 #include "index.h"
+#include "LogView.h"
 #include "esp8266.h"
 #include "uart2.h"
 #include "uart3.h"
@@ -18,10 +22,15 @@
 #include "rtc_date.h"
 #include "sensordata.h"
 #include "LED.h"
-// 洢¼
-QueueHandle_t keyQueue; // 
+#include "gateway.h"
+#define LOG_FILE_ID 1
+#include "log.h"
+#include "console.h"
 
-// ֤״̬Ŀɷ
+// 创建队列来存储按键事件
+QueueHandle_t keyQueue; // 按键队列
+
+// 验证传感器状态变量的可访问性
 extern uint8_t Light_ON;
 
 static TaskHandle_t Menu_handle = NULL;
@@ -29,17 +38,41 @@ static TaskHandle_t Key_handle = NULL;
 static TaskHandle_t ESP8266_handle = NULL;
 static TaskHandle_t Bluetooth_handle = NULL;
 
-/*  */
+// 菜单任务堆栈（字）：最深是状态页同步网络时间（页面绘制 -> AT收发 -> 日志格式化），约1.3KB
+#define MENU_TASK_STACK 512
+
+/* 任务函数声明 */
 static void Menu_Main_Task(void *pvParameters);
 static void Key_Main_Task(void *pvParameters);
 static void ESP8266_Main_Task(void *pvParameters);
 static void Bluetooth_Main_Task(void *pvParameters);
 
+/**
+ * @brief 检查任务创建结果，失败时打印任务名和剩余堆
+ * @param failed: 创建函数的结果，非0表示失败
+ * @return 失败返回1，成功返回0（调用者累加）
+ */
+static uint8_t Main_Check_Task(uint8_t failed, const char *name)
+{
+    if (failed)
+    {
+        LOG_E(MAIN, "create task %s failed, heap %u bytes free\r\n", name, (unsigned)xPortGetFreeHeapSize());
+        return 1;
+    }
+    return 0;
+}
+
 int main(void)
 {
-    // ϵͳʼʼ
+    uint8_t task_failed = 0;
+
+    // 系统初始化开始
+    // 4位全部用作抢占优先级（FreeRTOS要求），必须在任何NVIC_Init之前设置
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_4);
     TIM2_Delay_Init();
     debug_init();
+    Log_Init();
+    printf("[log] token db %08lX\r\n", (unsigned long)log_token_db_hash);
     OLED_Init();
     HC05_Init(115200);
     OLED_Show_many_Tupian(tjbg, 8, 1);
@@ -54,15 +87,15 @@ int main(void)
     LED_Init();
     LED1_ON();
     LED2_ON();
-    // ʼUART2ESP8266ͨ
+    // 初始化UART2，用于ESP8266通信
     UART2_DMA_RX_Init(115200);
 
-    // Ϣ
+    // 添加蓝牙调试信息
     printf("UART3 (Bluetooth) DMA+IDLE initialization complete\r\n");
     printf("UART3 Buffer address: %p, Size: %d\r\n", uart3_buffer, UART3_BUF_SIZE);
     printf("Bluetooth task created with priority 2\r\n");
 
-    // ȡFlashСĴ (0x1FFFF7E22)
+    // 读取Flash大小寄存器 (0x1FFFF7E22)
     uint16_t flash_size = *((uint16_t *)0x1FFFF7E0);
 
     printf("Flash Size: %d KB\n", flash_size);
@@ -73,77 +106,113 @@ int main(void)
     Delay_s(1);
     OLED_Clear();
 
-    // printf("ESP8266ʼڶн...\r\n");
+    // printf("ESP8266初始化将在独立任务中进行...\r\n");
     // OLED_Printf_Line(0, "WiFi Connecting...");
     // OLED_Printf_Line(1, "Please Wait...");
     OLED_Refresh();
 
-    // ʼģ
+    // 初始化传感器数据模块
     SensorData_Init();
     printf("Sensor data initialization complete\r\n");
 
-    // ʼ˵ϵͳ
+    // 初始化菜单系统
     if (menu_system_init() != 0)
     {
         printf("Menu system initialization failed\r\n");
         return -1;
     }
 
-    // ʼҳ
-    menu_item_t *index_menu = index_init();
-    if (index_menu == NULL)
+    // 初始化页面模块（菜单树是flash里的常量表，不需要创建）
+    index_init();
+    LogView_init();
+
+    // 设置首页为根菜单
+    g_menu_sys.root_menu = &g_menu_tree[MENU_NODE_INDEX];
+    g_menu_sys.current_menu = g_menu_sys.root_menu;
+
+    // 菜单树占用：常量表在flash里，RAM只有选中状态，不占FreeRTOS堆
+    menu_memory_report();
+
+    // 传感器数据变化时通知菜单刷新（菜单任务平时阻塞，不再定时轮询）
+    SensorData_Set_Update_Hook(menu_request_refresh);
+
+    // 显示任务：菜单画完一帧后由它在后台发送到OLED，其他任务投递的绘制命令也由它执行
+    OLED_Text_Init();
+    OLED_Widget_Init();
+    OLED_Draw_Init();
+    task_failed += Main_Check_Task(OLED_Display_CreateTask(), "OLED_Display");
+
+    /* 创建菜单任务 */
+    task_failed += Main_Check_Task(
+        xTaskCreate((TaskFunction_t)Menu_Main_Task, /* 任务函数 */
+                    (const char *)"Menu_Main",      /* 任务名称 */
+                    (uint16_t)MENU_TASK_STACK,      /* 任务堆栈大小 */
+                    (void *)NULL,                   /* 任务函数参数 */
+                    (UBaseType_t)4,                 /* 任务优先级 */
+                    (TaskHandle_t *)&Menu_handle) != pdPASS, /* 任务控制句柄 */
+        "Menu_Main");
+    task_failed += Main_Check_Task(xTaskCreate(Key_Main_Task, "KeyMain", 96, NULL, 4, &Key_handle) != pdPASS,
+                                   "KeyMain");
+
+#if GATEWAY_ENABLE
+    // 网关模式：HC-05由网关任务独占，ESP8266任务负责汇聚发布
+    Gateway_Init();
+    task_failed += Main_Check_Task(
+        xTaskCreate((TaskFunction_t)Gateway_Main_Task,
+                    (const char *)"Gateway_Main",
+                    (uint16_t)384,
+                    (void *)NULL,
+                    (UBaseType_t)2,
+                    (TaskHandle_t *)&Bluetooth_handle) != pdPASS,
+        "Gateway_Main");
+    task_failed += Main_Check_Task(ESP8266_CreateTask(), "ESP8266_Main");
+#else
+    // 创建蓝牙数据处理任务
+    task_failed += Main_Check_Task(
+        xTaskCreate((TaskFunction_t)Bluetooth_Main_Task,
+                    (const char *)"Bluetooth_Main",
+                    (uint16_t)384,
+                    (void *)NULL,
+                    (UBaseType_t)2,
+                    (TaskHandle_t *)&Bluetooth_handle) != pdPASS,
+        "Bluetooth_Main");
+#endif
+
+    // 创建日志排空任务（此后printf不再忙等串口）
+    task_failed += Main_Check_Task(Log_CreateTask(), "Log");
+
+    // 创建调试串口控制台任务（USART1按行收命令）
+    task_failed += Main_Check_Task(Console_CreateTask(), "Console");
+
+    // 创建传感器数据采集任务
+    task_failed += Main_Check_Task(SensorData_CreateTask(), "SensorData");
+
+    // 空闲任务在vTaskStartScheduler里创建，这里剩下的堆至少要放得下它
+    LOG_I(MAIN, "tasks created, heap %u of %u bytes free\r\n", (unsigned)xPortGetFreeHeapSize(), (unsigned)configTOTAL_HEAP_SIZE);
+    if (task_failed)
     {
-        printf("Index page initialization failed\r\n");
+        LOG_E(MAIN, "%d task(s) not created, check configTOTAL_HEAP_SIZE\r\n", task_failed);
         return -1;
     }
 
-    // ҳΪ˵
-    g_menu_sys.root_menu = index_menu;
-    g_menu_sys.current_menu = index_menu;
-
-    /* ˵ */
-    xTaskCreate((TaskFunction_t)Menu_Main_Task, /*  */
-                (const char *)"Menu_Main",      /*  */
-                (uint16_t)2024,                 /* ջС */
-                (void *)NULL,                   /*  */
-                (UBaseType_t)4,                 /* ȼ */
-                (TaskHandle_t *)&Menu_handle);  /* ƾ */
-    xTaskCreate(Key_Main_Task, "KeyMain", 96, NULL, 4, &Key_handle);
-
-    // ݴ
-    xTaskCreate((TaskFunction_t)Bluetooth_Main_Task,
-                (const char *)"Bluetooth_Main",
-                (uint16_t)384,
-                (void *)NULL,
-                (UBaseType_t)2,
-                (TaskHandle_t *)&Bluetooth_handle);
-
-    printf("------------------\n");
-    printf("creat task OK\n");
-    printf("------------------\n");
-
-    // ݲɼ
-    SensorData_CreateTask();
-    printf("SensorData task created\n");
-
-    // ӡʼ״̬
+    // 打印传感器初始状态
     printf("Initial sensor states: Light=%d\n", Light_ON);
 
-    // // ESP8266
-    // xTaskCreate((TaskFunction_t)ESP8266_Main_Task, /*  */
-    //             (const char *)"ESP8266_Main",      /*  */
-    //             (uint16_t)384,                     /* ջС */
-    //             (void *)NULL,                      /*  */
-    //             (UBaseType_t)2,                    /* ȼ */
-    //             (TaskHandle_t *)&ESP8266_handle);  /*  */
+    // // 创建ESP8266任务
+    // xTaskCreate((TaskFunction_t)ESP8266_Main_Task, /* 任务函数 */
+    //             (const char *)"ESP8266_Main",      /* 任务名称 */
+    //             (uint16_t)384,                     /* 任务堆栈大小 */
+    //             (void *)NULL,                      /* 任务参数 */
+    //             (UBaseType_t)2,                    /* 任务优先级 */
+    //             (TaskHandle_t *)&ESP8266_handle);  /* 任务句柄 */
 
-    // ӵϢȷϵ
+    // 添加调试信息，确认调度器启动
     printf("Starting scheduler...\n");
 
-    /*  */
+    /* 启动调度器 */
     vTaskStartScheduler();
 
-    // ʧܣִе
+    // 如果调度器启动失败，会执行到这里
     printf("ERROR: Scheduler failed to start!\n");
     // LED2_ON();
 }
@@ -151,13 +220,13 @@ int main(void)
 static void Menu_Main_Task(void *pvParameters)
 {
     printf("Menu_Main_Task start ->\n");
-    // ֱӵͳһ˵ܵ
+    // 直接调用统一菜单框架的任务
     menu_task(pvParameters);
 }
 
 static void Key_Main_Task(void *pvParameters)
 {
-    // ֱӵͳһ˵ܵİ
+    // 直接调用统一菜单功能的按键处理
     menu_key_task(pvParameters);
 }
 
@@ -165,26 +234,30 @@ static void Bluetooth_Main_Task(void *pvParameters)
 {
     printf("Bluetooth_Main_Task start ->\n");
 
-    // ѭ
+    // 蓝牙任务主循环
     while (1)
     {
         if (uart3_rx_len > 0)
         {
-            // ӡյ
-            printf("HC-05 Receive Data: %s\r\n----->\n\n", uart3_buffer); 
+            // 打印接收到的数据
+            LOG_I(HC05, "Receive Data: %s\r\n", (const char *)uart3_buffer);
             
-            // 
-            if (HC05_Process_Commands((const char*)uart3_buffer) == HC05_OK)
+            // 网关轮询/命令帧优先，其余按普通蓝牙命令处理
+            if (Gateway_Node_Handle((const char*)uart3_buffer) == GATEWAY_OK)
             {
-                printf("\n<----Command processed successfully\r\n");
+                LOG_D(HC05, "<----Gateway frame processed\r\n");
+            }
+            else if (HC05_Process_Commands((const char*)uart3_buffer) == HC05_OK)
+            {
+                LOG_D(HC05, "<----Command processed successfully\r\n");
             }
             
-            // ջ
+            // 清空缓冲区
             memset(uart3_buffer, 0, UART3_BUF_SIZE);
             uart3_rx_len = 0;
         }
-        
-        // ʱ10ms
+
+        // 延时10ms
         vTaskDelay(pdMS_TO_TICKS(10));
     }
 }
@@ -8,6 +8,7 @@
 #include "unified_menu.h"
 #include "oled_print.h"
 #include "sensordata.h"
+#include "oled_anim.h"
 
 // 声明外部传感器状态变量
 extern uint8_t DHT11_ON;
@@ -21,7 +22,8 @@ extern uint8_t PM25_ON;
 
 typedef struct
 {
-   int16_t last_date_L;
+   uint16_t last_date_L;   // 进度条显示值（追光照值的动画当前值）
+   oled_anim_t bar_anim;   // 进度条动画
    u8 result;
    // 刷新标志
    uint8_t need_refresh; // 需要刷新
@@ -32,29 +34,20 @@ typedef struct
 // 声明静态状态变量，避免动态内存分配
 extern Light_state_t g_light_state;
 
-/**
- * @brief 初始化光照页面
- * @return 创建的光照菜单项指针
- */
-menu_item_t *Light_init(void);
-
 /**
  * @brief 光照自定义绘制函数
  * @param context 绘制上下文
  */
 void Light_draw_function(void *context);
 
-void Light_key_handler(menu_item_t *item, uint8_t key_event);
+void Light_key_handler(const menu_item_t *item, uint8_t key_event);
 
 Light_state_t *Light_get_state(void *context);
 
 void Light_refresh_display(void *context);
 
-void Light_on_enter(menu_item_t *item);
-
-void Light_on_exit(menu_item_t *item);
+void Light_on_enter(const menu_item_t *item);
 
-// 光照进度条（line=1）
-void OLED_DrawLightBar_Line1(uint16_t lux);
+void Light_on_exit(const menu_item_t *item);
 
 #endif
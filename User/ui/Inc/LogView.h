@@ -0,0 +1,27 @@
+#ifndef _LOGVIEW_H_
+#define _LOGVIEW_H_
+
+#include "stm32f10x.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "unified_menu.h"
+#include "oled_term.h"
+
+/**
+ * @brief 初始化日志页面，开始收集文本日志
+ */
+void LogView_init(void);
+
+/**
+ * @brief 日志页面自定义绘制函数
+ * @param context 绘制上下文（未使用）
+ */
+void LogView_draw_function(void *context);
+
+void LogView_key_handler(const menu_item_t *item, uint8_t key_event);
+
+void LogView_on_enter(const menu_item_t *item);
+
+void LogView_on_exit(const menu_item_t *item);
+
+#endif
@@ -26,26 +26,20 @@ typedef struct
 // 声明静态状态变量，避免动态内存分配
 extern ParamSetting_state_t g_paramsetting_state;
 
-/**
- * @brief 初始化参数设置页面
- * @return 创建的参数设置菜单项指针
- */
-menu_item_t *ParamSetting_init(void);
-
 /**
  * @brief 参数设置自定义绘制函数
  * @param context 绘制上下文
  */
 void ParamSetting_draw_function(void *context);
 
-void ParamSetting_key_handler(menu_item_t *item, uint8_t key_event);
+void ParamSetting_key_handler(const menu_item_t *item, uint8_t key_event);
 
 ParamSetting_state_t *ParamSetting_get_state(void *context);
 
 void ParamSetting_refresh_display(void *context);
 
-void ParamSetting_on_enter(menu_item_t *item);
+void ParamSetting_on_enter(const menu_item_t *item);
 
-void ParamSetting_on_exit(menu_item_t *item);
+void ParamSetting_on_exit(const menu_item_t *item);
 
 #endif
@@ -33,8 +33,7 @@ typedef struct {
     
     // 滚动状态
     uint8_t scroll_offset;      // 滚动偏移量(0或64)
-    uint8_t scroll_direction;   // 滚动方向(0=无,1=右,2=左)
-    uint8_t scroll_step;        // 当前滚动步骤(0-8,每次8像素)
+    uint8_t scroll_direction;   // 待播放的切换动画(OLED_SLIDE_NONE/UP/DOWN)
     
     // 刷新标志
     uint8_t need_refresh;       // 需要刷新
@@ -52,10 +51,9 @@ extern index_state_t g_index_state;
 // ==================================
 
 /**
- * @brief 初始化首页
- * @return 创建的首页菜单项指针
+ * @brief 初始化首页状态和RTC（菜单项在菜单树里）
  */
-menu_item_t* index_init(void);
+void index_init(void);
 
 /**
  * @brief 首页自定义绘制函数
@@ -68,7 +66,7 @@ void index_draw_function(void* context);
  * @param item 菜单项
  * @param key_event 按键事件
  */
-void index_key_handler(menu_item_t* item, uint8_t key_event);
+void index_key_handler(const menu_item_t* item, uint8_t key_event);
 
 /**
  * @brief 更新首页时间信息
@@ -90,12 +88,12 @@ void index_refresh_display(void);
  * @brief 首页进入回调
  * @param item 菜单项
  */
-void index_on_enter(menu_item_t* item);
+void index_on_enter(const menu_item_t* item);
 
 /**
  * @brief 首页退出回调
  * @param item 菜单项
  */
-void index_on_exit(menu_item_t* item);
+void index_on_exit(const menu_item_t* item);
 
 #endif // __INDEX_H
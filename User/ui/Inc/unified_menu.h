@@ -19,6 +19,9 @@
 #include <stdio.h>
 #include "beep.h"
 #include "debug.h"
+
+#define MENU_INDEX_NONE 0xFF // 空链接（没有父节点/子项）
+
 // ==================================
 // 菜单类型枚举
 // ==================================
@@ -39,12 +42,12 @@ typedef struct
 {
     void (*draw_function)(void *context); // 自定义绘制函数
     void *draw_context;                   // 绘制上下文数据
-    const unsigned char *icon_data;       // 图标数据
+    const oled_bitmap_t *icon_data;       // 图标数据（32x32压缩位图）
 } menu_custom_t;
 
 typedef union
 {
-    const unsigned char *icon_data; // 图标数据
+    const oled_bitmap_t *icon_data; // 图标数据（32x32压缩位图）
     menu_custom_t custom; // 自定义页面数据
 } menu_content_t;
 
@@ -52,29 +55,27 @@ typedef union
 // 菜单项结构体
 // ==================================
 
+// 菜单项是flash里的常量（菜单树见memory_optimized_menu.h），选中状态另存在RAM
 typedef struct menu_item
 {
     // 基本信息
     const char *name; // 菜单项名称（内部使用）
-    menu_type_t type; // 菜单类型
 
     // 显示内容
     menu_content_t content; // 显示内容（图标或文本）
 
-    // 状态信息
-    uint8_t is_selected; // 是否选中
-
     // 回调函数
-    void (*on_enter)(struct menu_item *item);            // 进入时回调
-    void (*on_exit)(struct menu_item *item);             // 退出时回调
-    void (*on_select)(struct menu_item *item);           // 选中时回调
-    void (*on_key)(struct menu_item *item, uint8_t key); // 按键处理
-
-    // 层次关系
-    struct menu_item *parent;    // 父菜单
-    struct menu_item **children; // 子菜单数组
-    uint8_t child_count;         // 子菜单数量
-    uint8_t selected_child;      // 选中的子项索引
+    void (*on_enter)(const struct menu_item *item);            // 进入时回调
+    void (*on_exit)(const struct menu_item *item);             // 退出时回调
+    void (*on_select)(const struct menu_item *item);           // 选中时回调
+    void (*on_key)(const struct menu_item *item, uint8_t key); // 按键处理
+
+    menu_type_t type; // 菜单类型
+
+    // 层次关系（菜单树节点号，MENU_INDEX_NONE表示没有）
+    uint8_t parent;      // 父菜单
+    uint8_t first_child; // 第一个子项（子项在树里相邻）
+    uint8_t child_count; // 子菜单数量
 } menu_item_t;
 
 // ==================================
@@ -114,8 +115,8 @@ typedef struct
 typedef struct
 {
     // 当前状态
-    menu_item_t *current_menu; // 当前菜单
-    menu_item_t *root_menu;    // 根菜单
+    const menu_item_t *current_menu; // 当前菜单
+    const menu_item_t *root_menu;    // 根菜单
     uint8_t menu_active;       // 菜单激活状态
 
     // 布局配置
@@ -130,6 +131,9 @@ typedef struct
     uint8_t need_refresh;       // 需要刷新标志
     uint32_t last_refresh_time; // 上次刷新时间
     uint8_t blink_state;        // 闪烁状态
+    uint8_t has_deadline;       // 1-页面要求在refresh_deadline前再画一帧（动画、数据轮询）
+    uint32_t refresh_deadline;  // 下一次定时刷新的时刻（tick）
+    volatile uint8_t refresh_pending; // 队列里已有未处理的刷新事件（重复的刷新请求合并）
 
     // FreeRTOS资源
     QueueHandle_t event_queue;       // 事件队列
@@ -171,7 +175,7 @@ typedef struct
 extern menu_system_t g_menu_sys;
 
 // ==================================
-// 菜单创建和管理API
+// 菜单系统初始化API
 // ==================================
 
 /**
@@ -180,54 +184,6 @@ extern menu_system_t g_menu_sys;
  */
 int8_t menu_system_init(void);
 
-/**
- * @brief 创建菜单项
- * @param name 菜单名称
- * @param type 菜单类型
- * @param content 菜单内容
- * @return 创建的菜单项指针，NULL表示失败
- */
-menu_item_t *menu_item_create(const char *name, menu_type_t type, menu_content_t content);
-
-/**
- * @brief 添加子菜单项
- * @param parent 父菜单项
- * @param child 子菜单项
- * @return 0-成功，其他-失败
- */
-int8_t menu_add_child(menu_item_t *parent, menu_item_t *child);
-
-
-/**
- * @brief 设置菜单项回调函数
- * @param item 菜单项
- * @param on_enter 进入回调
- * @param on_exit 退出回调
- * @param on_select 选中回调
- * @param on_key 按键处理回调
- * @return 0-成功，其他-失败
- */
-int8_t menu_item_set_callbacks(menu_item_t *item,
-                               void (*on_enter)(menu_item_t *),
-                               void (*on_exit)(menu_item_t *),
-                               void (*on_select)(menu_item_t *),
-                               void (*on_key)(menu_item_t *, uint8_t));
-
-/**
- * @brief 删除指定的菜单项，并释放内存
- * @param menu 要删除的菜单项指针
- * @return 0-成功，其他-失败
- */
-int8_t menu_item_delete(menu_item_t *menu);
-
-/**
- * @brief 从父菜单中移除指定的子菜单项
- * @param parent 父菜单项
- * @param child 要移除的子菜单项
- * @return 0-成功，其他-失败
- */
-int8_t menu_remove_child(menu_item_t *parent, menu_item_t *child);
-
 // ==================================
 // 菜单显示API
 // ==================================
@@ -241,25 +197,38 @@ void menu_refresh_display(void);
  * @brief 显示横向图标菜单
  * @param menu 菜单项
  */
-void menu_display_horizontal(menu_item_t *menu);
+void menu_display_horizontal(const menu_item_t *menu);
 
 /**
  * @brief 显示竖向列表菜单
  * @param menu 菜单项
  */
-void menu_display_vertical(menu_item_t *menu);
+void menu_display_vertical(const menu_item_t *menu);
 
 /**
  * @brief 显示自定义页面
  * @param menu 菜单项
  */
-void menu_display_custom(menu_item_t *menu);
+void menu_display_custom(const menu_item_t *menu);
 
 /**
  * @brief 清屏并重绘当前菜单
  */
 void menu_clear_and_redraw(void);
 
+/**
+ * @brief 要求在ms毫秒内再画一帧（只在绘制函数里调用，每帧画完后失效，需要时每帧重新设置）
+ * @param ms 最迟多久后刷新，多次调用取最早的
+ * @note 菜单任务没有事件、也没有定时刷新时一直阻塞，不占CPU
+ */
+void menu_schedule_refresh(uint32_t ms);
+
+/**
+ * @brief 请求刷新当前页面（数据变化时由其他任务调用，不能在中断里调用）
+ * @note 队列里已有刷新事件时直接返回，多次请求只画一帧
+ */
+void menu_request_refresh(void);
+
 // ==================================
 // 菜单事件处理API
 // ==================================
@@ -284,7 +253,7 @@ menu_event_t menu_key_to_event(uint8_t key);
  * @param key 按键值
  * @return 0-成功，其他-失败
  */
-int8_t menu_handle_horizontal_key(menu_item_t *menu, uint8_t key);
+int8_t menu_handle_horizontal_key(const menu_item_t *menu, uint8_t key);
 
 /**
  * @brief 处理竖向菜单按键事件
@@ -292,7 +261,7 @@ int8_t menu_handle_horizontal_key(menu_item_t *menu, uint8_t key);
  * @param key 按键值
  * @return 0-成功，其他-失败
  */
-int8_t menu_handle_vertical_key(menu_item_t *menu, uint8_t key);
+int8_t menu_handle_vertical_key(const menu_item_t *menu, uint8_t key);
 
 // ==================================
 // 菜单导航API
@@ -303,7 +272,7 @@ int8_t menu_handle_vertical_key(menu_item_t *menu, uint8_t key);
  * @param menu 目标菜单
  * @return 0-成功，其他-失败
  */
-int8_t menu_enter(menu_item_t *menu);
+int8_t menu_enter(const menu_item_t *menu);
 
 /**
  * @brief 返回父菜单
@@ -345,11 +314,6 @@ void menu_task(void *pvParameters);
  */
 void menu_key_task(void *pvParameters);
 
-// 创建自定义菜单项
-#define MENU_ITEM_CUSTOM(name, draw_func, context) \
-    menu_item_create(name, MENU_TYPE_CUSTOM,       \
-                     (menu_content_t){.custom = {draw_func, context}})
-
 // 常用布局配置预设
 #define LAYOUT_HORIZONTAL_MAIN() { \
     .horizontal = {                \
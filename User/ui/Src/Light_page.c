@@ -1,5 +1,6 @@
 #include "Light_page.h"
 #include "esp8266.h"
+#include "oled_widget.h"
 
 // 定义静态状态变量，避免动态内存分配
 Light_state_t g_light_state = {0};
@@ -10,35 +11,48 @@ static void Light_init_sensor_data(Light_state_t *state);
 static void Light_cleanup_sensor_data(Light_state_t *state);
 static void Light_display_info(void *context);
 
-// 光照进度条（line=1）
-void OLED_DrawLightBar_Line1(uint16_t lux)
-{
-  OLED_Clear_Line(1);
-  // 标签
-  OLED_ShowString(0, 16, (uint8_t *)"0", 12, 1);
-  OLED_ShowString(105, 16, (uint8_t *)"987", 12, 1);
-  // 进度条：x=25, y=18, w=78, h=8, 0~5000 lux
-  OLED_DrawProgressBar(22, 18, 78, 8, lux, 0, 987, 1, 1,1);
-}
+static uint32_t Light_read_lux(void);
+static uint32_t Light_read_bar(void);
+static uint32_t Light_read_level(void);
+static void Light_format_level(char *buf, uint8_t len, uint32_t level);
+static const oled_bitmap_t *Light_pick_icon(uint32_t level);
 
-/**
- * @brief 初始化光照页面
- * @return 创建的光照菜单项指针
- */
-menu_item_t *Light_init(void)
+// ==================================
+// 页面控件：只有光照值或进度条动画值变化时重画对应控件
+// ==================================
+enum
 {
-  // 创建自定义菜单项，不分配具体状态数据
-  menu_item_t *Light_page = MENU_ITEM_CUSTOM("Light", Light_draw_function, NULL);
-  if (Light_page == NULL)
-  {
-    return NULL;
-  }
+  LIGHT_SRC_LUX,   // 当前光照值
+  LIGHT_SRC_BAR,   // 进度条显示值（渐变）
+  LIGHT_SRC_LEVEL  // 光照等级（等级描述和图标只在等级变化时重画）
+};
 
-  menu_item_set_callbacks(Light_page, Light_on_enter, Light_on_exit, NULL, Light_key_handler);
+// 光照等级：上限(lux)与描述，小于200 lux显示月亮图标
+static const uint16_t light_level_max[] = {50, 200, 500, 2000};
+static const char *const light_level_desc[] = {"Dark", "Dim", "Normal", "Bright", "Very Bright"};
+#define LIGHT_LEVEL_NIGHT 2 // 等级小于它显示月亮
 
-  printf("Light_page created successfully\r\n");
-  return Light_page;
-}
+static oled_source_t light_sources[] = {
+    OLED_SOURCE(Light_read_lux),
+    OLED_SOURCE(Light_read_bar),
+    OLED_SOURCE(Light_read_level),
+};
+
+static const oled_widget_t light_widgets[] = {
+    OLED_VALUE(0, 0, 128, 16, 12, LIGHT_SRC_LUX, "Light: %d lux", NULL),
+    // 光照进度条（line=1）：x=22, y=18, w=78, h=8, 0~987 lux
+    OLED_LABEL(0, 16, 22, 16, 12, "0"),
+    OLED_BAR(22, 18, 78, 8, 1, LIGHT_SRC_BAR, 0, 987),
+    OLED_LABEL(105, 16, 23, 16, 12, "987"),
+    // 光照等级描述与图标（line=2~3）
+    OLED_VALUE(0, 32, 96, 16, 12, LIGHT_SRC_LEVEL, NULL, Light_format_level),
+    OLED_ICON(96, 32, 32, 32, LIGHT_SRC_LEVEL, Light_pick_icon),
+};
+
+static oled_widget_state_t light_widget_state[OLED_WIDGET_COUNT(light_widgets)];
+static oled_widget_page_t light_page = OLED_WIDGET_PAGE(light_sources, light_widgets, light_widget_state);
+
+#define LIGHT_BAR_MS 400 // 进度条追到新光照值的时长（与变化幅度无关）
 
 /**
  * @brief 光照自定义绘制函数
@@ -71,7 +85,7 @@ void Light_draw_function(void *context)
  
 }
 
-void Light_key_handler(menu_item_t *item, uint8_t key_event)
+void Light_key_handler(const menu_item_t *item, uint8_t key_event)
 {
   Light_state_t *state = (Light_state_t *)item->content.custom.draw_context;
   if (state == NULL) {
@@ -83,6 +97,7 @@ void Light_key_handler(menu_item_t *item, uint8_t key_event)
   case MENU_EVENT_KEY_UP:
     // KEY0 - 开启光照传感器
     printf("Light: KEY0 pressed\r\n");
+    OLED_Clear();
     Light_ON=1;
     break;
 
@@ -137,7 +152,7 @@ void Light_refresh_display(void *context)
   state->last_update = xTaskGetTickCount();
 }
 
-void Light_on_enter(menu_item_t *item)
+void Light_on_enter(const menu_item_t *item)
 {
   printf("Enter Light page\r\n");
   
@@ -146,15 +161,13 @@ void Light_on_enter(menu_item_t *item)
   
   // 传感器数据已在全局SensorData任务中初始化和读取
   
-  // 设置静态状态到菜单项上下文
-  item->content.custom.draw_context = &g_light_state;
-  
   // 清屏并标记需要刷新
   OLED_Clear();
+  OLED_Widget_Enter(&light_page);
   g_light_state.need_refresh = 1;
 }
 
-void Light_on_exit(menu_item_t *item)
+void Light_on_exit(const menu_item_t *item)
 {
   printf("Exit Light page\r\n");
   
@@ -168,10 +181,8 @@ void Light_on_exit(menu_item_t *item)
   
   printf("Light state cleaned up (no memory free needed)\r\n");
   
-  // 清空指针，防止野指针
-  item->content.custom.draw_context = NULL;
-  
   // 清屏
+  OLED_Widget_Leave();
   OLED_Clear();
 }
 
@@ -214,6 +225,39 @@ static void Light_cleanup_sensor_data(Light_state_t *state)
     printf("Light sensor data cleaned up\r\n");
 }
 
+static uint32_t Light_read_lux(void)
+{
+  return SensorData.light_data.lux;
+}
+
+static uint32_t Light_read_bar(void)
+{
+  return (uint32_t)g_light_state.last_date_L;
+}
+
+static uint32_t Light_read_level(void)
+{
+  uint16_t lux = SensorData.light_data.lux;
+  uint8_t level = 0;
+
+  while (level < sizeof(light_level_max) / sizeof(light_level_max[0]) && lux >= light_level_max[level])
+  {
+    level++;
+  }
+  return level;
+}
+
+static void Light_format_level(char *buf, uint8_t len, uint32_t level)
+{
+  // 光照等级描述
+  snprintf(buf, len, "Level: %s", light_level_desc[level]);
+}
+
+static const oled_bitmap_t *Light_pick_icon(uint32_t level)
+{
+  return (level < LIGHT_LEVEL_NIGHT) ? &gImage_moon : &gImage_sun;
+}
+
 static void Light_display_info(void *context)
 {
   Light_state_t *state = (Light_state_t *)context;
@@ -221,65 +265,11 @@ static void Light_display_info(void *context)
     return;
   }
   
-  OLED_Clear_Line(0);
-  OLED_Printf_Line(0, "Light: %d lux", SensorData.light_data.lux);
-  
-  // 光照等级描述
-  const char* light_desc = "";
-  if (SensorData.light_data.lux < 50) {
-    light_desc = "Dark";
-  } else if (SensorData.light_data.lux < 200) {
-    light_desc = "Dim";
-  } else if (SensorData.light_data.lux < 500) {
-    light_desc = "Normal";
-  } else if (SensorData.light_data.lux < 2000) {
-    light_desc = "Bright";
-  } else {
-    light_desc = "Very Bright";
-  }
-  
-  OLED_Clear_Line(2);
-  OLED_Printf_Line(2, "Level: %s", light_desc);
-  OLED_Clear_Line(3);
-  if (SensorData.light_data.lux < 200)
-  {
-    OLED_ShowPicture(96,32,32,32,gImage_moon,1);
-  }else
-  {
-    OLED_ShowPicture(96,32,32,32,gImage_sun,1);
-  }
-  
-  
-  
-  // 渐进式更新光照显示值，避免突变
-  if (SensorData.light_data.lux > state->last_date_L)
-  {
-    if (SensorData.light_data.lux - state->last_date_L >= 100)
-    {
-      state->last_date_L += 20;
-    }
-    else
-    {
-      state->last_date_L++;
-    }
-  }
-  else if (SensorData.light_data.lux < state->last_date_L)
-  {
-    if (state->last_date_L - SensorData.light_data.lux >= 100)
-    {
-      state->last_date_L -= 20;
-    }
-    else
-    {
-      state->last_date_L--;
-    }
-  }
-  
-  // 确保值不为负
-  if (state->last_date_L < 0) {
-    state->last_date_L = 0;
-  }
-  
-  // 绘制光照进度条
-  OLED_DrawLightBar_Line1(state->last_date_L);
+  // 光照值变了就从当前显示值重新开始追，进度条按时间缓动，与刷新快慢无关；
+  // 动画进行中由菜单按帧率安排下一帧，结束后等传感器任务通知新数据
+  OLED_Anim_Retarget(&state->bar_anim, SensorData.light_data.lux, LIGHT_BAR_MS, OLED_EASE_OUT);
+  state->last_date_L = (uint16_t)OLED_Anim_Value(&state->bar_anim);
+
+  // 只重画数据变了的控件（光照值、等级、图标、进度条）
+  OLED_Widget_Render(&light_page);
 }
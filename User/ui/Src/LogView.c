@@ -0,0 +1,78 @@
+/**
+ * @file LogView.c
+ * @brief 日志页面：现场查看最近的日志，KEY0/KEY1逐行回滚，KEY3回到最新，KEY2返回
+ */
+#include "LogView.h"
+
+#define LOGVIEW_POLL_MS 100 // 查看新日志的间隔
+
+/**
+ * @brief 初始化日志页面（菜单项在菜单树里）
+ */
+void LogView_init(void)
+{
+  // 页面没打开时也收集日志，进入时就有回滚内容
+  OLED_Term_Init();
+}
+
+/**
+ * @brief 日志页面自定义绘制函数：没有新日志时不改显存，不产生总线传输
+ * @param context 绘制上下文（未使用）
+ */
+void LogView_draw_function(void *context)
+{
+  (void)context;
+
+  OLED_Term_Draw();
+  OLED_Refresh_Dirty();
+
+  // 日志可能来自中断，不能通知菜单任务，打开本页面时定时看有没有新行
+  menu_schedule_refresh(LOGVIEW_POLL_MS);
+}
+
+void LogView_key_handler(const menu_item_t *item, uint8_t key_event)
+{
+  (void)item;
+
+  switch (key_event)
+  {
+  case MENU_EVENT_KEY_UP:
+    // KEY0 - 向前翻看一行
+    OLED_Term_Scroll(-1);
+    break;
+
+  case MENU_EVENT_KEY_DOWN:
+    // KEY1 - 向后一行，到最新一屏时恢复跟随
+    OLED_Term_Scroll(1);
+    break;
+
+  case MENU_EVENT_KEY_SELECT:
+    // KEY2 - 返回上一级
+    menu_back_to_parent();
+    break;
+
+  case MENU_EVENT_KEY_ENTER:
+    // KEY3 - 回到最新
+    OLED_Term_Follow();
+    break;
+
+  default:
+    break;
+  }
+}
+
+void LogView_on_enter(const menu_item_t *item)
+{
+  (void)item;
+
+  // 这里不打印：进入页面的日志会立刻出现在终端里，挤掉一行回滚内容
+  OLED_Clear();
+  OLED_Term_Enter();
+}
+
+void LogView_on_exit(const menu_item_t *item)
+{
+  (void)item;
+
+  OLED_Term_Leave();
+}
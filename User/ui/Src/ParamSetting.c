@@ -1,4 +1,5 @@
 #include "ParamSetting.h"
+#include "oled_widget.h"
 
 // 声明外部变量
 extern uint16_t publish_delaytime;
@@ -14,44 +15,46 @@ static void ParamSetting_init_data(ParamSetting_state_t *state);
 static void ParamSetting_cleanup_data(ParamSetting_state_t *state);
 static void ParamSetting_display_info(void *context);
 
-// 发布间隔进度条（line=1）
-void OLED_DrawPublishBar_Line1(uint16_t delay_value)
-{
-  OLED_Clear_Line(1);
-  // 标签
-  OLED_ShowString(0, 16, (uint8_t *)"5", 12, 1);
-  OLED_ShowString(110, 16, (uint8_t *)"60", 12, 1);
-  // 进度条：x=20, y=18, w=88, h=8, 5~60秒
-  OLED_DrawProgressBar(17, 18, 87, 8, delay_value, 5, 60, 1, 1,1);
-}
+static uint32_t ParamSetting_read_all(void);
+static uint32_t ParamSetting_read_selected(void);
+static uint32_t ParamSetting_read_publish(void);
+static uint32_t ParamSetting_read_sensor(void);
+static void ParamSetting_format_delays(char *buf, uint8_t len, uint32_t packed);
+static void ParamSetting_format_title(char *buf, uint8_t len, uint32_t selected);
 
-// 传感器间隔进度条（line=3）
-void OLED_DrawSensorBar_Line3(uint16_t delay_value)
+// ==================================
+// 页面控件：按键改变参数后只重画受影响的文字和进度条
+// ==================================
+enum
 {
-  OLED_Clear_Line(3);
-  OLED_ShowString(0, 48, (uint8_t *)"1", 12, 1);
-  OLED_ShowString(110, 48, (uint8_t *)"10", 12, 1);
-  OLED_DrawProgressBar(17, 52, 87, 8, delay_value, 1, 10, 1, 1,1);
-}
+  PARAM_SRC_ALL,      // 选中项+两个间隔（第0行同时显示）
+  PARAM_SRC_SELECTED, // 选中项
+  PARAM_SRC_PUBLISH,  // 发布间隔
+  PARAM_SRC_SENSOR    // 传感器间隔
+};
 
-/**
- * @brief 初始化参数设置页面
- * @return 创建的参数设置菜单项指针
- */
-menu_item_t *ParamSetting_init(void)
-{
-  // 创建自定义菜单项，不分配具体状态数据
-  menu_item_t *ParamSetting_page = MENU_ITEM_CUSTOM("ParamSetting", ParamSetting_draw_function, NULL);
-  if (ParamSetting_page == NULL)
-  {
-    return NULL;
-  }
+static oled_source_t param_sources[] = {
+    OLED_SOURCE(ParamSetting_read_all),
+    OLED_SOURCE(ParamSetting_read_selected),
+    OLED_SOURCE(ParamSetting_read_publish),
+    OLED_SOURCE(ParamSetting_read_sensor),
+};
 
-  menu_item_set_callbacks(ParamSetting_page, ParamSetting_on_enter, ParamSetting_on_exit, NULL, ParamSetting_key_handler);
+static const oled_widget_t param_widgets[] = {
+    OLED_VALUE(0, 0, 128, 16, 12, PARAM_SRC_ALL, NULL, ParamSetting_format_delays),
+    // 发布间隔进度条（line=1）：x=17, y=18, w=87, h=8, 5~60秒
+    OLED_LABEL(0, 16, 17, 16, 12, "5"),
+    OLED_BAR(17, 18, 87, 8, 1, PARAM_SRC_PUBLISH, 5, 60),
+    OLED_LABEL(110, 16, 18, 16, 12, "60"),
+    OLED_VALUE(0, 32, 128, 16, 12, PARAM_SRC_SELECTED, NULL, ParamSetting_format_title),
+    // 传感器间隔进度条（line=3）：1~10秒
+    OLED_LABEL(0, 48, 17, 16, 12, "1"),
+    OLED_BAR(17, 52, 87, 8, 1, PARAM_SRC_SENSOR, 1, 10),
+    OLED_LABEL(110, 48, 18, 16, 12, "10"),
+};
 
-  printf("ParamSetting_page created successfully\r\n");
-  return ParamSetting_page;
-}
+static oled_widget_state_t param_widget_state[OLED_WIDGET_COUNT(param_widgets)];
+static oled_widget_page_t param_page = OLED_WIDGET_PAGE(param_sources, param_widgets, param_widget_state);
 
 /**
  * @brief 参数设置自定义绘制函数
@@ -70,7 +73,7 @@ void ParamSetting_draw_function(void *context)
   OLED_Refresh_Dirty();
 }
 
-void ParamSetting_key_handler(menu_item_t *item, uint8_t key_event)
+void ParamSetting_key_handler(const menu_item_t *item, uint8_t key_event)
 {
   ParamSetting_state_t *state = (ParamSetting_state_t *)item->content.custom.draw_context;
   if (state == NULL) {
@@ -173,22 +176,20 @@ void ParamSetting_refresh_display(void *context)
   state->last_update = xTaskGetTickCount();
 }
 
-void ParamSetting_on_enter(menu_item_t *item)
+void ParamSetting_on_enter(const menu_item_t *item)
 {
   printf("Enter ParamSetting page\r\n");
   
   // 使用静态分配的状态数据，直接初始化
   ParamSetting_init_data(&g_paramsetting_state);
   
-  // 设置静态状态到菜单项上下文
-  item->content.custom.draw_context = &g_paramsetting_state;
-  
   // 清屏并标记需要刷新
   OLED_Clear();
+  OLED_Widget_Enter(&param_page);
   g_paramsetting_state.need_refresh = 1;
 }
 
-void ParamSetting_on_exit(menu_item_t *item)
+void ParamSetting_on_exit(const menu_item_t *item)
 {
   printf("Exit ParamSetting page\r\n");
   
@@ -202,10 +203,8 @@ void ParamSetting_on_exit(menu_item_t *item)
   
   printf("ParamSetting state cleaned up\r\n");
   
-  // 清空指针，防止野指针
-  item->content.custom.draw_context = NULL;
-  
   // 清屏
+  OLED_Widget_Leave();
   OLED_Clear();
 }
 
@@ -253,6 +252,46 @@ static void ParamSetting_cleanup_data(ParamSetting_state_t *state)
     printf("ParamSetting data cleaned up\r\n");
 }
 
+static uint32_t ParamSetting_read_all(void)
+{
+  return ((uint32_t)g_paramsetting_state.selected_item << 16) |
+         ((uint32_t)(g_paramsetting_state.current_publish_delay & 0xFF) << 8) |
+         (g_paramsetting_state.current_sensor_delay & 0xFF);
+}
+
+static uint32_t ParamSetting_read_selected(void)
+{
+  return g_paramsetting_state.selected_item;
+}
+
+static uint32_t ParamSetting_read_publish(void)
+{
+  return g_paramsetting_state.current_publish_delay;
+}
+
+static uint32_t ParamSetting_read_sensor(void)
+{
+  return g_paramsetting_state.current_sensor_delay;
+}
+
+// 第0行：选中的参数加方括号
+static void ParamSetting_format_delays(char *buf, uint8_t len, uint32_t packed)
+{
+  uint8_t publish = (packed >> 8) & 0xFF;
+  uint8_t sensor = packed & 0xFF;
+
+  if ((packed >> 16) == 0)
+    snprintf(buf, len, "[%2d]s/%2ds", publish, sensor);
+  else
+    snprintf(buf, len, "%2ds/[%2d]s", publish, sensor);
+}
+
+// 第2行：当前设置的参数
+static void ParamSetting_format_title(char *buf, uint8_t len, uint32_t selected)
+{
+  snprintf(buf, len, "%s", selected == 0 ? "  Set Publish Delay" : "  Set Sensor Delay");
+}
+
 static void ParamSetting_display_info(void *context)
 {
   ParamSetting_state_t *state = (ParamSetting_state_t *)context;
@@ -260,28 +299,6 @@ static void ParamSetting_display_info(void *context)
     return;
   }
   
-  // 根据当前选中的项目显示不同的内容
-  switch (state->selected_item)
-  {
-  case 0: // 设置发布间隔
-    OLED_Clear_Line(1);
-    OLED_Printf_Line(0, "[%2d]s/%2ds", state->current_publish_delay, state->current_sensor_delay);
-    OLED_Clear_Line(2);
-    OLED_Printf_Line(2, "  Set Publish Delay");
-    break;
-  case 1: // 设置传感器间隔
-    OLED_Clear_Line(1);
-    OLED_Printf_Line(0, "%2ds/[%2d]s", state->current_publish_delay, state->current_sensor_delay);
-    OLED_Clear_Line(2);
-    OLED_Printf_Line(2, "  Set Sensor Delay");
-    break;
-  }
-  
-  // 显示操作提示
-  OLED_Printf_Line(3, "KEY0:+ KEY1:- KEY2:OK");
-  OLED_Printf_Line(4, "KEY3:Switch");
-  
-  // 显示进度条
-  OLED_DrawPublishBar_Line1(state->current_publish_delay);
-  OLED_DrawSensorBar_Line3(state->current_sensor_delay);
+  // 只重画参数变了的文字和进度条
+  OLED_Widget_Render(&param_page);
 }
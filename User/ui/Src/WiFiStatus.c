@@ -1,6 +1,7 @@
 #include "WiFiStatus.h"
 #include "esp8266.h"
 #include "rtc_date.h"
+#include "oled_widget.h"
 
 // 声明外部变量
 extern uint8_t wifi_connected;
@@ -15,26 +16,42 @@ WiFiStatus_state_t g_wifistatus_state = {0};
 static void WiFiStatus_init_state(WiFiStatus_state_t *state);
 static void WiFiStatus_cleanup_state(WiFiStatus_state_t *state);
 static void WiFiStatus_display_info(void *context);
-static uint8_t WiFiStatus_sync_time(void);
+static void WiFiStatus_sync_time(void);
+static uint32_t WiFiStatus_read_wifi(void);
+static uint32_t WiFiStatus_read_server(void);
+static uint32_t WiFiStatus_read_time(void);
+static void WiFiStatus_format_wifi(char *buf, uint8_t len, uint32_t connected);
+static void WiFiStatus_format_server(char *buf, uint8_t len, uint32_t connected);
+static void WiFiStatus_format_time_state(char *buf, uint8_t len, uint32_t value);
+static void WiFiStatus_format_time_value(char *buf, uint8_t len, uint32_t value);
 
-/**
- * @brief 初始化WiFi状态页面
- * @return 创建的WiFi状态菜单项指针
- */
-menu_item_t *WiFiStatus_init(void)
+// ==================================
+// 页面控件：连接状态、对时进度变化时才重画
+// ==================================
+enum
 {
-  // 创建自定义菜单项，不分配具体状态数据
-  menu_item_t *WiFiStatus_page = MENU_ITEM_CUSTOM("WiFi Status", WiFiStatus_draw_function, NULL);
-  if (WiFiStatus_page == NULL)
-  {
-    return NULL;
-  }
+  WIFI_SRC_WIFI,   // WiFi连接状态
+  WIFI_SRC_SERVER, // 服务器连接状态
+  WIFI_SRC_TIME    // 对时进度（ESP8266任务执行，见esp8266_time_sync）
+};
 
-  menu_item_set_callbacks(WiFiStatus_page, WiFiStatus_on_enter, WiFiStatus_on_exit, NULL, WiFiStatus_key_handler);
+static oled_source_t wifistatus_sources[] = {
+    OLED_SOURCE(WiFiStatus_read_wifi),
+    OLED_SOURCE(WiFiStatus_read_server),
+    OLED_SOURCE(WiFiStatus_read_time),
+};
 
-  printf("WiFiStatus_page created successfully\r\n");
-  return WiFiStatus_page;
-}
+static const oled_widget_t wifistatus_widgets[] = {
+    OLED_VALUE(0, 0, 128, 16, 12, WIFI_SRC_TIME, NULL, WiFiStatus_format_time_state),
+    OLED_VALUE(0, 16, 128, 16, 12, WIFI_SRC_TIME, NULL, WiFiStatus_format_time_value),
+    OLED_VALUE(0, 32, 128, 16, 12, WIFI_SRC_WIFI, NULL, WiFiStatus_format_wifi),
+    OLED_VALUE(0, 48, 128, 16, 12, WIFI_SRC_SERVER, NULL, WiFiStatus_format_server),
+};
+
+static oled_widget_state_t wifistatus_widget_state[OLED_WIDGET_COUNT(wifistatus_widgets)];
+static oled_widget_page_t wifistatus_page = OLED_WIDGET_PAGE(wifistatus_sources, wifistatus_widgets, wifistatus_widget_state);
+
+#define WIFISTATUS_POLL_MS 500 // 连接状态没有变化通知，隔这么久看一次
 
 /**
  * @brief WiFi状态自定义绘制函数
@@ -55,9 +72,10 @@ void WiFiStatus_draw_function(void *context)
   WiFiStatus_display_info(state);
 
   OLED_Refresh_Dirty();
+  menu_schedule_refresh(WIFISTATUS_POLL_MS);
 }
 
-void WiFiStatus_key_handler(menu_item_t *item, uint8_t key_event)
+void WiFiStatus_key_handler(const menu_item_t *item, uint8_t key_event)
 {
   WiFiStatus_state_t *state = (WiFiStatus_state_t *)item->content.custom.draw_context;
   if (state == NULL) {
@@ -125,29 +143,27 @@ void WiFiStatus_refresh_display(void *context)
   state->last_update = xTaskGetTickCount();
 }
 
-void WiFiStatus_on_enter(menu_item_t *item)
+void WiFiStatus_on_enter(const menu_item_t *item)
 {
   printf("Enter WiFiStatus page\r\n");
   
   // 使用静态分配的状态数据，直接初始化
   WiFiStatus_init_state(&g_wifistatus_state);
   
-  // 设置静态状态到菜单项上下文
-  item->content.custom.draw_context = &g_wifistatus_state;
-  
   // 清屏并标记需要刷新
   OLED_Clear();
+  OLED_Widget_Enter(&wifistatus_page);
   g_wifistatus_state.need_refresh = 1;
   
-  // 如果WiFi和服务器已连接，尝试同步时间
+  // 如果WiFi和服务器已连接，请求同步时间
   if (g_wifistatus_state.wifi_status && g_wifistatus_state.server_status && 
       !g_wifistatus_state.time_sync_attempted) {
-    printf("WiFi and Server connected, attempting time sync...\r\n");
+    printf("WiFi and Server connected, requesting time sync...\r\n");
     WiFiStatus_sync_time();
   }
 }
 
-void WiFiStatus_on_exit(menu_item_t *item)
+void WiFiStatus_on_exit(const menu_item_t *item)
 {
   printf("Exit WiFiStatus page\r\n");
   
@@ -161,10 +177,8 @@ void WiFiStatus_on_exit(menu_item_t *item)
   
   printf("WiFiStatus state cleaned up (no memory free needed)\r\n");
   
-  // 清空指针，防止野指针
-  item->content.custom.draw_context = NULL;
-  
   // 清屏
+  OLED_Widget_Leave();
   OLED_Clear();
 }
 
@@ -188,11 +202,9 @@ static void WiFiStatus_init_state(WiFiStatus_state_t *state)
     // 初始化状态
     state->wifi_status = wifi_connected;
     state->server_status = Server_connected;
-    state->time_sync_status = 0;
     state->time_sync_attempted = 0;
     state->need_refresh = 1;
     state->last_update = xTaskGetTickCount();
-    state->last_time_sync = 0;
     
     printf("WiFiStatus state initialized\r\n");
 }
@@ -215,96 +227,98 @@ static void WiFiStatus_cleanup_state(WiFiStatus_state_t *state)
 // ==================================
 
 /**
- * @brief 同步时间函数
- * @return 1-成功，0-失败
+ * @brief 请求ESP8266任务同步时间（查询网络时间会阻塞数秒，不在菜单任务里做），
+ *        进度由第0~1行的控件显示
  */
-static uint8_t WiFiStatus_sync_time(void)
+static void WiFiStatus_sync_time(void)
 {
     WiFiStatus_state_t *state = &g_wifistatus_state;
-    
+
     // 标记已尝试同步
     state->time_sync_attempted = 1;
-    state->time_sync_status = 0;
-    
+
     // 检查连接状态
     if (!state->wifi_status || !state->server_status) {
         printf("WiFiStatus: Cannot sync time - WiFi or Server not connected\r\n");
-        return 0;
-    }
-    
-    // ====================== 获取时间（带重试） ======================
-    uint8_t retry_count = 0;
-    uint8_t max_retries = 3;
-    uint8_t get_time_success = 0;
-    
-    printf("WiFiStatus: Starting time sync...\r\n");
-    
-    while (!get_time_success && retry_count < max_retries)
-    {
-        retry_count++;
-        printf("WiFiStatus: Get Time attempt %d/%d\r\n", retry_count, max_retries);
-        OLED_Printf_Line(0, " Get Time attempt %d/%d", retry_count, max_retries);
-        OLED_Printf_Line(1, " getting ...");
-        if (ESP8266_TCP_GetTime("1", state->time_buffer, sizeof(state->time_buffer)) == 1)
-        {
-            printf("WiFiStatus: ESP8266 Get Time Success: %s\r\n", state->time_buffer);
-            OLED_Printf_Line(0, " Get Time Success");
-                OLED_Printf_Line(1, " %s", state->time_buffer);
-            get_time_success = 1;
-        }
-        else
-        {
-            printf("WiFiStatus: ESP8266 Get Time Error, attempt %d/%d\r\n", retry_count, max_retries);
-            if (retry_count < max_retries)
-            {
-                // 等待5秒后重试
-                vTaskDelay(pdMS_TO_TICKS(5000));
-            }
-        }
-    }
-
-    if (!get_time_success)
-    {
-        printf("WiFiStatus: Get Time failed after %d attempts, entering retry loop\r\n", max_retries);
-
-        // 进入无限重试循环
-        while (!get_time_success)
-        {
-            vTaskDelay(pdMS_TO_TICKS(30000)); // 每30秒重试一次
-            printf("WiFiStatus: Retrying Get Time...\r\n");
-            if (ESP8266_TCP_GetTime("1", state->time_buffer, sizeof(state->time_buffer)) == 1)
-            {
-                
-                printf("WiFiStatus: ESP8266 after retry: %s\r\n", state->time_buffer);
-                
-                get_time_success = 1;
-            }
-        }
+        return;
     }
 
-    // 同步到RTC
-    if (RTC_SetFromNetworkTime(state->time_buffer) != 1)
-    {
-       
-        OLED_Printf_Line(0," RTC Sync Failed");
-        printf("WiFiStatus: RTC Sync Failed\r\n");
-        state->time_sync_status = 0;
-        return 0;
-    }
-    else
-    {
-        OLED_Printf_Line(0," RTC Sync Success");
-        printf("WiFiStatus: RTC Sync Success\r\n");
-        state->time_sync_status = 1;
-        state->last_time_sync = xTaskGetTickCount();
-        return 1;
+    if (!ESP8266_Request_Time_Sync()) {
+        printf("WiFiStatus: Cannot sync time - ESP8266 task not running\r\n");
+        return;
     }
+    printf("WiFiStatus: Time sync requested\r\n");
 }
 
 // ==================================
 // 显示信息函数
 // ==================================
 
+static uint32_t WiFiStatus_read_wifi(void)
+{
+  return g_wifistatus_state.wifi_status;
+}
+
+static uint32_t WiFiStatus_read_server(void)
+{
+  return g_wifistatus_state.server_status;
+}
+
+// 对时状态和尝试次数打包成一个值，任一变化都重画第0~1行
+static uint32_t WiFiStatus_read_time(void)
+{
+  return ((uint32_t)esp8266_time_sync.state << 8) | esp8266_time_sync.attempt;
+}
+
+static void WiFiStatus_format_time_state(char *buf, uint8_t len, uint32_t value)
+{
+  switch (value >> 8)
+  {
+  case ESP8266_TIME_BUSY:
+    snprintf(buf, len, " Get Time attempt %d/%d", (int)(value & 0xFF), ESP8266_TIME_RETRIES);
+    break;
+  case ESP8266_TIME_OK:
+    snprintf(buf, len, " RTC Sync Success");
+    break;
+  case ESP8266_TIME_FAILED:
+    snprintf(buf, len, " Get Time Failed");
+    break;
+  case ESP8266_TIME_RTC_FAILED:
+    snprintf(buf, len, " RTC Sync Failed");
+    break;
+  default:
+    buf[0] = '\0';
+    break;
+  }
+}
+
+static void WiFiStatus_format_time_value(char *buf, uint8_t len, uint32_t value)
+{
+  switch (value >> 8)
+  {
+  case ESP8266_TIME_BUSY:
+    snprintf(buf, len, " getting ...");
+    break;
+  case ESP8266_TIME_OK:
+  case ESP8266_TIME_RTC_FAILED:
+    snprintf(buf, len, " %s", esp8266_time_sync.time);
+    break;
+  default:
+    buf[0] = '\0';
+    break;
+  }
+}
+
+static void WiFiStatus_format_wifi(char *buf, uint8_t len, uint32_t connected)
+{
+  snprintf(buf, len, "WiFi: %s", connected ? "Connected" : "Disconnected");
+}
+
+static void WiFiStatus_format_server(char *buf, uint8_t len, uint32_t connected)
+{
+  snprintf(buf, len, "Server: %s", connected ? "Connected" : "Disconnected");
+}
+
 static void WiFiStatus_display_info(void *context)
 {
   WiFiStatus_state_t *state = (WiFiStatus_state_t *)context;
@@ -312,27 +326,6 @@ static void WiFiStatus_display_info(void *context)
     return;
   }
   
- 
-  
-  // 显示WiFi连接状态
-  OLED_Printf_Line(2, "WiFi: %s", state->wifi_status ? "Connected" : "Disconnected");
-  
-  // 显示服务器连接状态
-  OLED_Printf_Line(3, "Server: %s", state->server_status ? "Connected" : "Disconnected");
-  
-  // 显示时间同步状态
-  if (state->time_sync_attempted) {
-    OLED_Printf_Line(4, "Time Sync: %s", state->time_sync_status ? "Success" : "Failed");
-  } else {
-    OLED_Printf_Line(4, "Time Sync: Not Attempted");
-  }
-  
-  // 显示时间信息
-  if (state->time_sync_status && strlen(state->time_buffer) > 0) {
-    OLED_Printf_Line(5, "Time: %s", state->time_buffer);
-  }
-  
-  // 显示操作提示
-  OLED_Printf_Line(6, "KEY0: Sync KEY1: Refresh");
-  OLED_Printf_Line(7, "KEY2: Back");
+  // 第0~1行对时进度，第2~3行WiFi/服务器连接状态，状态没变时不重画
+  OLED_Widget_Render(&wifistatus_page);
 }
@@ -12,58 +12,135 @@
 #include "simple_pedometer.h"
 #include "light.h"
 #include "esp8266.h"
+#include "oled_widget.h"
 // ==================================
 // 全局变量定义
 // ==================================
 
 index_state_t g_index_state = {0};
 
+// ==================================
+// 页面控件：时间、连接状态、光照各自绑定数据源，只重画变了的部分
+// ==================================
+
+#define INDEX_LIGHT_OK  0 // 光照数据源高16位：传感器状态，低16位：lux
+#define INDEX_LIGHT_ERR 1
+#define INDEX_LIGHT_OFF 2
+
+static uint32_t index_read_date(void);
+static uint32_t index_read_time(void);
+static uint32_t index_read_seconds(void);
+static uint32_t index_read_wifi(void);
+static uint32_t index_read_server(void);
+static uint32_t index_read_light_state(void);
+static uint32_t index_read_light(void);
+static void index_format_date(char *buf, uint8_t len, uint32_t packed);
+static void index_format_time(char *buf, uint8_t len, uint32_t packed);
+static void index_format_wifi(char *buf, uint8_t len, uint32_t connected);
+static void index_format_server(char *buf, uint8_t len, uint32_t connected);
+static void index_format_light(char *buf, uint8_t len, uint32_t packed);
+static const oled_bitmap_t *index_pick_wifi_icon(uint32_t connected);
+static const oled_bitmap_t *index_pick_light_icon(uint32_t light_state);
+
+enum
+{
+    INDEX_SRC_DATE,
+    INDEX_SRC_TIME,
+    INDEX_SRC_SECONDS,
+    INDEX_SRC_WIFI,
+    INDEX_SRC_SERVER,
+    INDEX_SRC_LIGHT_STATE, // 只有传感器状态（图标用，lux变化不重画图标）
+    INDEX_SRC_LIGHT
+};
+
+// 两种排布各一组控件，按滚动偏移显示其中一组
+enum
+{
+    // 偏移0：左边文字列，右边光照值
+    INDEX_W_DATE,
+    INDEX_W_TIME,
+    INDEX_W_WIFI,
+    INDEX_W_SERVER,
+    INDEX_W_SECONDS,    // 秒进度条
+    INDEX_W_LIGHT,
+    // 偏移64：左边图标，右边文字列
+    INDEX_W_WIFI_ICON,
+    INDEX_W_LIGHT_ICON,
+    INDEX_W_DATE_R,
+    INDEX_W_TIME_R,
+    INDEX_W_WIFI_R,
+    INDEX_W_SERVER_R,
+    INDEX_W_SECONDS_R,
+    INDEX_W_COUNT
+};
+
+static oled_source_t index_sources[] = {
+    OLED_SOURCE(index_read_date),
+    OLED_SOURCE(index_read_time),
+    OLED_SOURCE(index_read_seconds),
+    OLED_SOURCE(index_read_wifi),
+    OLED_SOURCE(index_read_server),
+    OLED_SOURCE(index_read_light_state),
+    OLED_SOURCE(index_read_light),
+};
+
+static const oled_widget_t index_widgets[INDEX_W_COUNT] = {
+    OLED_VALUE(0, 0, 60, 16, 12, INDEX_SRC_DATE, NULL, index_format_date),
+    OLED_VALUE(0, 16, 60, 16, 12, INDEX_SRC_TIME, NULL, index_format_time),
+    OLED_VALUE(0, 32, 60, 16, 12, INDEX_SRC_WIFI, NULL, index_format_wifi),
+    OLED_VALUE(0, 48, 60, 16, 12, INDEX_SRC_SERVER, NULL, index_format_server),
+    OLED_BAR(60, 0, 2, 64, 0, INDEX_SRC_SECONDS, 0, 60),
+    OLED_VALUE(64, 32, 64, 16, 12, INDEX_SRC_LIGHT, NULL, index_format_light),
+
+    OLED_ICON(0, 0, 32, 32, INDEX_SRC_WIFI, index_pick_wifi_icon),
+    OLED_ICON(32, 0, 32, 32, INDEX_SRC_LIGHT_STATE, index_pick_light_icon),
+    OLED_VALUE(64, 0, 60, 16, 12, INDEX_SRC_DATE, NULL, index_format_date),
+    OLED_VALUE(64, 16, 60, 16, 12, INDEX_SRC_TIME, NULL, index_format_time),
+    OLED_VALUE(64, 32, 60, 16, 12, INDEX_SRC_WIFI, NULL, index_format_wifi),
+    OLED_VALUE(64, 48, 60, 16, 12, INDEX_SRC_SERVER, NULL, index_format_server),
+    OLED_BAR(124, 0, 2, 64, 0, INDEX_SRC_SECONDS, 0, 60),
+};
+
+static oled_widget_state_t index_widget_state[INDEX_W_COUNT];
+static oled_widget_page_t index_page = OLED_WIDGET_PAGE(index_sources, index_widgets, index_widget_state);
+static uint8_t index_layout_offset = 0xFF; // 控件当前按哪个偏移排布，0xFF表示还没排布
+
+#define INDEX_POLL_MS       500 // 连接状态/光照没有变化通知，最多隔这么久看一次
+#define INDEX_SECOND_MARGIN 5   // 算出的秒跳变时刻之后多等一点，避免早到
+#define INDEX_RETRY_MS      20  // 到了预计时刻秒还没变时的重试间隔
+
+static uint8_t index_last_second = 0xFF; // 上次看到的秒
+static TickType_t index_second_tick = 0; // 看到秒变化时的tick，用来预计下一次跳变
+
 // ==================================
 // 静态函数声明
 // ==================================
 
-static void index_display_time_info(void);
-static void index_display_status_info(void);
+static void index_apply_layout(uint8_t x_offset);
 static void index_update_scroll(void);
+static void index_schedule_next(void);
 static void index_scroll_to_offset(uint8_t target_offset);
 
 // ==================================
 // 首页实现
 // ==================================
 
-menu_item_t *index_init(void)
+void index_init(void)
 {
     // 初始化首页状态
     memset(&g_index_state, 0, sizeof(index_state_t));
     g_index_state.need_refresh = 1;
     g_index_state.last_update = xTaskGetTickCount();
     g_index_state.scroll_offset = 64;
-    g_index_state.scroll_direction = 0;
-    g_index_state.scroll_step = 0;
+    g_index_state.scroll_direction = OLED_SLIDE_NONE;
+
+    // 首页是开机时的当前页面（不经过on_enter）
+    OLED_Widget_Enter(&index_page);
 
     // 初始化RTC
     MyRTC_Init();
 
-    // 创建首页菜单项
-    menu_item_t *index_menu = MENU_ITEM_CUSTOM("Index", index_draw_function, &g_index_state);
-    if (index_menu == NULL)
-    {
-        return NULL;
-    }
-
-    // 设置回调函数
-    menu_item_set_callbacks(index_menu, index_on_enter, index_on_exit, NULL, index_key_handler);
-
-    // 创建并添加主菜单作为子菜单
-    menu_item_t *main_menu = main_menu_init();
-    if (main_menu != NULL)
-    {
-        menu_add_child(index_menu, main_menu);
-    }
-
     printf("Index page initialized successfully\r\n");
-
-    return index_menu;
 }
 
 void index_draw_function(void *context)
@@ -77,19 +154,25 @@ void index_draw_function(void *context)
     // 更新时间信息
     index_update_time();
 
-    // 更新滚动状态
+    // 有待播放的切换动画时清屏，本帧画新画面
     index_update_scroll();
 
-    // 显示时间信息
-    index_display_time_info();
+    // 按当前偏移排布控件
+    if (index_layout_offset != state->scroll_offset)
+    {
+        index_apply_layout(state->scroll_offset);
+    }
+
+    // 只重画数据变了的控件（时间每秒、状态变化时）
+    OLED_Widget_Render(&index_page);
 
-    // 显示状态信息
-    index_display_status_info();
+    // 下一帧：秒跳变时，或者轮询连接状态时
+    index_schedule_next();
 
-    OLED_Refresh(); // 改为全屏刷新，确保内容正确显示
+    OLED_Refresh_Dirty(); // 只发送本帧变化的列区间
 }
 
-void index_key_handler(menu_item_t *item, uint8_t key_event)
+void index_key_handler(const menu_item_t *item, uint8_t key_event)
 {
     index_state_t *state = (index_state_t *)item->content.custom.draw_context;
 
@@ -102,8 +185,8 @@ void index_key_handler(menu_item_t *item, uint8_t key_event)
         break;
 
     case MENU_EVENT_KEY_DOWN:
-        // KEY1 - 向右滚动64像素
-        printf("Index: KEY1 pressed - Scroll right 64 pixels\r\n");
+        // KEY1 - 切换到偏移64像素的画面
+        printf("Index: KEY1 pressed - Scroll to offset 64\r\n");
         index_scroll_to_offset(64);
         break;
 
@@ -159,20 +242,21 @@ void index_refresh_display(void)
     g_index_state.last_update = xTaskGetTickCount();
 }
 
-void index_on_enter(menu_item_t *item)
+void index_on_enter(const menu_item_t *item)
 {
     printf("Enter index page\r\n");
     // 初始化滚动状态
     g_index_state.scroll_offset = 0;
-    g_index_state.scroll_direction = 0;
-    g_index_state.scroll_step = 0;
+    g_index_state.scroll_direction = OLED_SLIDE_NONE;
     OLED_Clear();
+    OLED_Widget_Enter(&index_page);
     g_index_state.need_refresh = 1;
 }
 
-void index_on_exit(menu_item_t *item)
+void index_on_exit(const menu_item_t *item)
 {
     printf("Exit index page\r\n");
+    OLED_Widget_Leave();
     OLED_Clear();
 }
 
@@ -181,50 +265,18 @@ void index_on_exit(menu_item_t *item)
 // ==================================
 
 /**
- * @brief 更新滚动状态
+ * @brief 播放切换动画：清屏后本帧按新偏移重画，提交时由显示控制器整屏滚动切换，
+ *        旧画面不重发，每步只写入卷进来的一页
  */
 static void index_update_scroll(void)
 {
     index_state_t *state = &g_index_state;
 
-    // 如果正在滚动，逐步更新
-    if (state->scroll_direction != 0 && state->scroll_step < 8)
+    if (state->scroll_direction != OLED_SLIDE_NONE)
     {
-        state->scroll_step++;
-
-        OLED_Clear_Rect(0, 0, state->scroll_offset + 8, 64);
-        // 根据方向更新偏移量，每次8像素
-        if (state->scroll_direction == 1) // 向右
-        {
-            state->scroll_offset = (state->scroll_step * 8);
-        }
-        else if (state->scroll_direction == 2) // 向左
-        {
-            state->scroll_offset = 64 - (state->scroll_step * 8);
-        }
-        index_refresh_display();
-        // 调试信息
-        // printf("Scroll step %d, direction %d, offset %d\r\n",
-        //        state->scroll_step, state->scroll_direction, state->scroll_offset);
-
-        state->need_refresh = 1;
-
-        // 滚动完成
-        if (state->scroll_step >= 8)
-        {
-            if (state->scroll_direction == 1)
-            {
-                state->scroll_offset = 64;
-            }
-            else if (state->scroll_direction == 2)
-            {
-                state->scroll_offset = 0;
-            }
-            state->scroll_direction = 0;
-            // 任何滚动完成后都强制清屏，确保内容正确显示
-            // OLED_Clear();
-            // printf("Scroll completed, final offset: %d\r\n", state->scroll_offset);
-        }
+        OLED_Clear();
+        OLED_Slide(state->scroll_direction);
+        state->scroll_direction = OLED_SLIDE_NONE;
     }
 }
 
@@ -243,94 +295,160 @@ static void index_scroll_to_offset(uint8_t target_offset)
         return;
     }
 
-    // 设置滚动方向和步骤
+    // 新画面从按键方向推入：偏移变大（KEY1）时旧画面上移，变小（KEY0）时下移
     if (target_offset > state->scroll_offset)
     {
-        state->scroll_direction = 1; // 向右
-        printf("Starting scroll right from %d to %d\r\n", state->scroll_offset, target_offset);
+        state->scroll_direction = OLED_SLIDE_UP;
+        printf("Starting slide up from %d to %d\r\n", state->scroll_offset, target_offset);
     }
     else
     {
-        state->scroll_direction = 2; // 向左
-        printf("Starting scroll left from %d to %d\r\n", state->scroll_offset, target_offset);
+        state->scroll_direction = OLED_SLIDE_DOWN;
+        printf("Starting slide down from %d to %d\r\n", state->scroll_offset, target_offset);
     }
 
-    state->scroll_step = 0;
+    state->scroll_offset = target_offset;
     state->need_refresh = 1;
 }
 
-static void index_display_time_info(void)
+/**
+ * @brief 按滚动偏移排布控件：偏移64时左边显示图标，偏移0时右边显示光照值
+ * @param x_offset 偏移量(0或64)
+ */
+static void index_apply_layout(uint8_t x_offset)
 {
-    index_state_t *state = &g_index_state;
-    uint8_t x_offset = state->scroll_offset; // 获取当前滚动偏移
+    uint8_t i;
+    uint8_t right = (x_offset == 64);
 
-    if (x_offset == 64)
+    // 只显示当前偏移那一组
+    for (i = 0; i < INDEX_W_COUNT; i++)
     {
+        index_widget_state[i].flags = ((i >= INDEX_W_WIFI_ICON) == right) ? 0 : OLED_WIDGET_HIDDEN;
+    }
+
+    // 切换偏移时已清屏，全部重画
+    OLED_Widget_Invalidate(&index_page);
+    index_layout_offset = x_offset;
+}
+
+/**
+ * @brief 安排下一帧：对准RTC秒跳变的时刻，不再每50ms读一次RTC重画
+ */
+static void index_schedule_next(void)
+{
+    TickType_t now = xTaskGetTickCount();
+    TickType_t since;
+    uint32_t wait;
 
-        // 在页面左边64像素位置放图标
-        if (wifi_connected)
-        {
-            OLED_ShowPicture(-64 + x_offset, 0, 32, 32, gImage_wifi, 1);
-        }
-        else
-        {
-            OLED_Clear_Rect(0, 0, 32, 32);
-        }
-
-        if (Light_ON && !Light_ERR)
-        {
-            OLED_ShowPicture(-32 + x_offset, 0, 32, 32, gImage_lightQD, 1);
-        }
-        else
-        {
-            OLED_Clear_Rect(32, 0, 62, 32);
-        }
-        
-
-        OLED_Refresh_Dirty();
+    if (g_index_state.seconds != index_last_second)
+    {
+        index_last_second = g_index_state.seconds;
+        index_second_tick = now;
     }
 
-    OLED_Printf(x_offset, 0, "%02d/%02d/%02d",
-                g_index_state.year,
-                g_index_state.month,
-                g_index_state.day);
+    since = now - index_second_tick;
+    if (since + pdMS_TO_TICKS(INDEX_SECOND_MARGIN) < pdMS_TO_TICKS(1000))
+    {
+        wait = (pdMS_TO_TICKS(1000) + pdMS_TO_TICKS(INDEX_SECOND_MARGIN) - since) * portTICK_PERIOD_MS;
+    }
+    else
+    {
+        wait = INDEX_RETRY_MS; // 已过预计时刻，秒还没变（RTC与tick有偏差）
+    }
+    if (wait > INDEX_POLL_MS)
+    {
+        wait = INDEX_POLL_MS;
+    }
+    menu_schedule_refresh(wait);
+}
 
-    OLED_Printf(x_offset, 16, " %02d:%02d:%02d",
-                g_index_state.hours,
-                g_index_state.minutes,
-                g_index_state.seconds
+static uint32_t index_read_date(void)
+{
+    return ((uint32_t)g_index_state.year << 16) | ((uint32_t)g_index_state.month << 8) | g_index_state.day;
+}
 
-    );
+static uint32_t index_read_time(void)
+{
+    return ((uint32_t)g_index_state.hours << 16) | ((uint32_t)g_index_state.minutes << 8) | g_index_state.seconds;
+}
+
+static uint32_t index_read_seconds(void)
+{
+    return g_index_state.seconds;
+}
 
-    OLED_Printf(x_offset, 32, " wifi:%s   ",
+static uint32_t index_read_wifi(void)
+{
+    return wifi_connected;
+}
 
-                wifi_connected ? "OK" : "NO");
+static uint32_t index_read_server(void)
+{
+    return Server_connected;
+}
 
-    OLED_Printf(x_offset, 48, "Server:%s ",
-                Server_connected ? "OK" : "NO");
+static uint32_t index_read_light_state(void)
+{
+    if (Light_ERR)
+    {
+        return INDEX_LIGHT_ERR;
+    }
+    return Light_ON ? INDEX_LIGHT_OK : INDEX_LIGHT_OFF;
+}
 
-    // 应用滚动偏移显示内容
+static uint32_t index_read_light(void)
+{
+    uint32_t light_state = index_read_light_state();
 
-    if (x_offset == 0)
+    if (light_state != INDEX_LIGHT_OK)
     {
-        // light
-        if (Light_ON && !Light_ERR)
-        {
-            OLED_Printf(64, 32, " L : %2d ",
-
-                        SensorData.light_data.lux);
-        }
-        else
-        {
-            OLED_Printf(64, 32, " L : %s ", Light_ERR ? "ERR" : "OFF");
-        }
+        return light_state << 16;
     }
+    return SensorData.light_data.lux;
 }
-static void index_display_status_info(void)
+
+static void index_format_date(char *buf, uint8_t len, uint32_t packed)
 {
-    index_state_t *state = &g_index_state;
-    uint8_t x_offset = state->scroll_offset; // 获取当前滚动偏移
+    snprintf(buf, len, "%02d/%02d/%02d", (int)(packed >> 16), (int)((packed >> 8) & 0xFF), (int)(packed & 0xFF));
+}
+
+static void index_format_time(char *buf, uint8_t len, uint32_t packed)
+{
+    snprintf(buf, len, " %02d:%02d:%02d", (int)(packed >> 16), (int)((packed >> 8) & 0xFF), (int)(packed & 0xFF));
+}
+
+static void index_format_wifi(char *buf, uint8_t len, uint32_t connected)
+{
+    snprintf(buf, len, " wifi:%s   ", connected ? "OK" : "NO");
+}
+
+static void index_format_server(char *buf, uint8_t len, uint32_t connected)
+{
+    snprintf(buf, len, "Server:%s ", connected ? "OK" : "NO");
+}
+
+static void index_format_light(char *buf, uint8_t len, uint32_t packed)
+{
+    switch (packed >> 16)
+    {
+    case INDEX_LIGHT_OK:
+        snprintf(buf, len, " L : %2d ", (int)(packed & 0xFFFF));
+        break;
+    case INDEX_LIGHT_ERR:
+        snprintf(buf, len, " L : %s ", "ERR");
+        break;
+    default:
+        snprintf(buf, len, " L : %s ", "OFF");
+        break;
+    }
+}
 
-    // 秒onds进度条
-    OLED_DrawProgressBar(60 + x_offset, 0, 2, 64, g_index_state.seconds, 0, 60, 0, 1, 1);
+static const oled_bitmap_t *index_pick_wifi_icon(uint32_t connected)
+{
+    return connected ? &gImage_wifi : NULL;
+}
+
+static const oled_bitmap_t *index_pick_light_icon(uint32_t light_state)
+{
+    return light_state == INDEX_LIGHT_OK ? &gImage_lightQD : NULL;
 }
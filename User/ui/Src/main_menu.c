@@ -13,71 +13,41 @@
 #include "Light_page.h"
 #include "WiFiStatus.h"
 #include "ParamSetting.h"
+#include "LogView.h"
+
+#include "index.h"
+#include "memory_optimized_menu.h"
 
 // ==================================
-// 函数实现
+// 菜单树（flash常量表，下标即menu_node_t，同一菜单的子项相邻）
 // ==================================
 
-menu_item_t *main_menu_init(void)
-{
-
-    // 创建主菜单（横向图标菜单）
-    menu_item_t *main_menu = menu_item_create(
-        "Main Menu",
-        MENU_TYPE_HORIZONTAL_ICON,
-        (menu_content_t){0} // 主菜单不需要内容
-    );
-
-    if (main_menu == NULL)
-    {
-        return NULL;
-    }
-    menu_item_set_callbacks(main_menu,
-                            main_menu_on_enter, // 进入回调
-                            main_menu_on_exit,  // 退出回调
-                            NULL,               // 选中回调（不需要特殊处理）
-                            NULL);              // 按键处理
-
-    
-
-    menu_item_t *Light_page = Light_init();
-    if (Light_page != NULL)
-    {
-        Light_page->content.custom.icon_data = gImage_lightQD;
-        menu_add_child(main_menu, Light_page);
-    }
-
-    
-
+const menu_item_t g_menu_tree[MENU_NODE_COUNT] = {
+    [MENU_NODE_INDEX] = MENU_NODE("Index", MENU_TYPE_CUSTOM, MENU_INDEX_NONE, MENU_NODE_MAIN, 1,
+                                  index_draw_function, &g_index_state, NULL,
+                                  index_on_enter, index_on_exit, index_key_handler),
+
+    // 主菜单（横向图标菜单），子项为Light ~ Log
+    [MENU_NODE_MAIN] = MENU_NODE("Main Menu", MENU_TYPE_HORIZONTAL_ICON, MENU_NODE_INDEX,
+                                 MENU_NODE_LIGHT, MENU_NODE_LOG - MENU_NODE_LIGHT + 1,
+                                 NULL, NULL, NULL,
+                                 main_menu_on_enter, main_menu_on_exit, NULL),
+
+    [MENU_NODE_LIGHT] = MENU_PAGE("Light", MENU_NODE_MAIN, Light_draw_function, &g_light_state, &gImage_lightQD,
+                                  Light_on_enter, Light_on_exit, Light_key_handler),
+    [MENU_NODE_WIFI] = MENU_PAGE("WiFi Status", MENU_NODE_MAIN, WiFiStatus_draw_function, &g_wifistatus_state, &gImage_wifi,
+                                 WiFiStatus_on_enter, WiFiStatus_on_exit, WiFiStatus_key_handler),
+    [MENU_NODE_PARAM] = MENU_PAGE("ParamSetting", MENU_NODE_MAIN, ParamSetting_draw_function, &g_paramsetting_state, &gImage_setting,
+                                  ParamSetting_on_enter, ParamSetting_on_exit, ParamSetting_key_handler),
+    [MENU_NODE_LOG] = MENU_PAGE("Log", MENU_NODE_MAIN, LogView_draw_function, NULL, &gImage_list,
+                                LogView_on_enter, LogView_on_exit, LogView_key_handler),
+};
 
+// ==================================
+// 函数实现
+// ==================================
 
-    // menu_item_t *setting_menu = setting_menu_init();
-    // if (setting_menu != NULL)
-    // {
-    //     setting_menu->content.icon.icon_data = gImage_setting;
-    //     menu_add_child(main_menu, setting_menu);
-    // }
-
-    // 添加WiFi状态页面
-    menu_item_t *WiFiStatus_page = WiFiStatus_init();
-    if (WiFiStatus_page != NULL)
-    {
-        WiFiStatus_page->content.custom.icon_data = gImage_wifi;
-        menu_add_child(main_menu, WiFiStatus_page);
-    }
-
-    // 添加参数设置页面
-    menu_item_t *ParamSetting_page = ParamSetting_init();
-    if (ParamSetting_page != NULL)
-    {
-        ParamSetting_page->content.custom.icon_data = gImage_setting;
-        menu_add_child(main_menu, ParamSetting_page);
-    }
-
-    return main_menu;
-}
-
-void main_menu_on_enter(menu_item_t *item)
+void main_menu_on_enter(const menu_item_t *item)
 {
     printf("================================\n");
     printf("Free heap before deletion: %d bytes\n", xPortGetFreeHeapSize());
@@ -86,7 +56,7 @@ void main_menu_on_enter(menu_item_t *item)
     // 主菜单进入时的初始化操作
 }
 
-void main_menu_on_exit(menu_item_t *item)
+void main_menu_on_exit(const menu_item_t *item)
 {
     printf("Exit main menu\r\n");
     // 主菜单退出时的清理操作
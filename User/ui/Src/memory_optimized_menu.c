@@ -0,0 +1,39 @@
+/**
+ * @file memory_optimized_menu.c
+ * @brief 编译期菜单树的访问函数与运行时状态（树本身定义在main_menu.c）
+ * @author flowkite-0689
+ * @version v3.0
+ * @date 2026.01.09
+ */
+
+#include "memory_optimized_menu.h"
+#define LOG_FILE_ID 8
+#include "log.h"
+
+uint8_t g_menu_selected[MENU_NODE_COUNT];
+
+uint8_t menu_item_index(const menu_item_t *item)
+{
+    if (item < &g_menu_tree[0] || item >= &g_menu_tree[MENU_NODE_COUNT])
+        return MENU_INDEX_NONE;
+    return (uint8_t)(item - g_menu_tree);
+}
+
+const menu_item_t *menu_item_parent(const menu_item_t *item)
+{
+    if (item == NULL || item->parent >= MENU_NODE_COUNT)
+        return NULL;
+    return &g_menu_tree[item->parent];
+}
+
+const char *menu_item_name(uint8_t index)
+{
+    if (index >= MENU_NODE_COUNT)
+        return "-";
+    return g_menu_tree[index].name;
+}
+
+void menu_memory_report(void)
+{
+    LOG_I(MENU, "Menu tree: %d nodes, %d bytes flash, %d bytes RAM, 0 bytes heap\n", MENU_NODE_COUNT, (int)sizeof(g_menu_tree), (int)sizeof(g_menu_selected));
+}
@@ -7,6 +7,10 @@
  */
 
 #include "unified_menu.h"
+#include "memory_optimized_menu.h"
+#include "oled_anim.h"
+#define LOG_FILE_ID 9
+#include "log.h"
 #include <string.h>
 #include <stdlib.h>
 
@@ -20,15 +24,14 @@ menu_system_t g_menu_sys = {0};
 // 全局闹钟提醒页面
 // ==================================
 
-static menu_item_t *g_alarm_alert_page = NULL;
+static const menu_item_t *g_alarm_alert_page = NULL;
 
 // ==================================
 // 静态函数声明
 // ==================================
 
-static void menu_update_page_info(menu_item_t *menu);
-static void menu_item_deselect_all(menu_item_t *menu);
-static void menu_item_update_selection(menu_item_t *menu, uint8_t new_index);
+static void menu_update_page_info(const menu_item_t *menu);
+static void menu_item_update_selection(const menu_item_t *menu, uint8_t new_index);
 static void menu_set_layout_for_type(menu_type_t type);
 
 // ==================================
@@ -56,6 +59,8 @@ int8_t menu_system_init(void)
     g_menu_sys.menu_active = 0;
     g_menu_sys.need_refresh = 1;
     g_menu_sys.last_refresh_time = xTaskGetTickCount();
+    g_menu_sys.has_deadline = 0;
+    g_menu_sys.refresh_pending = 0;
     g_menu_sys.blink_state = 0;
     g_menu_sys.current_page = 0;
     g_menu_sys.total_pages = 1;
@@ -72,305 +77,29 @@ int8_t menu_system_init(void)
     // g_alarm_alert_page = alarm_alert_init();
     if (g_alarm_alert_page == NULL)
     {
-        printf("Warning: Failed to create alarm alert page\r\n");
+        LOG_W(MENU, "Failed to create alarm alert page\r\n");
     }
     else
     {
-        printf("Alarm alert page created successfully\r\n");
+        LOG_I(MENU, "Alarm alert page created successfully\r\n");
     }
 
-    printf("Menu system initialized successfully\r\n");
+    LOG_I(MENU, "Menu system initialized successfully\r\n");
     return 0;
 }
 
-// ==================================
-// 菜单项创建和管理
-// ==================================
-
-menu_item_t *menu_item_create(const char *name, menu_type_t type, menu_content_t content)
-{
-    menu_item_t *item = (menu_item_t *)pvPortMalloc(sizeof(menu_item_t));
-    if (item == NULL)
-    {
-        return NULL;
-    }
-    // printf("MALLOC: menu_item_create %s, size=%d bytes, addr=%p (menu_item_t structure allocation)\n", name, sizeof(menu_item_t), item);
-
-    // 清零结构体
-    memset(item, 0, sizeof(menu_item_t));
-
-    // 设置基本信息
-    item->name = name;
-    item->type = type;
-    item->content = content;
-    // item->display_index = 0;
-    // item->x_pos = 0;
-    // item->y_pos = 0;
-    // item->width = (type == MENU_TYPE_HORIZONTAL_ICON) ? 32 : 128;
-    // item->height = (type == MENU_TYPE_HORIZONTAL_ICON) ? 32 : 16;
-
-    // 设置默认状态
-    item->is_selected = 0;
-
-
-    // 设置默认关系
-    item->parent = NULL;
-    item->children = NULL;
-    item->child_count = 0;
-    item->selected_child = 0;
-
-  
-
-    return item;
-}
-
-int8_t menu_add_child(menu_item_t *parent, menu_item_t *child)
-{
-    if (parent == NULL || child == NULL)
-    {
-        return -1;
-    }
-
-    // 不允许重复添加同一 child（防循环/重复）
-    for (uint8_t i = 0; i < parent->child_count; i++)
-    {
-        if (parent->children && parent->children[i] == child)
-        {
-            return -3; // already exists
-        }
-    }
-
-    // 分配新的指针数组（多一个 slot）
-    menu_item_t **new_children = (menu_item_t **)pvPortMalloc(
-        sizeof(menu_item_t *) * (parent->child_count + 1));
-    if (new_children == NULL)
-    {
-        return -2; // malloc failed
-    }
-    // printf("MALLOC: menu_add_child %s->%s, size=%d bytes, addr=%p (new children pointer array allocation)\n",
-    //    parent->name, child->name, sizeof(menu_item_t *) * (parent->child_count + 1), new_children);
-
-    // 拷贝旧指针（如果有）
-    if (parent->child_count > 0 && parent->children != NULL)
-    {
-        memcpy(new_children, parent->children, sizeof(menu_item_t *) * parent->child_count);
-        // printf("FREE: menu_add_child %s, old children pointer array addr=%p, size=%d bytes (old children array release)\n",
-        //    parent->name, parent->children, sizeof(menu_item_t *) * parent->child_count);
-        vPortFree(parent->children); // 释放旧数组
-    }
-
-    // 添加新 child 指针到末尾
-    new_children[parent->child_count] = child; // ←←← 存的是指针！不是结构体！
-
-    // 更新 parent
-    parent->children = new_children;
-    parent->child_count++;
-    child->parent = parent;
-
-    return 0;
-}
-
-
-
-int8_t menu_item_set_callbacks(menu_item_t *item,
-                               void (*on_enter)(menu_item_t *),
-                               void (*on_exit)(menu_item_t *),
-                               void (*on_select)(menu_item_t *),
-                               void (*on_key)(menu_item_t *, uint8_t))
-{
-    if (item == NULL)
-    {
-        return -1;
-    }
-
-    item->on_enter = on_enter;
-    item->on_exit = on_exit;
-    item->on_select = on_select;
-    item->on_key = on_key;
-
-    return 0;
-}
-
-int8_t menu_remove_child(menu_item_t *parent, menu_item_t *child)
-{
-    if (parent == NULL || child == NULL || parent->child_count == 0 || parent->children == NULL)
-    {
-        return -1;
-    }
-
-    // 查找 child 指针在 children 数组中的位置（指针比较！）
-    int8_t index = -1;
-    for (uint8_t i = 0; i < parent->child_count; i++)
-    {
-        if (parent->children[i] == child)
-        { //
-            index = i;
-            break;
-        }
-    }
-    if (index == -1)
-        return -2; // 未找到
-
-    // 调整 selected_child
-    if (parent->selected_child == index)
-    {
-        if (parent->child_count > 1)
-        {
-            parent->selected_child = (index == 0) ? 0 : index - 1;
-        }
-        else
-        {
-            parent->selected_child = 0;
-        }
-    }
-    else if (parent->selected_child > index)
-    {
-        parent->selected_child--;
-    }
-
-    // 重新分配 children 指针数组（少一个）
-    menu_item_t **new_children = NULL;
-    uint8_t new_count = parent->child_count - 1;
-
-    if (new_count > 0)
-    {
-        new_children = (menu_item_t **)pvPortMalloc(sizeof(menu_item_t *) * new_count);
-        if (new_children == NULL)
-            return -3;
-
-        uint8_t j = 0;
-        for (uint8_t i = 0; i < parent->child_count; i++)
-        {
-            if (i != index)
-            {
-                new_children[j++] = parent->children[i]; // 拷贝指针
-            }
-        }
-    }
-
-    // 释放旧数组，更新
-    // printf("FREE: menu_remove_child %s, old children pointer array addr=%p, size=%d bytes (old children array release during removal)\n",
-    //        parent->name, parent->children, sizeof(menu_item_t *) * parent->child_count);
-    vPortFree(parent->children);
-    parent->children = new_children;
-    parent->child_count = new_count;
-
-    // 清除 child 的 parent 指针（防止野指针）
-    child->parent = NULL;
-
-    return 0;
-}
-int8_t menu_item_delete(menu_item_t *item)
-{
-    if (!item)
-        return -1;
-    if (item == g_menu_sys.current_menu || item == g_menu_sys.root_menu)
-        return -2;
-
-    //  加锁
-    if (g_menu_sys.display_mutex)
-    {
-        if (xSemaphoreTake(g_menu_sys.display_mutex, pdMS_TO_TICKS(100)) != pdTRUE)
-            return -5;
-    }
-
-// printf("================================\n");
-// printf("Free heap before deletion: %d bytes\n", xPortGetFreeHeapSize());
-// printf("Deleting menu item: %s (addr=%p)\n", item->name, item);
-// printf("================================\n");
-
-// //  用栈模拟递归（避免爆栈）
-#define MAX_STACK_DEPTH 32 // 增加深度
-    menu_item_t *stack[MAX_STACK_DEPTH];
-    int top = 0;
-
-    // 安全检查：防止循环引用
-    for (int i = 0; i < top; i++)
-    {
-        if (stack[i] == item)
-        {
-            printf("ERROR: Circular reference detected!\n");
-            if (g_menu_sys.display_mutex)
-                xSemaphoreGive(g_menu_sys.display_mutex);
-            return -6;
-        }
-    }
-
-    stack[top++] = item;
-
-    while (top > 0)
-    {
-        menu_item_t *cur = stack[--top];
-
-        // 安全检查
-        if (!cur)
-            continue;
-
-        printf("Processing: %s (child_count=%d)\n", cur->name, cur->child_count);
-
-        // 子项入栈（后进先出）
-        if (cur->child_count > 0 && cur->children != NULL)
-        {
-            for (int8_t i = cur->child_count - 1; i >= 0; i--)
-            {
-                if (cur->children[i] != NULL && top < MAX_STACK_DEPTH - 1)
-                {
-                    // 安全检查：防止重复入栈
-                    int already_in_stack = 0;
-                    for (int j = 0; j < top; j++)
-                    {
-                        if (stack[j] == cur->children[i])
-                        {
-                            already_in_stack = 1;
-                            break;
-                        }
-                    }
-                    if (!already_in_stack)
-                    {
-                        stack[top++] = cur->children[i];
-                    }
-                }
-            }
-        }
-
-        // 释放当前项的资源
-        // 1. 释放子项指针数组
-        if (cur->children != NULL)
-        {
-            // printf("FREE: %s children array, addr=%p, size=%d bytes\n",
-            //    cur->name, cur->children, sizeof(menu_item_t *) * cur->child_count);
-            vPortFree(cur->children);
-            cur->children = NULL;
-            cur->child_count = 0;
-        }
-
-
-        // 3. 释放菜单项结构本身
-        // printf("FREE: %s menu_item, addr=%p, size=%d bytes\n",
-        //        cur->name, cur, sizeof(menu_item_t));
-        vPortFree(cur);
-
-        // printf("Heap after freeing %s: %d bytes\n", cur->name, xPortGetFreeHeapSize());
-    }
-
-    g_menu_sys.need_refresh = 1;
-    if (g_menu_sys.display_mutex)
-        xSemaphoreGive(g_menu_sys.display_mutex);
-
-    printf("================================\n");
-    printf("Free heap after deletion: %d bytes\n", xPortGetFreeHeapSize());
-    printf("================================\n");
-
-    return 0;
-}
 // ==================================
 // 菜单显示实现
 // ==================================
 
 void menu_refresh_display(void)
 {
+    uint32_t anim_delay;
+
     if (g_menu_sys.current_menu == NULL)
     {
+        g_menu_sys.need_refresh = 0;
+        g_menu_sys.has_deadline = 0;
         return;
     }
 
@@ -379,6 +108,13 @@ void menu_refresh_display(void)
         return;
     }
 
+    // 定时刷新由绘制函数按需重新设置
+    g_menu_sys.has_deadline = 0;
+
+    // 本帧画在后台显存，结束时交给显示任务发送，不在菜单任务里等I2C
+    OLED_Anim_Frame_Begin();
+    OLED_Begin_Frame();
+
     switch (g_menu_sys.current_menu->type)
     {
     case MENU_TYPE_HORIZONTAL_ICON:
@@ -397,13 +133,21 @@ void menu_refresh_display(void)
         break;
     }
 
+    OLED_End_Frame();
+
+    // 本帧有没结束的动画：按帧率上限安排下一帧，动画都结束后不再定时重画
+    if (OLED_Anim_Frame_End(&anim_delay))
+    {
+        menu_schedule_refresh(anim_delay);
+    }
+
     g_menu_sys.last_refresh_time = xTaskGetTickCount();
     g_menu_sys.need_refresh = 0;
 
     xSemaphoreGive(g_menu_sys.display_mutex);
 }
 
-void menu_display_horizontal(menu_item_t *menu)
+void menu_display_horizontal(const menu_item_t *menu)
 {
     if (menu == NULL || menu->child_count == 0)
     {
@@ -411,62 +155,62 @@ void menu_display_horizontal(menu_item_t *menu)
     }
 
     // 计算可见范围（显示3个：左、中、右）
-    uint8_t center_index = menu->selected_child;
+    uint8_t center_index = MENU_SELECTED(menu);
     uint8_t left_index = (center_index == 0) ? menu->child_count - 1 : center_index - 1;
     uint8_t right_index = (center_index + 1) % menu->child_count;
 
     // 显示左侧图标（淡化）
-    if (menu->children[left_index]->content.icon_data)
+    if (MENU_CHILD(menu, left_index)->content.icon_data)
     {
-        if (menu->children[left_index]->type == MENU_TYPE_CUSTOM)
+        if (MENU_CHILD(menu, left_index)->type == MENU_TYPE_CUSTOM)
         {
-            OLED_ShowPicture(0, 16, 32, 32,
-                             menu->children[left_index]->content.custom.icon_data, 1);
+            OLED_ShowBitmap(0, 16,
+                            MENU_CHILD(menu, left_index)->content.custom.icon_data, 1);
         }
         else
         {
-            OLED_ShowPicture(0, 16, 32, 32,
-                             menu->children[left_index]->content.icon_data, 1);
+            OLED_ShowBitmap(0, 16,
+                            MENU_CHILD(menu, left_index)->content.icon_data, 1);
         }
     }
 
     // 显示中间图标（清晰）
-    if (menu->children[center_index]->content.icon_data)
+    if (MENU_CHILD(menu, center_index)->content.icon_data)
     {
-        OLED_Printf_Line(3,"       %s",menu->children[center_index]->name);
-        if (menu->children[center_index]->type == MENU_TYPE_CUSTOM)
+        OLED_Printf_Line(3,"       %s",MENU_CHILD(menu, center_index)->name);
+        if (MENU_CHILD(menu, center_index)->type == MENU_TYPE_CUSTOM)
         {
-            OLED_ShowPicture(48, 16, 32, 32,
-                             menu->children[center_index]->content.custom.icon_data, 0);
+            OLED_ShowBitmap(48, 16,
+                            MENU_CHILD(menu, center_index)->content.custom.icon_data, 0);
 
         }
         else
         {
-            OLED_ShowPicture(48, 16, 32, 32,
-                             menu->children[center_index]->content.icon_data, 0);
+            OLED_ShowBitmap(48, 16,
+                            MENU_CHILD(menu, center_index)->content.icon_data, 0);
         }
     }
 
     // 显示右侧图标（淡化）
-    if (menu->children[right_index]->content.icon_data)
+    if (MENU_CHILD(menu, right_index)->content.icon_data)
     {
-        if (menu->children[right_index]->type == MENU_TYPE_CUSTOM)
+        if (MENU_CHILD(menu, right_index)->type == MENU_TYPE_CUSTOM)
         {
-            OLED_ShowPicture(96, 16, 32, 32,
-                             menu->children[right_index]->content.custom.icon_data, 1);
+            OLED_ShowBitmap(96, 16,
+                            MENU_CHILD(menu, right_index)->content.custom.icon_data, 1);
         }
         else
         {
 
-            OLED_ShowPicture(96, 16, 32, 32,
-                             menu->children[right_index]->content.icon_data, 1);
+            OLED_ShowBitmap(96, 16,
+                            MENU_CHILD(menu, right_index)->content.icon_data, 1);
         }
     }
 
     OLED_Refresh();
 }
 
-void menu_display_vertical(menu_item_t *menu)
+void menu_display_vertical(const menu_item_t *menu)
 {
     if (menu == NULL || menu->child_count == 0)
     {
@@ -488,9 +232,9 @@ void menu_display_vertical(menu_item_t *menu)
     for (uint8_t i = start_index; i < end_index; i++)
     {
         uint8_t line = i - start_index;
-        char arrow = (i == menu->selected_child) ? '>' : ' ';
+        char arrow = (i == MENU_SELECTED(menu)) ? '>' : ' ';
 
-        OLED_Printf_Line(line, "%c %s", arrow, menu->children[i]->name);
+        OLED_Printf_Line(line, "%c %s", arrow, MENU_CHILD(menu, i)->name);
     }
 
     // 如果本页不足4行，下面几行清空
@@ -508,6 +252,36 @@ void menu_clear_and_redraw(void)
     menu_refresh_display();
 }
 
+void menu_schedule_refresh(uint32_t ms)
+{
+    uint32_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(ms);
+
+    if (!g_menu_sys.has_deadline || (int32_t)(deadline - g_menu_sys.refresh_deadline) < 0)
+    {
+        g_menu_sys.refresh_deadline = deadline;
+        g_menu_sys.has_deadline = 1;
+    }
+}
+
+void menu_request_refresh(void)
+{
+    menu_event_t event;
+
+    if (g_menu_sys.event_queue == NULL || g_menu_sys.refresh_pending)
+    {
+        return;
+    }
+
+    memset(&event, 0, sizeof(menu_event_t));
+    event.type = MENU_EVENT_REFRESH;
+    event.timestamp = xTaskGetTickCount();
+    g_menu_sys.refresh_pending = 1;
+    if (xQueueSend(g_menu_sys.event_queue, &event, 0) != pdPASS)
+    {
+        g_menu_sys.refresh_pending = 0;
+    }
+}
+
 // ==================================
 // 菜单事件处理
 // ==================================
@@ -518,7 +292,7 @@ menu_event_t menu_key_to_event(uint8_t key)
     memset(&event, 0, sizeof(menu_event_t));
     event.timestamp = xTaskGetTickCount();
     BEEP_Buzz(1);
-    printf("key press - > %d\n", key - 1);
+    LOG_D(MENU, "key press - > %d\n", key - 1);
     switch (key)
     {
     case 1:
@@ -551,12 +325,12 @@ int8_t menu_process_event(menu_event_t *event)
     // 处理闹钟事件（特殊处理，不需要当前菜单）
     if (event->type == MENU_EVENT_ALARM)
     {
-        printf("Processing alarm event, index: %d\n", event->param);
+        LOG_D(MENU, "Processing alarm event, index: %d\n", event->param);
 
         // 检查闹钟提醒页面是否已创建
         if (g_alarm_alert_page == NULL)
         {
-            printf("Error: Alarm alert page not created\n");
+            LOG_E(MENU, "Alarm alert page not created\n");
             return -1;
         }
 
@@ -564,7 +338,7 @@ int8_t menu_process_event(menu_event_t *event)
         //        if (alarm_alert_trigger(event->param) == 0) {
         //            // 设置闹钟提醒页面的父菜单为当前菜单（如果存在）
         //            if (g_menu_sys.current_menu != NULL) {
-        //                g_alarm_alert_page->parent = g_menu_sys.current_menu;
+        //                g_alarm_alert_page->parent = menu_item_index(g_menu_sys.current_menu);
         //            }
         //            // 切换到闹钟提醒页面
         //            menu_enter(g_alarm_alert_page);
@@ -578,7 +352,7 @@ int8_t menu_process_event(menu_event_t *event)
         return -1;
     }
 
-    menu_item_t *current = g_menu_sys.current_menu;
+    const menu_item_t *current = g_menu_sys.current_menu;
 
     // 按键去抖处理
     uint32_t current_time = xTaskGetTickCount();
@@ -613,7 +387,7 @@ int8_t menu_process_event(menu_event_t *event)
     }
 }
 
-int8_t menu_handle_horizontal_key(menu_item_t *menu, uint8_t key_event)
+int8_t menu_handle_horizontal_key(const menu_item_t *menu, uint8_t key_event)
 {
     if (menu == NULL || menu->child_count == 0)
     {
@@ -624,12 +398,12 @@ int8_t menu_handle_horizontal_key(menu_item_t *menu, uint8_t key_event)
     {
     case MENU_EVENT_KEY_UP:
         // 上一个选项
-        menu_item_update_selection(menu, (menu->selected_child == 0) ? menu->child_count - 1 : menu->selected_child - 1);
+        menu_item_update_selection(menu, (MENU_SELECTED(menu) == 0) ? menu->child_count - 1 : MENU_SELECTED(menu) - 1);
         break;
 
     case MENU_EVENT_KEY_DOWN:
         // 下一个选项
-        menu_item_update_selection(menu, (menu->selected_child + 1) % menu->child_count);
+        menu_item_update_selection(menu, (MENU_SELECTED(menu) + 1) % menu->child_count);
         break;
 
     case MENU_EVENT_KEY_SELECT:
@@ -651,7 +425,7 @@ int8_t menu_handle_horizontal_key(menu_item_t *menu, uint8_t key_event)
     return 0;
 }
 
-int8_t menu_handle_vertical_key(menu_item_t *menu, uint8_t key_event)
+int8_t menu_handle_vertical_key(const menu_item_t *menu, uint8_t key_event)
 {
     if (menu == NULL || menu->child_count == 0)
     {
@@ -662,15 +436,15 @@ int8_t menu_handle_vertical_key(menu_item_t *menu, uint8_t key_event)
     {
     case MENU_EVENT_KEY_UP:
         // 上一个选项（类似你想要的testlist循环选择）
-        if (menu->selected_child == 0)
+        if (MENU_SELECTED(menu) == 0)
         {
-            menu->selected_child = menu->child_count - 1;
+            MENU_SELECTED(menu) = menu->child_count - 1;
         }
         else
         {
-            menu->selected_child--;
+            MENU_SELECTED(menu)--;
         }
-        printf("selected : %d\n", menu->selected_child);
+        LOG_D(MENU, "selected : %d\n", MENU_SELECTED(menu));
         // 更新分页信息
         menu_update_page_info(menu);
         g_menu_sys.need_refresh = 1;
@@ -678,8 +452,8 @@ int8_t menu_handle_vertical_key(menu_item_t *menu, uint8_t key_event)
 
     case MENU_EVENT_KEY_DOWN:
         // 下一个选项（循环选择）
-        menu->selected_child = (menu->selected_child + 1) % menu->child_count;
-        printf("selected : %d\n", menu->selected_child);
+        MENU_SELECTED(menu) = (MENU_SELECTED(menu) + 1) % menu->child_count;
+        LOG_D(MENU, "selected : %d\n", MENU_SELECTED(menu));
         // 更新分页信息
         menu_update_page_info(menu);
         g_menu_sys.need_refresh = 1;
@@ -708,13 +482,16 @@ int8_t menu_handle_vertical_key(menu_item_t *menu, uint8_t key_event)
 // 菜单导航实现
 // ==================================
 
-int8_t menu_enter(menu_item_t *menu)
+int8_t menu_enter(const menu_item_t *menu)
 {
     if (menu == NULL)
     {
         return -1;
     }
 
+    // 页面切换的清屏、回调和新页面的第一帧在同一帧里提交，显示任务不会取走清了一半的画面
+    OLED_Begin_Frame();
+
     // 调用退出回调
     if (g_menu_sys.current_menu && g_menu_sys.current_menu->on_exit)
     {
@@ -738,20 +515,24 @@ int8_t menu_enter(menu_item_t *menu)
     {
         menu->on_enter(menu);
     }
-    printf("\nparent : %s ,\n current : %s \n", g_menu_sys.current_menu->parent->name, g_menu_sys.current_menu->name);
+    menu_refresh_display();
+    OLED_End_Frame();
+    LOG_D(MENU, "parent : %s , current : %s\n", menu_item_name(g_menu_sys.current_menu->parent), g_menu_sys.current_menu->name);
     return 0;
 }
 
 int8_t menu_back_to_parent(void)
 {
-    printf("menu_back_to_parent\n");
-    printf("\nparent : %s ,\n current : %s \n", g_menu_sys.current_menu->parent->name, g_menu_sys.current_menu->name);
-    if (g_menu_sys.current_menu == NULL || g_menu_sys.current_menu->parent == NULL)
+    LOG_D(MENU, "menu_back_to_parent\n");
+    LOG_D(MENU, "parent : %s , current : %s\n", menu_item_name(g_menu_sys.current_menu->parent), g_menu_sys.current_menu->name);
+    if (g_menu_sys.current_menu == NULL || g_menu_sys.current_menu->parent == MENU_INDEX_NONE)
     {
         return -1;
     }
+    const menu_item_t *parent = menu_item_parent(g_menu_sys.current_menu);
+
+    OLED_Begin_Frame(); // 同menu_enter，清屏和父菜单的第一帧一起提交
     OLED_Clear();
-    menu_item_t *parent = g_menu_sys.current_menu->parent;
 
     // 调用退出回调
     if (g_menu_sys.current_menu->on_exit)
@@ -772,12 +553,14 @@ int8_t menu_back_to_parent(void)
     // 刷新显示
     g_menu_sys.need_refresh = 1;
 
-    printf("back to ->  %s\n", parent->name);
+    LOG_D(MENU, "back to ->  %s\n", parent->name);
     // 调用父菜单的进入回调
     if (parent->on_enter)
     {
         parent->on_enter(parent);
     }
+    menu_refresh_display();
+    OLED_End_Frame();
 
     return 0;
 }
@@ -789,8 +572,8 @@ int8_t menu_select_next(void)
         return -1;
     }
 
-    menu_item_t *menu = g_menu_sys.current_menu;
-    menu->selected_child = (menu->selected_child + 1) % menu->child_count;
+    const menu_item_t *menu = g_menu_sys.current_menu;
+    MENU_SELECTED(menu) = (MENU_SELECTED(menu) + 1) % menu->child_count;
     g_menu_sys.need_refresh = 1;
 
     return 0;
@@ -803,14 +586,14 @@ int8_t menu_select_previous(void)
         return -1;
     }
 
-    menu_item_t *menu = g_menu_sys.current_menu;
-    if (menu->selected_child == 0)
+    const menu_item_t *menu = g_menu_sys.current_menu;
+    if (MENU_SELECTED(menu) == 0)
     {
-        menu->selected_child = menu->child_count - 1;
+        MENU_SELECTED(menu) = menu->child_count - 1;
     }
     else
     {
-        menu->selected_child--;
+        MENU_SELECTED(menu)--;
     }
     g_menu_sys.need_refresh = 1;
 
@@ -824,11 +607,13 @@ int8_t menu_enter_selected(void)
         return -1;
     }
 
-    menu_item_t *menu = g_menu_sys.current_menu;
-    menu_item_t *selected = menu->children[menu->selected_child];
+    const menu_item_t *menu = g_menu_sys.current_menu;
+    const menu_item_t *selected = MENU_CHILD(menu, MENU_SELECTED(menu));
+    int8_t ret;
+
+    LOG_D(MENU, "menu_enter_selected: current=%s, selected=%s, child_count=%d\n", menu->name, selected->name, selected->child_count);
 
-    printf("menu_enter_selected: current=%s, selected=%s, child_count=%d\n",
-           menu->name, selected->name, selected->child_count);
+    OLED_Begin_Frame(); // 回调里的绘制和menu_enter的切换同在一帧
 
     // 调用选中回调
     if (selected->on_select)
@@ -836,22 +621,19 @@ int8_t menu_enter_selected(void)
         selected->on_select(selected);
     }
 
-    // 设置父菜单关系
-    selected->parent = g_menu_sys.current_menu;
-
     // 根据菜单类型决定如何进入
     if (selected->child_count > 0)
     {
         // 有子菜单的菜单项：直接进入该菜单
-        printf("menu_enter_selected - Entering menu with children\n");
-        printf("parent : %s ,\n current : %s \n", selected->parent->name, selected->name);
-        return menu_enter(selected);
+        LOG_D(MENU, "menu_enter_selected - Entering menu with children\n");
+        LOG_D(MENU, "parent : %s , current : %s\n", menu_item_name(selected->parent), selected->name);
+        ret = menu_enter(selected);
     }
     else
     {
         // 没有子菜单的菜单项：可能是功能页面或自定义页面
-        printf("menu_enter_selected - Entering leaf node (custom page/function)\n");
-        printf("parent : %s ,\n current : %s \n", selected->parent->name, selected->name);
+        LOG_D(MENU, "menu_enter_selected - Entering leaf node (custom page/function)\n");
+        LOG_D(MENU, "parent : %s , current : %s\n", menu_item_name(selected->parent), selected->name);
 
         // 调用进入回调
         if (selected->on_enter)
@@ -860,35 +642,68 @@ int8_t menu_enter_selected(void)
         }
 
         // 进入该页面
-        return menu_enter(selected);
+        ret = menu_enter(selected);
     }
+    OLED_End_Frame();
+    return ret;
 }
 
 // ==================================
 // FreeRTOS任务实现
 // ==================================
 
+// 距离下一次必须刷新还有多久：要刷新时为0，没有事件也没有定时刷新时一直等
+static TickType_t menu_next_wait(void)
+{
+    int32_t left;
+
+    if (g_menu_sys.need_refresh)
+    {
+        return 0;
+    }
+    if (!g_menu_sys.has_deadline)
+    {
+        return portMAX_DELAY;
+    }
+    left = (int32_t)(g_menu_sys.refresh_deadline - xTaskGetTickCount());
+    return (left > 0) ? (TickType_t)left : 0;
+}
+
+// 处理一个事件：刷新请求只置标志，按键交给当前页面处理后立即重画
+// （不持有帧锁：页面切换在menu_enter/menu_back_to_parent里自己成帧，帧外的清屏推迟到下一帧）
+static void menu_dispatch_event(menu_event_t *event)
+{
+    if (event->type == MENU_EVENT_REFRESH)
+    {
+        g_menu_sys.refresh_pending = 0;
+        g_menu_sys.need_refresh = 1;
+        return;
+    }
+
+    menu_process_event(event);
+    g_menu_sys.need_refresh = 1;
+}
+
 void menu_task(void *pvParameters)
 {
-    const TickType_t delay_20ms = pdMS_TO_TICKS(20);
     menu_event_t event;
 
     while (1)
     {
-        // 处理菜单事件
-        if (xQueueReceive(g_menu_sys.event_queue, &event, 0) == pdPASS)
+        // 阻塞等事件，最多等到页面要求的下一次刷新
+        if (xQueueReceive(g_menu_sys.event_queue, &event, menu_next_wait()) == pdPASS)
         {
-            menu_process_event(&event);
+            // 一次取完队列里积压的事件（连按、重复的刷新请求），之后只画一帧。
+            // 页面处理函数可能较慢，这里不持有帧锁，显示任务照常执行其他任务投递的绘制
+            do
+            {
+                menu_dispatch_event(&event);
+            } while (xQueueReceive(g_menu_sys.event_queue, &event, 0) == pdPASS);
         }
-
-        // 定时刷新显示
-        if (g_menu_sys.need_refresh ||
-            (xTaskGetTickCount() - g_menu_sys.last_refresh_time) > pdMS_TO_TICKS(50))
+        if (menu_next_wait() == 0)
         {
             menu_refresh_display();
         }
-
-        vTaskDelay(delay_20ms);
     }
 }
 
@@ -916,7 +731,7 @@ void menu_key_task(void *pvParameters)
 // 静态辅助函数实现
 // ==================================
 
-static void menu_update_page_info(menu_item_t *menu)
+static void menu_update_page_info(const menu_item_t *menu)
 {
     if (menu == NULL || menu->type != MENU_TYPE_VERTICAL_LIST)
     {
@@ -936,43 +751,25 @@ static void menu_update_page_info(menu_item_t *menu)
     uint8_t page_start = g_menu_sys.current_page * g_menu_sys.items_per_page;
     uint8_t page_end = page_start + g_menu_sys.items_per_page - 1;
 
-    if (menu->selected_child < page_start)
+    if (MENU_SELECTED(menu) < page_start)
     {
-        g_menu_sys.current_page = menu->selected_child / g_menu_sys.items_per_page;
+        g_menu_sys.current_page = MENU_SELECTED(menu) / g_menu_sys.items_per_page;
     }
-    else if (menu->selected_child > page_end)
+    else if (MENU_SELECTED(menu) > page_end)
     {
-        g_menu_sys.current_page = menu->selected_child / g_menu_sys.items_per_page;
+        g_menu_sys.current_page = MENU_SELECTED(menu) / g_menu_sys.items_per_page;
     }
 }
 
-static void menu_item_deselect_all(menu_item_t *menu)
-{
-    if (menu == NULL)
-    {
-        return;
-    }
-
-    // 取消选中所有子项
-    for (uint8_t i = 0; i < menu->child_count; i++)
-    {
-        menu->children[i]->is_selected = 0;
-    }
-}
-
-static void menu_item_update_selection(menu_item_t *menu, uint8_t new_index)
+static void menu_item_update_selection(const menu_item_t *menu, uint8_t new_index)
 {
     if (menu == NULL || new_index >= menu->child_count)
     {
         return;
     }
 
-    // 取消所有选中
-    menu_item_deselect_all(menu);
-
     // 设置新选中项
-    menu->selected_child = new_index;
-    menu->children[new_index]->is_selected = 1;
+    MENU_SELECTED(menu) = new_index;
 
     g_menu_sys.need_refresh = 1;
 }
@@ -981,7 +778,7 @@ static void menu_item_update_selection(menu_item_t *menu, uint8_t new_index)
 // 自定义页面显示实现
 // ==================================
 
-void menu_display_custom(menu_item_t *menu)
+void menu_display_custom(const menu_item_t *menu)
 {
     if (menu == NULL || menu->content.custom.draw_function == NULL)
     {
@@ -1020,5 +817,5 @@ static void menu_set_layout_for_type(menu_type_t type)
         break;
     }
 
-    printf("Set layout for menu type: %d\r\n", type);
+    LOG_D(MENU, "Set layout for menu type: %d\r\n", type);
 }